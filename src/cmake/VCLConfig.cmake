@@ -53,8 +53,15 @@ SET(VCL_VECTORIZE_SSE4_1 CACHE BOOL "Enable SSE 4.1 instruction set")
 SET(VCL_VECTORIZE_SSE4_2 CACHE BOOL "Enable SSE 4.2 instruction set")
 SET(VCL_VECTORIZE_AVX CACHE BOOL "Enable AVX instruction set")
 SET(VCL_VECTORIZE_AVX2 CACHE BOOL "Enable AVX 2 instruction set")
+SET(VCL_VECTORIZE_AVX512 CACHE BOOL "Enable AVX 512 instruction set")
 SET(VCL_VECTORIZE_NEON CACHE BOOL "Enable NEON instruction set")
 
+# Additionally build selected kernels for newer instruction sets and pick them at runtime
+SET(VCL_VECTORIZE_DISPATCH CACHE BOOL "Enable runtime dispatch of SIMD kernels")
+
+# BMI2 (pdep/pext) is microcoded on AMD processors before Zen 3, thus it is not implied by AVX2
+SET(VCL_USE_BMI2 CACHE BOOL "Enable BMI2 instructions for bit (de-)interleaving")
+
 # Set whether contracts should be used
 SET(VCL_USE_CONTRACTS CACHE BOOL "Enable contracts")
 
@@ -72,7 +79,10 @@ IF(VCL_COMPILER_MSVC)
 	SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /W4 /EHsc /GR")
 	
 	# Make AVX available
-	IF(VCL_VECTORIZE_AVX2)
+	IF(VCL_VECTORIZE_AVX512)
+		SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} /arch:AVX512")
+		SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /arch:AVX512")
+	ELSEIF(VCL_VECTORIZE_AVX2)
 		SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} /arch:AVX2")
 		SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /arch:AVX2")
 	ELSEIF(VCL_VECTORIZE_AVX)
@@ -100,7 +110,10 @@ IF(VCL_COMPILER_GNU OR VCL_COMPILER_CLANG)
 		SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -Wno-ignored-attributes")
 	ENDIF() 
 
-	IF(VCL_VECTORIZE_AVX2)
+	IF(VCL_VECTORIZE_AVX512)
+		SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -mavx512f -mavx512cd -mavx512bw -mavx512dq -mavx512vl -mfma")
+		SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mavx512f -mavx512cd -mavx512bw -mavx512dq -mavx512vl -mfma")
+	ELSEIF(VCL_VECTORIZE_AVX2)
 		SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -mavx2")
 		SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mavx2")
 	ELSEIF(VCL_VECTORIZE_AVX)
@@ -122,4 +135,48 @@ IF(VCL_COMPILER_GNU OR VCL_COMPILER_CLANG)
 		SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -msse2")
 		SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -msse2")
 	ENDIF()
+
+	IF(VCL_USE_BMI2)
+		SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -mbmi2")
+		SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mbmi2")
+	ENDIF()
 ENDIF(VCL_COMPILER_GNU OR VCL_COMPILER_CLANG)
+
+# Compiler flags of the instruction sets supported by the runtime dispatch
+SET(VCL_DISPATCH_INSTRUCTION_SETS SSE2 SSE3 SSSE3 SSE4_1 SSE4_2 AVX AVX2 AVX512)
+IF(VCL_COMPILER_MSVC)
+	SET(VCL_DISPATCH_FLAGS_SSE4_1 "")
+	SET(VCL_DISPATCH_FLAGS_SSE4_2 "")
+	SET(VCL_DISPATCH_FLAGS_AVX "/arch:AVX")
+	SET(VCL_DISPATCH_FLAGS_AVX2 "/arch:AVX2")
+	SET(VCL_DISPATCH_FLAGS_AVX512 "/arch:AVX512")
+ELSEIF(VCL_COMPILER_GNU OR VCL_COMPILER_CLANG)
+	SET(VCL_DISPATCH_FLAGS_SSE4_1 "-msse4.1")
+	SET(VCL_DISPATCH_FLAGS_SSE4_2 "-msse4.2")
+	SET(VCL_DISPATCH_FLAGS_AVX "-mavx")
+	SET(VCL_DISPATCH_FLAGS_AVX2 "-mavx2 -mfma")
+	SET(VCL_DISPATCH_FLAGS_AVX512 "-mavx512f -mavx512cd -mavx512bw -mavx512dq -mavx512vl -mfma")
+ENDIF()
+
+# Compile a source file containing kernels for the given instruction set.
+# Files targeting an instruction set covered by the configured baseline
+# are compiled with the default flags. Without dispatch support, kernels
+# beyond the baseline are disabled by the VCL_VECTORIZE_* checks in the file.
+FUNCTION(VCL_DISPATCH_SOURCE file isa)
+	IF(NOT VCL_VECTORIZE_DISPATCH)
+		RETURN()
+	ENDIF()
+
+	LIST(FIND VCL_DISPATCH_INSTRUCTION_SETS ${isa} isa_idx)
+	FOREACH(baseline ${VCL_DISPATCH_INSTRUCTION_SETS})
+		LIST(FIND VCL_DISPATCH_INSTRUCTION_SETS ${baseline} baseline_idx)
+		IF(VCL_VECTORIZE_${baseline} AND NOT baseline_idx LESS isa_idx)
+			RETURN()
+		ENDIF()
+	ENDFOREACH()
+
+	SET_SOURCE_FILES_PROPERTIES(${file} PROPERTIES
+		COMPILE_FLAGS "${VCL_DISPATCH_FLAGS_${isa}}"
+		COMPILE_DEFINITIONS VCL_VECTORIZE_${isa}
+	)
+ENDFUNCTION()
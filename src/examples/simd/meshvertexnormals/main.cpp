@@ -309,6 +309,7 @@ void computeNormalsSIMD
 {
 	using Vcl::gather;
 	using Vcl::load;
+	using Vcl::scatter;
 	using Vcl::store;
 
 	using wint_t = Vcl::VectorScalar<int, Width>;
@@ -378,10 +379,8 @@ void computeNormalsSIMD
 			// Calculate handedness
 			wfloat_t hand = select(n.cross(t).dot(b) < 0.0f, wfloat_t{ -1.0f }, wfloat_t{ 1.0f });
 
-			for (int k = 0; k < Width; k++)
-			{
-				out_tangents[tf(j)[k]] = { tan.x()[k], tan.y()[k], tan.z()[k], hand[k] };
-			}
+			Eigen::Matrix<wfloat_t, 4, 1> tangent{ tan.x(), tan.y(), tan.z(), hand };
+			scatter<float, Width, 4, 1>(tangent, out_tangents.data(), tf(j));
 		}
 	}
 
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/components/commandbuffer.h>
+
+namespace Vcl { namespace Components
+{
+	CommandBuffer::DeferredEntity CommandBuffer::create()
+	{
+		// The entities are created in recording order, thus the index of
+		// the entity is known upfront
+		_commands.emplace_back([](EntityManager& em, std::vector<Entity>& created)
+		{
+			created.emplace_back(em.create());
+		});
+
+		return DeferredEntity{ _nrCreatedEntities++ };
+	}
+
+	void CommandBuffer::destroy(Entity e)
+	{
+		_commands.emplace_back([e](EntityManager& em, std::vector<Entity>&)
+		{
+			em.destroy(e);
+		});
+	}
+
+	void CommandBuffer::destroy(DeferredEntity e)
+	{
+		_commands.emplace_back([e](EntityManager& em, std::vector<Entity>& created)
+		{
+			em.destroy(created[e._idx]);
+		});
+	}
+
+	std::vector<Entity> CommandBuffer::execute(EntityManager& em)
+	{
+		std::vector<Entity> created;
+		created.reserve(_nrCreatedEntities);
+
+		for (auto& cmd : _commands)
+		{
+			cmd(em, created);
+		}
+
+		Ensure(created.size() == _nrCreatedEntities, "All entities were created.");
+
+		clear();
+		return created;
+	}
+
+	void CommandBuffer::clear()
+	{
+		_commands.clear();
+		_nrCreatedEntities = 0;
+	}
+}}
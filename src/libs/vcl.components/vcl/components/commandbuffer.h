@@ -0,0 +1,147 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <functional>
+#include <vector>
+
+// VCL
+#include <vcl/components/entity.h>
+#include <vcl/components/entitymanager.h>
+
+namespace Vcl { namespace Components
+{
+	/*!
+	 *	\class CommandBuffer
+	 *	\brief Record changes to an entity manager for later execution
+	 *
+	 *	Entities and components cannot be created or destroyed while other
+	 *	threads access the entity manager. Instead, each thread records its
+	 *	changes into its own command buffer. The buffers are executed at a
+	 *	synchronisation point, where the commands are applied in the order
+	 *	they were recorded. Executing the buffers in a fixed order makes the
+	 *	result independent of the thread scheduling.
+	 */
+	class CommandBuffer
+	{
+	public:
+		/*!
+		 *	\brief Reference to an entity created by a command buffer
+		 *
+		 *	The entity only exists after the command buffer was executed.
+		 */
+		class DeferredEntity
+		{
+			friend class CommandBuffer;
+
+		private:
+			explicit DeferredEntity(size_t idx) : _idx(idx) {}
+
+		private:
+			//! Index of the entity in the list of created entities
+			size_t _idx;
+		};
+
+	public:
+		/*!
+		 *	\brief Record the creation of an entity
+		 *	\returns a reference to the entity which can be used in subsequent commands
+		 */
+		DeferredEntity create();
+
+		//! Record the destruction of an entity
+		void destroy(Entity e);
+
+		//! Record the destruction of an entity created by this buffer
+		void destroy(DeferredEntity e);
+
+		/*!
+		 *	\brief Record the creation of a component
+		 *
+		 *	The component is constructed immediately and copied into the
+		 *	entity manager when the buffer is executed.
+		 */
+		template<typename C, typename... Args>
+		void create(Entity e, Args&&... args)
+		{
+			C component(std::forward<Args>(args)...);
+			_commands.emplace_back([e, component](EntityManager& em, std::vector<Entity>&)
+			{
+				em.create<C>(e, component);
+			});
+		}
+
+		//! Record the creation of a component of an entity created by this buffer
+		template<typename C, typename... Args>
+		void create(DeferredEntity e, Args&&... args)
+		{
+			C component(std::forward<Args>(args)...);
+			_commands.emplace_back([e, component](EntityManager& em, std::vector<Entity>& created)
+			{
+				em.create<C>(created[e._idx], component);
+			});
+		}
+
+		//! Record the removal of a component
+		template<typename C>
+		void remove(Entity e)
+		{
+			_commands.emplace_back([e](EntityManager& em, std::vector<Entity>&)
+			{
+				em.remove<C>(e);
+			});
+		}
+
+	public:
+		/*!
+		 *	\brief Apply all recorded commands and clear the buffer
+		 *	\param em Entity manager to apply the commands to
+		 *	\returns the entities created by the buffer in the order of their creation
+		 */
+		std::vector<Entity> execute(EntityManager& em);
+
+		//! Discard all recorded commands
+		void clear();
+
+		//! \returns true if no commands were recorded
+		bool empty() const { return _commands.empty(); }
+
+		//! \returns the number of recorded commands
+		size_t size() const { return _commands.size(); }
+
+	private:
+		using Command = std::function<void(EntityManager&, std::vector<Entity>&)>;
+
+		//! Recorded commands
+		std::vector<Command> _commands;
+
+		//! Number of entities created by the recorded commands
+		size_t _nrCreatedEntities{ 0 };
+	};
+}}
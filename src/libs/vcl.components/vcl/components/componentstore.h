@@ -29,29 +29,70 @@
 
 // C++ standard library
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 // VCL
 #include <vcl/components/entity.h>
+#include <vcl/util/parallelfor.h>
 
 namespace Vcl { namespace Components
 {
+	namespace Detail
+	{
+		/*!
+		 *	\brief Invoke a function for each entry of a hash-map in parallel
+		 *	\param map Hash-map with entity ids as keys
+		 *	\param f Function with the signature (EntityId, T*)
+		 *	\param grain_size Number of buckets processed as one chunk
+		 */
+		template<typename Map, typename Func>
+		void parallelForEachBucket(Map& map, Func& f, size_t grain_size)
+		{
+			Util::parallelForChunks(map.bucket_count(), grain_size, [&map, &f](size_t first, size_t last)
+			{
+				for (size_t b = first; b < last; b++)
+				{
+					for (auto entry = map.begin(b); entry != map.end(b); ++entry)
+					{
+						f(entry->first, &entry->second);
+					}
+				}
+			});
+		}
+	}
+
 	template<typename T>
 	struct ComponentTraits
 	{
 		static const bool IsUnique{ true };
 	};
 
+	/*!
+	 *	\brief Memory layout of a store of unique components
+	 */
+	enum class ComponentStorage
+	{
+		//! Components are kept in a hash-map indexed by the entity id
+		Hashed,
+
+		//! Components are packed into an array indexed through a sparse entity table
+		Dense
+	};
+
 	/*!
 	 *	\class ComponentStoreBase
 	 *	\brief Base class for component storage
 	 */
 	class ComponentStoreBase
 	{
-
+	public:
+		virtual ~ComponentStoreBase() = default;
 	};
 	
 	/*!
@@ -60,6 +101,11 @@ namespace Vcl { namespace Components
 	 *
 	 *	This class is the heart of the component system. It efficiently stores
 	 *	and finds components of an entity.
+	 *	The dense storage keeps all components in a single packed array which is
+	 *	indexed through a table of entity indices. Lookups are thus without
+	 *	hashing and iteration is linear in memory. In contrast to the hashed
+	 *	storage, pointers to components are invalidated when components are
+	 *	added or removed.
 	 */
 	template<typename T>
 	class ComponentStore : public ComponentStoreBase
@@ -67,29 +113,188 @@ namespace Vcl { namespace Components
 	public:
 		using ComponentType = T;
 
+		//! Marker for unused entries in the entity index table
+		static const uint32_t InvalidIndex{ std::numeric_limits<uint32_t>::max() };
+
+	public:
+		ComponentStore(ComponentStorage storage = ComponentStorage::Hashed)
+		: _storage(storage)
+		{
+		}
+
 	public:
+		ComponentStorage storage() const
+		{
+			return _storage;
+		}
+
 		bool empty() const
 		{
-			return _components.empty();
+			if (_storage == ComponentStorage::Dense)
+				return _denseComponents.empty();
+			else
+				return _components.empty();
+		}
+
+		size_t size() const
+		{
+			if (_storage == ComponentStorage::Dense)
+				return _denseComponents.size();
+			else
+				return _components.size();
 		}
 
 		bool has(EntityId id) const
 		{
-			return _components.find(id) != _components.end();
+			if (_storage == ComponentStorage::Dense)
+				return denseIndex(id) != InvalidIndex;
+			else
+				return _components.find(id) != _components.end();
 		}
 
 		auto operator()(EntityId id) -> ComponentType*
 		{
-			return &_components.find(id)->second;
+			if (_storage == ComponentStorage::Dense)
+				return &_denseComponents[denseIndex(id)];
+			else
+				return &_components.find(id)->second;
+		}
+
+		//! \returns the component of 'id' or nullptr if there is none
+		auto find(EntityId id) -> ComponentType*
+		{
+			if (_storage == ComponentStorage::Dense)
+			{
+				const uint32_t idx = denseIndex(id);
+				return idx != InvalidIndex ? &_denseComponents[idx] : nullptr;
+			}
+			else
+			{
+				auto entry = _components.find(id);
+				return entry != _components.end() ? &entry->second : nullptr;
+			}
+		}
+
+		template<typename Func>
+		void forEach(Func&& f)
+		{
+			if (_storage == ComponentStorage::Dense)
+			{
+				const size_t nr_components = _denseComponents.size();
+				for (size_t i = 0; i < nr_components; i++)
+				{
+					f(_denseEntities[i], &_denseComponents[i]);
+				}
+			}
+			else
+			{
+				for (auto& entry : _components)
+				{
+					f(entry.first, &entry.second);
+				}
+			}
 		}
 
 		template<typename Func>
 		void forEach(Func&& f) const
 		{
-			for (auto& entry : _components)
+			if (_storage == ComponentStorage::Dense)
 			{
-				f(entry.first, &entry.second);
+				const size_t nr_components = _denseComponents.size();
+				for (size_t i = 0; i < nr_components; i++)
+				{
+					f(_denseEntities[i], &_denseComponents[i]);
+				}
 			}
+			else
+			{
+				for (auto& entry : _components)
+				{
+					f(entry.first, &entry.second);
+				}
+			}
+		}
+
+		/*!
+		 *	\brief Invoke a function for each component in parallel
+		 *	\param f Function with the signature (EntityId, ComponentType*).
+		 *	          It is called concurrently for different components.
+		 *	\param grain_size Number of components (dense storage) or hash
+		 *	                  buckets (hashed storage) processed as one chunk
+		 *
+		 *	\note The chunks are only processed concurrently if the library is
+		 *	      built with OpenMP (VCL_OPENMP_SUPPORT), which is disabled by
+		 *	      default. Otherwise the components are visited serially.
+		 */
+		template<typename Func>
+		void parallelForEach(Func&& f, size_t grain_size = 1024)
+		{
+			parallelForEachImpl(*this, f, grain_size);
+		}
+
+		template<typename Func>
+		void parallelForEach(Func&& f, size_t grain_size = 1024) const
+		{
+			parallelForEachImpl(*this, f, grain_size);
+		}
+
+	private:
+		template<typename Store, typename Func>
+		static void parallelForEachImpl(Store& store, Func& f, size_t grain_size)
+		{
+			Require(grain_size > 0, "Chunks are not empty.");
+
+			if (store._storage == ComponentStorage::Dense)
+			{
+				Util::parallelForChunks(store._denseComponents.size(), grain_size, [&store, &f](size_t first, size_t last)
+				{
+					for (size_t i = first; i < last; i++)
+					{
+						f(store._denseEntities[i], &store._denseComponents[i]);
+					}
+				});
+			}
+			else
+			{
+				Detail::parallelForEachBucket(store._components, f, grain_size);
+			}
+		}
+
+	public: // Direct access to the dense storage
+		//! \returns the position of the component of 'id' in the packed array
+		uint32_t denseIndex(EntityId id) const
+		{
+			Require(_storage == ComponentStorage::Dense, "Store uses dense storage.");
+
+			if (id.id() >= _denseIndices.size())
+				return InvalidIndex;
+
+			const uint32_t idx = _denseIndices[id.id()];
+			if (idx == InvalidIndex || _denseEntities[idx] != id)
+				return InvalidIndex;
+
+			return idx;
+		}
+
+		//! \returns the packed components
+		const ComponentType* data() const
+		{
+			Require(_storage == ComponentStorage::Dense, "Store uses dense storage.");
+			return _denseComponents.data();
+		}
+
+		//! \returns the packed components
+		ComponentType* data()
+		{
+			Require(_storage == ComponentStorage::Dense, "Store uses dense storage.");
+			return _denseComponents.data();
+		}
+
+		//! \returns the entities owning the packed components
+		const EntityId* entities() const
+		{
+			Require(_storage == ComponentStorage::Dense, "Store uses dense storage.");
+			return _denseEntities.data();
 		}
 
 	public:
@@ -98,16 +303,81 @@ namespace Vcl { namespace Components
 		{
 			Require(!has(id), "Component for entity does not exist.");
 
-			auto newElemIter = _components.emplace(id, std::forward<Args>(args)...);
+			if (_storage == ComponentStorage::Dense)
+			{
+				if (id.id() >= _denseIndices.size())
+					_denseIndices.resize(id.id() + 1, InvalidIndex);
+
+				// Reuse the slot of a component left behind by a destroyed entity
+				uint32_t& idx = _denseIndices[id.id()];
+				if (idx != InvalidIndex)
+				{
+					_denseEntities[idx] = id;
+					_denseComponents[idx] = ComponentType(std::forward<Args>(args)...);
+					return &_denseComponents[idx];
+				}
+
+				idx = static_cast<uint32_t>(_denseComponents.size());
+				_denseEntities.emplace_back(id);
+				_denseComponents.emplace_back(std::forward<Args>(args)...);
+
+				Ensure(_denseComponents.size() == _denseEntities.size(), "Dense storage is consistent.");
+				return &_denseComponents.back();
+			}
+
+			auto newElemIter = _components.emplace(std::piecewise_construct, std::forward_as_tuple(id), std::forward_as_tuple(std::forward<Args>(args)...));
 
 			Ensure(newElemIter.second, "Element was inserted.");
 			return &newElemIter.first->second;
 		}
 
+		void remove(EntityId id)
+		{
+			Require(has(id), "Component for entity exists.");
+
+			if (_storage == ComponentStorage::Dense)
+			{
+				// Move the last component into the freed slot
+				const uint32_t idx = _denseIndices[id.id()];
+				const uint32_t last = static_cast<uint32_t>(_denseComponents.size() - 1);
+				if (idx != last)
+				{
+					_denseComponents[idx] = std::move(_denseComponents[last]);
+					_denseEntities[idx] = _denseEntities[last];
+					_denseIndices[_denseEntities[idx].id()] = idx;
+				}
+				_denseComponents.pop_back();
+				_denseEntities.pop_back();
+				_denseIndices[id.id()] = InvalidIndex;
+			}
+			else
+			{
+				_components.erase(id);
+			}
+
+			Ensure(!has(id), "Component was removed.");
+		}
+
 	public:
 		std::unordered_map<EntityId, ComponentType> _components;
+
+	private:
+		//! Selected storage layout
+		ComponentStorage _storage;
+
+		//! Packed components of the dense storage
+		std::vector<ComponentType> _denseComponents;
+
+		//! Entity owning each packed component
+		std::vector<EntityId> _denseEntities;
+
+		//! Map from entity indices to positions in the packed array
+		std::vector<uint32_t> _denseIndices;
 	};
 
+	template<typename T>
+	const uint32_t ComponentStore<T>::InvalidIndex;
+
 	template<typename T>
 	class MultiComponentStoreBase : public ComponentStoreBase
 	{
@@ -131,6 +401,31 @@ namespace Vcl { namespace Components
 			return _components.equal_range(id);
 		}
 
+		/*!
+		 *	\brief Invoke a function for each component in parallel
+		 *	\param f Function with the signature (EntityId, ComponentType*).
+		 *	          It is called concurrently for different components.
+		 *	\param grain_size Number of hash buckets processed as one chunk
+		 *
+		 *	\note Runs serially unless the library is built with OpenMP
+		 *	      (VCL_OPENMP_SUPPORT), which is disabled by default.
+		 */
+		template<typename Func>
+		void parallelForEach(Func&& f, size_t grain_size = 1024)
+		{
+			Require(grain_size > 0, "Chunks are not empty.");
+
+			Detail::parallelForEachBucket(_components, f, grain_size);
+		}
+
+		template<typename Func>
+		void parallelForEach(Func&& f, size_t grain_size = 1024) const
+		{
+			Require(grain_size > 0, "Chunks are not empty.");
+
+			Detail::parallelForEachBucket(_components, f, grain_size);
+		}
+
 	public:
 		template<typename... Args>
 		auto create(EntityId id, Args... args) -> ComponentType*
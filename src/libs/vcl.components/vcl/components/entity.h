@@ -147,7 +147,7 @@ namespace Vcl { namespace Core
 
 		bool operator != (const GenerationalId<Derived, IdType, GenerationType>& rhs) const
 		{
-			return _generation != rhs._generation && _id != rhs._id;
+			return _generation != rhs._generation || _id != rhs._id;
 		}
 
 	protected:
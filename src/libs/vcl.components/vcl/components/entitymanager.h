@@ -36,6 +36,7 @@
 // VCL
 #include <vcl/components/componentstore.h>
 #include <vcl/components/entity.h>
+#include <vcl/components/view.h>
 
 namespace Vcl { namespace Components
 {
@@ -60,7 +61,12 @@ namespace Vcl { namespace Components
 		void destroy(Entity e);
 
 	public:
-		template<typename C>
+		/*!
+		 *	\brief Register a unique component type
+		 *	\tparam C Type of the component
+		 *	\tparam Storage Memory layout used to store the components
+		 */
+		template<typename C, ComponentStorage Storage = ComponentStorage::Hashed>
 		void registerComponent()
 		{
 			Require(_components.find(typeid(C).hash_code()) == _components.end(), "Component type not registered.");
@@ -68,7 +74,7 @@ namespace Vcl { namespace Components
 			size_t hash = typeid(C).hash_code();
 			if (_components.find(hash) == _components.end())
 			{
-				_components[hash] = std::make_unique<ComponentStore<C>>();
+				_components[hash] = std::make_unique<ComponentStore<C>>(Storage);
 			}
 
 			Ensure(_components.find(typeid(C).hash_code()) != _components.end(), "Component type registered.");
@@ -114,6 +120,19 @@ namespace Vcl { namespace Components
 			return c->create(e._id, std::forward<Args>(args)...);
 		}
 
+		template<typename C>
+		typename std::enable_if<ComponentTraits<C>::IsUnique>::type
+			remove(Entity e)
+		{
+			Require(_components.find(typeid(C).hash_code()) != _components.end(), "Component type registered.");
+			Require(e._manager == this, "Entity belongs the this system.");
+
+			size_t hash = typeid(C).hash_code();
+			auto c = static_cast<ComponentStore<C>*>(_components[hash].get());
+
+			c->remove(e._id);
+		}
+
 		template<typename C>
 		const typename std::enable_if<ComponentTraits<C>::IsUnique, ComponentStore<C>>::type*
 			get() const
@@ -138,6 +157,16 @@ namespace Vcl { namespace Components
 			return c;
 		}
 
+		/*!
+		 *	\brief Create a joined view over a set of unique components
+		 *	\returns a view iterating all entities owning all components
+		 */
+		template<typename... Cs>
+		ComponentView<Cs...> view()
+		{
+			return{ store<Cs>()... };
+		}
+
 		template<typename C>
 		bool has(Entity e)
 		{
@@ -171,6 +200,17 @@ namespace Vcl { namespace Components
 			return _generations.size();
 		}
 
+	private:
+		template<typename C>
+		ComponentStore<C>* store()
+		{
+			static_assert(ComponentTraits<C>::IsUnique, "Views support only unique components.");
+			Require(_components.find(typeid(C).hash_code()) != _components.end(), "Component type registered.");
+
+			size_t hash = typeid(C).hash_code();
+			return static_cast<ComponentStore<C>*>(_components.find(hash)->second.get());
+		}
+
 	private: // Entity management
 		//! List of allocated entity-entries. Its size gives the number of in total allocated entities.
 		std::vector<uint32_t> _generations;
@@ -22,3 +22,40 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include <vcl/components/system.h>
+
+// C++ standard library
+#include <algorithm>
+
+namespace Vcl { namespace Components
+{
+	System::System()
+	{
+	}
+
+	void System::update(EntityManager& em)
+	{
+		VCL_UNREFERENCED_PARAMETER(em);
+	}
+
+	bool System::conflicts(const System& other) const
+	{
+		auto contains = [](const std::vector<size_t>& types, size_t type)
+		{
+			return std::find(types.begin(), types.end(), type) != types.end();
+		};
+
+		for (auto type : _writes)
+		{
+			if (contains(other._reads, type) || contains(other._writes, type))
+				return true;
+		}
+		for (auto type : other._writes)
+		{
+			if (contains(_reads, type))
+				return true;
+		}
+
+		return false;
+	}
+}}
@@ -28,8 +28,10 @@
 #include <vcl/config/global.h>
 
 // C++ standard library
-#include <unordered_map>
 #include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
 
 // VCL
 #include <vcl/components/entitymanager.h>
@@ -39,18 +41,59 @@ namespace Vcl { namespace Components
 	/*!
 	 * \class System
 	 * \brief Base for all systems
+	 *
+	 * Each system declares the component types it reads and writes in its
+	 * constructor. The SystemManager uses these declarations to execute
+	 * systems without conflicting accesses concurrently. They are read once
+	 * a system is added, thus they cannot be changed afterwards.
 	 */
 	class System
 	{
 	public:
 		System();
+		virtual ~System() = default;
 
 	public:
 		void setName(const std::string& name) { _name = name; }
 		const std::string& name() const { return _name; }
 
+	public:
+		/*!
+		 * \brief Execute the system
+		 * \param em Entity manager holding the components processed by the system
+		 */
+		virtual void update(EntityManager& em);
+
+	public:
+		/*!
+		 * \brief Check if two systems access the same components
+		 * \returns true, if one system writes a component type the other accesses
+		 */
+		bool conflicts(const System& other) const;
+
+	protected: // Component access, declared by the constructors of derived systems
+		//! Declare that the system reads components of type C
+		template<typename C>
+		void reads()
+		{
+			_reads.emplace_back(typeid(C).hash_code());
+		}
+
+		//! Declare that the system writes components of type C
+		template<typename C>
+		void writes()
+		{
+			_writes.emplace_back(typeid(C).hash_code());
+		}
+
 	private:
 		//! Readable name of the system
 		std::string _name;
+
+		//! Component types read by the system
+		std::vector<size_t> _reads;
+
+		//! Component types written by the system
+		std::vector<size_t> _writes;
 	};
 }}
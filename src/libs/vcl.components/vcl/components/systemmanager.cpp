@@ -24,6 +24,12 @@
  */
 #include <vcl/components/systemmanager.h>
 
+// C++ standard library
+#include <algorithm>
+
+// VCL
+#include <vcl/util/parallelfor.h>
+
 namespace Vcl { namespace Components
 {
 	SystemManager::SystemManager(Core::ref_ptr<EntityManager> em)
@@ -31,4 +37,52 @@ namespace Vcl { namespace Components
 	{
 
 	}
+
+	void SystemManager::update()
+	{
+		if (!_scheduleValid)
+			buildSchedule();
+
+		auto& em = *_entities;
+		for (const auto& stage : _stages)
+		{
+			Util::parallelFor(stage.size(), 1, [&stage, &em](ptrdiff_t i)
+			{
+				stage[i]->update(em);
+			});
+		}
+	}
+
+	size_t SystemManager::nrStages()
+	{
+		if (!_scheduleValid)
+			buildSchedule();
+
+		return _stages.size();
+	}
+
+	void SystemManager::buildSchedule()
+	{
+		_stages.clear();
+
+		// A system is executed in the stage after the last system
+		// it conflicts with. This keeps the order of conflicting systems.
+		std::vector<size_t> stage_of(_systems.size(), 0);
+		for (size_t i = 0; i < _systems.size(); i++)
+		{
+			size_t stage = 0;
+			for (size_t j = 0; j < i; j++)
+			{
+				if (_systems[i]->conflicts(*_systems[j]))
+					stage = std::max(stage, stage_of[j] + 1);
+			}
+			stage_of[i] = stage;
+
+			if (stage >= _stages.size())
+				_stages.resize(stage + 1);
+			_stages[stage].emplace_back(_systems[i].get());
+		}
+
+		_scheduleValid = true;
+	}
 }}
@@ -29,6 +29,7 @@
 
 // C++ standard library
 #include <unordered_map>
+#include <vector>
 
 // VCL
 #include <vcl/core/memory/smart_ptr.h>
@@ -40,6 +41,10 @@ namespace Vcl { namespace Components
 	/*!
 	 * \class SystemManager
 	 * \brief Base for all systems
+	 *
+	 * Systems are only updated in parallel if OpenMP is enabled
+	 * (VCL_OPENMP_SUPPORT). In a default build the frame loop stays
+	 * single-threaded.
 	 */
 	class SystemManager
 	{
@@ -59,7 +64,9 @@ namespace Vcl { namespace Components
 		Core::ref_ptr<S> add(Core::owner_ptr<S> system)
 		{
 			_systems.emplace_back(std::move(system));
-			return _systems.back();
+			_scheduleValid = false;
+
+			return static_pointer_cast<S>(ref_ptr<System>(_systems.back()));
 		}
 
 		/*!
@@ -85,18 +92,45 @@ namespace Vcl { namespace Components
 			{
 				if (dynamic_cast<S*>(sys.get()))
 				{
-					return sys;
+					return static_pointer_cast<S>(ref_ptr<System>(sys));
 				}
 			}
 
 			return{};
 		}
 
+		/*!
+		 *	Execute all registered systems.
+		 *
+		 *	Systems accessing the same components are executed in the order
+		 *	they were added. Systems without conflicting component accesses
+		 *	are grouped into stages, whose systems are executed concurrently.
+		 *
+		 *	\note The systems of a stage are only executed concurrently when
+		 *	       the library is built with OpenMP (VCL_OPENMP_SUPPORT), which
+		 *	       is disabled by default. Otherwise all systems are executed
+		 *	       one after another on the calling thread.
+		 */
+		void update();
+
+		//! \returns the number of stages the systems are executed in
+		size_t nrStages();
+
+	private:
+		//! Group the systems into stages of non-conflicting systems
+		void buildSchedule();
+
 	private:
 		//! Entity manager these systems refer to
 		Core::ref_ptr<EntityManager> _entities;
 
 		//! Systems updated by this manager
 		std::vector<Core::owner_ptr<System>> _systems;
+
+		//! Systems grouped into stages which can be executed concurrently
+		std::vector<std::vector<System*>> _stages;
+
+		//! Indicate whether the stages reflect the registered systems
+		bool _scheduleValid{ false };
 	};
 }}
@@ -0,0 +1,191 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// GSL
+#include <gsl/span>
+
+// VCL
+#include <vcl/core/contract.h>
+#include <vcl/components/componentstore.h>
+#include <vcl/components/entity.h>
+
+namespace Vcl { namespace Components
+{
+	/*!
+	 *	\class ComponentView
+	 *	\brief Joined iteration over entities owning a set of components
+	 *
+	 *	The view iterates the smallest of the involved stores and resolves
+	 *	the components of the other stores per entity. Stores using the dense
+	 *	storage resolve entities through their index table, without hashing.
+	 *	Batches of components can be processed through spans referring
+	 *	directly into the packed arrays of the stores.
+	 */
+	template<typename... Components>
+	class ComponentView
+	{
+	public:
+		using Stores = std::tuple<ComponentStore<Components>*...>;
+
+		template<size_t I>
+		using ComponentType = typename std::tuple_element<I, std::tuple<Components...>>::type;
+
+	public:
+		ComponentView(ComponentStore<Components>*... stores)
+		: _stores(stores...)
+		{
+		}
+
+	public:
+		/*!
+		 *	\brief Invoke a function for each entity owning all components
+		 *	\param f Function with the signature (EntityId, Components&...)
+		 */
+		template<typename Func>
+		void forEach(Func&& f)
+		{
+			forEach(std::forward<Func>(f), std::index_sequence_for<Components...>{});
+		}
+
+		/*!
+		 *	\brief Invoke a function for batches of entities owning all components
+		 *	\param f Function with the signature (gsl::span<const EntityId>, gsl::span<Components>...)
+		 *	\param batch_size Maximum number of entities in a batch
+		 *
+		 *	The component spans refer to the memory of the stores. A batch ends
+		 *	early when the components of the next entity are not adjacent to the
+		 *	previous ones in every store. Dense stores filled in the same order
+		 *	yield full batches, hashed stores usually single entities.
+		 */
+		template<typename Func>
+		void forEachBatch(Func&& f, size_t batch_size = 256)
+		{
+			forEachBatch(f, batch_size, std::index_sequence_for<Components...>{});
+		}
+
+	private:
+		template<typename Func, size_t... Is>
+		void forEachBatch(Func& f, size_t batch_size, std::index_sequence<Is...>)
+		{
+			Require(batch_size > 0, "Batches are not empty.");
+
+			std::vector<EntityId> ids;
+			ids.reserve(batch_size);
+			std::tuple<Components*...> first;
+
+			auto flush = [&ids, &first, &f]()
+			{
+				const auto count = static_cast<std::ptrdiff_t>(ids.size());
+				if (count > 0)
+					f(gsl::span<const EntityId>(ids.data(), count), gsl::span<Components>(std::get<Is>(first), count)...);
+				ids.clear();
+			};
+
+			forEach([&ids, &first, &flush, batch_size](EntityId id, Components&... components)
+			{
+				const size_t count = ids.size();
+				if (count == batch_size || (count > 0 && !all_of({ &components == std::get<Is>(first) + count... })))
+					flush();
+
+				if (ids.empty())
+					first = std::make_tuple(&components...);
+				ids.emplace_back(id);
+			});
+			flush();
+		}
+
+		template<typename Func, size_t... Is>
+		void forEach(Func&& f, std::index_sequence<Is...>)
+		{
+			// Select the store with the fewest components to drive the iteration
+			const size_t sizes[] = { std::get<Is>(_stores)->size()... };
+			size_t driver = 0;
+			size_t min_size = std::numeric_limits<size_t>::max();
+			for (size_t i = 0; i < sizeof...(Is); i++)
+			{
+				if (sizes[i] < min_size)
+				{
+					driver = i;
+					min_size = sizes[i];
+				}
+			}
+
+			const int dummy[] = { (Is == driver ? (iterate<Is>(f, std::index_sequence<Is...>{}), 0) : 0)... };
+			VCL_UNREFERENCED_PARAMETER(dummy);
+		}
+
+		template<size_t Driver, typename Func, size_t... Is>
+		void iterate(Func& f, std::index_sequence<Is...>)
+		{
+			std::get<Driver>(_stores)->forEach([this, &f](EntityId id, ComponentType<Driver>* c)
+			{
+				const auto components = std::make_tuple(resolve<Is, Driver>(id, c)...);
+				if (all_of({ std::get<Is>(components) != nullptr... }))
+				{
+					f(id, *std::get<Is>(components)...);
+				}
+			});
+		}
+
+		template<size_t I, size_t Driver>
+		typename std::enable_if<I == Driver, ComponentType<I>*>::type
+			resolve(EntityId, ComponentType<Driver>* c)
+		{
+			return c;
+		}
+
+		template<size_t I, size_t Driver>
+		typename std::enable_if<I != Driver, ComponentType<I>*>::type
+			resolve(EntityId id, ComponentType<Driver>*)
+		{
+			return std::get<I>(_stores)->find(id);
+		}
+
+		static bool all_of(std::initializer_list<bool> values)
+		{
+			for (bool v : values)
+			{
+				if (!v)
+					return false;
+			}
+			return true;
+		}
+
+	private:
+		//! Stores of the joined component types
+		Stores _stores;
+	};
+}}
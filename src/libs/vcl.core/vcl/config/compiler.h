@@ -163,6 +163,11 @@
 // Configure macros for SIMD
 #if (defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64))
 
+#	ifdef VCL_VECTORIZE_AVX512
+#		ifndef VCL_VECTORIZE_AVX2
+#			define VCL_VECTORIZE_AVX2
+#		endif
+#	endif 
 #	ifdef VCL_VECTORIZE_AVX2
 #		ifndef VCL_VECTORIZE_AVX
 #			define VCL_VECTORIZE_AVX
@@ -28,7 +28,15 @@
 #include <vcl/config/global.h>
 #include <vcl/config/eigen.h>
 
+// C++ standard library
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
 // VCL
+#include <vcl/core/memory/allocator.h>
+#include <vcl/core/memory/tracking.h>
 #include <vcl/core/contract.h>
 
 namespace Vcl { namespace Core
@@ -44,6 +52,105 @@ namespace Vcl { namespace Core
 		static const int value = sizeof(T1) / sizeof(T2);
 	};
 
+	namespace Detail
+	{
+		/*!
+		 *	\brief Transpose entries of \a nr_components consecutive scalars to
+		 *		   component planes
+		 *
+		 *	Entry i is written to the planes starting at
+		 *	planes + (i / group)*group*nr_components + i % group, which are
+		 *	\a group scalars apart.
+		 *
+		 *	\returns the number of entries processed. The remaining entries are
+		 *			 left to the caller.
+		 */
+		template<typename SCALAR>
+		size_t transposeToPlanes(SCALAR*, size_t, const SCALAR*, size_t, size_t)
+		{
+			return 0;
+		}
+
+		//! Write component planes back to consecutive entries (see transposeToPlanes)
+		template<typename SCALAR>
+		size_t transposeFromPlanes(SCALAR*, size_t, const SCALAR*, size_t, size_t)
+		{
+			return 0;
+		}
+
+#ifdef VCL_VECTORIZE_SSE
+		inline size_t transposeToPlanes(float* planes, size_t group, const float* entries, size_t nr_components, size_t count)
+		{
+			// Blocks of four entries must not cross a group
+			if (group % 4 != 0)
+				return 0;
+
+			// Entries with less than four components are read with a full
+			// vector reaching into the next block, which needs to exist.
+			const size_t K = nr_components;
+			const size_t margin = K < 4 ? 4 : 0;
+
+			size_t i = 0;
+			for (; i + 4 + margin <= count; i += 4)
+			{
+				float* base = planes + (i / group)*group*K + i % group;
+				const float* src = entries + i*K;
+
+				// Transpose 4x4 tiles, the last one overlapping the previous one
+				for (size_t c = 0; c < K; c += 4)
+				{
+					const size_t col = K < 4 ? 0 : std::min(c, K - 4);
+					__m128 r0 = _mm_loadu_ps(src + 0*K + col);
+					__m128 r1 = _mm_loadu_ps(src + 1*K + col);
+					__m128 r2 = _mm_loadu_ps(src + 2*K + col);
+					__m128 r3 = _mm_loadu_ps(src + 3*K + col);
+					_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+					const __m128 cols[] = { r0, r1, r2, r3 };
+					for (size_t k = 0; k < std::min<size_t>(K, 4); k++)
+						_mm_storeu_ps(base + (col + k)*group, cols[k]);
+				}
+			}
+
+			return i;
+		}
+
+		inline size_t transposeFromPlanes(float* entries, size_t nr_components, const float* planes, size_t group, size_t count)
+		{
+			if (group % 4 != 0)
+				return 0;
+
+			// Entries with less than four components are written with a full
+			// vector spilling into the next entry, which is overwritten afterwards.
+			const size_t K = nr_components;
+			const size_t margin = K < 4 ? 4 : 0;
+
+			size_t i = 0;
+			for (; i + 4 + margin <= count; i += 4)
+			{
+				const float* base = planes + (i / group)*group*K + i % group;
+				float* dst = entries + i*K;
+
+				for (size_t c = 0; c < K; c += 4)
+				{
+					const size_t col = K < 4 ? 0 : std::min(c, K - 4);
+					__m128 r[4];
+					for (size_t k = 0; k < 4; k++)
+						r[k] = k < K ? _mm_loadu_ps(base + (col + k)*group) : _mm_setzero_ps();
+					_MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+
+					_mm_storeu_ps(dst + 0*K + col, r[0]);
+					_mm_storeu_ps(dst + 1*K + col, r[1]);
+					_mm_storeu_ps(dst + 2*K + col, r[2]);
+					_mm_storeu_ps(dst + 3*K + col, r[3]);
+				}
+			}
+
+			return i;
+		}
+#endif // VCL_VECTORIZE_SSE
+	}
+
 	/*!
 	 *	Storage class storing the given matrix objects in row-major order.
 	 */
@@ -66,7 +173,7 @@ namespace Vcl { namespace Core
 		 *				  n: n elementy are grouped together. Note: 1 has the same effect as 0.
 		 *				  Dynamic: The stride is the same as the number of elements in the container.
 		 */
-		InterleavedArray(size_t size, int rows = ROWS, int cols = COLS, int stride = STRIDE)
+		InterleavedArray(size_t size = 0, int rows = ROWS, int cols = COLS, int stride = STRIDE)
 		: mSize(size), mRows(rows), mCols(cols), mStride(stride)
 		{
 			// Template configuration checks
@@ -78,23 +185,21 @@ namespace Vcl { namespace Core
 			Require(cols > 0, "Number of cols is positive.");
 			Require(stride == DynamicStride || stride >= 0, "Stride is Dynamic, 0 or greater 0");
 			
-			// Pad the requested size to the alignment
-			// Note: This is done in order to support optimaly sized vector operations
-			mAllocated = mSize;
-
-			// Add enough memory to compensate the stride size
-			if (stride != DynamicStride && stride > 1)
-			{
-				if (mAllocated % stride > 0)
-					mAllocated += stride - mAllocated % stride;
-			}
-
-			const size_t alignment = 32;
-			if (mAllocated % alignment > 0)
-				mAllocated += alignment - mAllocated % alignment;
-
 			// Allocate initial memory
-			mData = (SCALAR*) _mm_malloc(mAllocated*mRows*mCols*sizeof(SCALAR), alignment);
+			mAllocated = paddedSize(mSize);
+			mData = allocateStorage(mAllocated);
+		}
+
+		InterleavedArray(const InterleavedArray& rhs)
+		: mSize(rhs.mSize)
+		, mRows(rhs.mRows)
+		, mCols(rhs.mCols)
+		, mStride(rhs.mStride)
+		, mAllocPolicy(rhs.mAllocPolicy ? rhs.mAllocPolicy->clone() : nullptr)
+		{
+			mAllocated = paddedSize(mSize);
+			mData = allocateStorage(mAllocated);
+			copyEntries(mData, mAllocated, rhs.mData, rhs.mAllocated, mSize);
 		}
 
 		InterleavedArray(InterleavedArray&& rhs)
@@ -111,14 +216,42 @@ namespace Vcl { namespace Core
 			std::swap(mRows, rhs.mRows);
 			std::swap(mCols, rhs.mCols);
 			std::swap(mStride, rhs.mStride);
+			std::swap(mStatistics, rhs.mStatistics);
+			std::swap(mAllocPolicy, rhs.mAllocPolicy);
 		}
 
 		~InterleavedArray()
 		{
-			if (mData)
+			release();
+		}
+
+		InterleavedArray& operator=(const InterleavedArray& rhs)
+		{
+			if (this != &rhs)
 			{
-				_mm_free(mData);
+				Require(mRows == rhs.mRows && mCols == rhs.mCols && mStride == rhs.mStride, "Layouts match.");
+
+				mSize = 0;
+				reserve(rhs.mSize);
+				copyEntries(mData, mAllocated, rhs.mData, rhs.mAllocated, rhs.mSize);
+				mSize = rhs.mSize;
 			}
+
+			return *this;
+		}
+
+		InterleavedArray& operator=(InterleavedArray&& rhs)
+		{
+			std::swap(mData, rhs.mData);
+			std::swap(mSize, rhs.mSize);
+			std::swap(mAllocated, rhs.mAllocated);
+			std::swap(mRows, rhs.mRows);
+			std::swap(mCols, rhs.mCols);
+			std::swap(mStride, rhs.mStride);
+			std::swap(mStatistics, rhs.mStatistics);
+			std::swap(mAllocPolicy, rhs.mAllocPolicy);
+
+			return *this;
 		}
 		
 	public:
@@ -132,11 +265,194 @@ namespace Vcl { namespace Core
 			return mSize;
 		}
 
+		//! Number of entries the storage was allocated for, including padding
+		size_t allocated() const
+		{
+			return mAllocated;
+		}
+
+		//! Number of entries being interleaved (0, n or DynamicStride)
+		int stride() const
+		{
+			return static_cast<int>(mStride);
+		}
+
+		//! Record the memory allocated by the array under \a tag (see AllocationTracker)
+		void trackAllocations(const std::string& tag)
+		{
+			Require(!mStatistics, "Allocations are not tracked yet.");
+
+			mStatistics = &AllocationTracker::instance().statistics(tag);
+			if (mData)
+				mStatistics->recordAllocation(allocatedBytes());
+		}
+
+		/*!
+		 *	\brief Move the storage to memory provided by \a policy
+		 *
+		 *	The entries are copied to the new storage, subsequent growth uses
+		 *	the same policy. The policy has to return memory aligned to 64 bytes.
+		 */
+		template<typename AllocPolicyT>
+		void setAllocator(const AllocPolicyT& policy)
+		{
+			auto alloc_policy = makePolymorphicAllocPolicy<SCALAR>(policy);
+
+			SCALAR* data = alloc_policy->allocate(mAllocated*mRows*mCols);
+			Check(reinterpret_cast<size_t>(data) % Alignment == 0, "Storage is aligned.");
+			copyEntries(data, mAllocated, mData, mAllocated, mSize);
+
+			release();
+			mData = data;
+			mAllocPolicy = std::move(alloc_policy);
+			if (mStatistics)
+				mStatistics->recordAllocation(allocatedBytes());
+		}
+
 		void setZero()
 		{
 			memset(mData, 0, mAllocated*mRows*mCols*sizeof(SCALAR));
 		}
 
+		/*!
+		 *	\brief Zero the storage from the threads processing it
+		 *
+		 *	The entries are distributed with a static OpenMP schedule. Loops over
+		 *	the entries with the same schedule find their pages on the local NUMA
+		 *	node when the storage was not touched before (see PageAllocPolicy).
+		 */
+		void firstTouch()
+		{
+			const size_t group = groupSize();
+			const size_t nr_components = mRows*mCols;
+			const ptrdiff_t nr_entries = static_cast<ptrdiff_t>(mAllocated);
+			SCALAR* data = mData;
+
+#ifdef _OPENMP
+#	pragma omp parallel for schedule(static)
+#endif // _OPENMP
+			for (ptrdiff_t i = 0; i < nr_entries; i++)
+			{
+				SCALAR* base = data + (i / group)*group*nr_components + i % group;
+				for (size_t k = 0; k < nr_components; k++)
+					base[k*group] = SCALAR(0);
+			}
+		}
+
+	public:
+		/*!
+		 *	\brief Ensure that the storage can hold at least \a capacity entries
+		 *
+		 *	The allocation keeps the padding to the stride and the vector alignment.
+		 *	Existing entries are preserved.
+		 */
+		void reserve(size_t capacity)
+		{
+			if (capacity > mAllocated)
+				reallocate(paddedSize(capacity));
+		}
+
+		/*!
+		 *	\brief Change the number of entries
+		 *
+		 *	The storage grows geometrically, such that repeated calls are
+		 *	amortised. Added entries are not initialised.
+		 */
+		void resize(size_t size)
+		{
+			if (size > mAllocated)
+				reserve(std::max(size, mAllocated + mAllocated / 2));
+
+			mSize = size;
+		}
+
+		//! Remove all entries without releasing the storage
+		void clear()
+		{
+			mSize = 0;
+		}
+
+		//! Append an entry to the end of the array
+		template<typename Derived>
+		void push_back(const Eigen::MatrixBase<Derived>& value)
+		{
+			// Copy the value in case it references an entry of this array
+			const Eigen::Matrix<SCALAR, ROWS, COLS> entry = value;
+
+			resize(mSize + 1);
+			at<SCALAR>(mSize - 1) = entry;
+		}
+
+		/*!
+		 *	\brief Replace the content with the entries of \a values
+		 *
+		 *	The entries are transposed to the strided layout using SIMD
+		 *	instructions where supported.
+		 */
+		template<typename Allocator>
+		void assign(const std::vector<Eigen::Matrix<SCALAR, ROWS, COLS>, Allocator>& values)
+		{
+			static_assert(ROWS > 0 && COLS > 0, "Entries have a fixed size.");
+			static_assert(sizeof(Eigen::Matrix<SCALAR, ROWS, COLS>) == ROWS*COLS*sizeof(SCALAR), "Entries are tightly packed.");
+
+			mSize = 0;
+			reserve(values.size());
+			mSize = values.size();
+			if (mSize == 0)
+				return;
+
+			const size_t nr_components = mRows*mCols;
+			const SCALAR* entries = reinterpret_cast<const SCALAR*>(values.data());
+			if (mStride == 0 || mStride == 1)
+			{
+				memcpy(mData, entries, mSize*nr_components*sizeof(SCALAR));
+				return;
+			}
+
+			const size_t group = groupSize();
+			const size_t done = Detail::transposeToPlanes(mData, group, entries, nr_components, mSize);
+			for (size_t i = done; i < mSize; i++)
+			{
+				SCALAR* base = mData + (i / group)*group*nr_components + i % group;
+				for (size_t k = 0; k < nr_components; k++)
+					base[k*group] = entries[i*nr_components + k];
+			}
+		}
+
+		/*!
+		 *	\brief Copy the entries to consecutive matrices
+		 *
+		 *	The entries are transposed from the strided layout using SIMD
+		 *	instructions where supported.
+		 */
+		template<typename Allocator>
+		void copyTo(std::vector<Eigen::Matrix<SCALAR, ROWS, COLS>, Allocator>& values) const
+		{
+			static_assert(ROWS > 0 && COLS > 0, "Entries have a fixed size.");
+			static_assert(sizeof(Eigen::Matrix<SCALAR, ROWS, COLS>) == ROWS*COLS*sizeof(SCALAR), "Entries are tightly packed.");
+
+			values.resize(mSize);
+			if (mSize == 0)
+				return;
+
+			const size_t nr_components = mRows*mCols;
+			SCALAR* entries = reinterpret_cast<SCALAR*>(values.data());
+			if (mStride == 0 || mStride == 1)
+			{
+				memcpy(entries, mData, mSize*nr_components*sizeof(SCALAR));
+				return;
+			}
+
+			const size_t group = groupSize();
+			const size_t done = Detail::transposeFromPlanes(entries, nr_components, mData, group, mSize);
+			for (size_t i = done; i < mSize; i++)
+			{
+				const SCALAR* base = mData + (i / group)*group*nr_components + i % group;
+				for (size_t k = 0; k < nr_components; k++)
+					entries[i*nr_components + k] = base[k*group];
+			}
+		}
+
 	public:
 		template<typename SCALAR_OUT>
 		Eigen::Map
@@ -230,6 +546,110 @@ namespace Vcl { namespace Core
 			return const_cast<InterleavedArray*>(this)->at<SCALAR_OUT>(idx);
 		}
 		
+	private:
+		//! Alignment of the storage. Aligned to the widest vector type, as kernels
+		//! selected at runtime may use AVX-512 independent of the configured instruction set.
+		static const size_t Alignment = 64;
+
+		/*!
+		 *	Pad the requested size to the alignment
+		 *	Note: This is done in order to support optimaly sized vector operations
+		 */
+		size_t paddedSize(size_t size) const
+		{
+			size_t padded = size;
+			if (padded % Alignment > 0)
+				padded += Alignment - padded % Alignment;
+
+			// Add enough memory to compensate the stride size, such that the
+			// last group of entries is complete
+			if (mStride != size_t(DynamicStride) && mStride > 1)
+			{
+				while (padded % mStride > 0)
+					padded += Alignment;
+			}
+
+			return padded;
+		}
+
+		//! Number of entries sharing the component planes
+		size_t groupSize() const
+		{
+			if (mStride == size_t(DynamicStride))
+				return mAllocated;
+			else if (mStride == 0)
+				return 1;
+			else
+				return mStride;
+		}
+
+		size_t allocatedBytes() const
+		{
+			return mAllocated*mRows*mCols*sizeof(SCALAR);
+		}
+
+		//! Copy the first \a count entries between storages with the layout of this array
+		void copyEntries(SCALAR* dst, size_t dst_allocated, const SCALAR* src, size_t src_allocated, size_t count) const
+		{
+			if (count == 0)
+				return;
+
+			const size_t nr_components = mRows*mCols;
+			if (mStride == size_t(DynamicStride))
+			{
+				// Each component plane is padded to the allocated size
+				for (size_t k = 0; k < nr_components; k++)
+					memcpy(dst + k*dst_allocated, src + k*src_allocated, count*sizeof(SCALAR));
+			}
+			else
+			{
+				// Groups are independent of the allocated size
+				const size_t group = std::max<size_t>(mStride, 1);
+				const size_t nr_groups = (count + group - 1) / group;
+				memcpy(dst, src, nr_groups*group*nr_components*sizeof(SCALAR));
+			}
+		}
+
+		void reallocate(size_t allocated)
+		{
+			Require(allocated >= mSize, "Entries fit into the new storage.");
+			Require(allocated % Alignment == 0, "Storage is padded.");
+
+			SCALAR* data = allocateStorage(allocated);
+			copyEntries(data, allocated, mData, mAllocated, mSize);
+
+			release();
+			mData = data;
+			mAllocated = allocated;
+			if (mStatistics)
+				mStatistics->recordAllocation(allocatedBytes());
+		}
+
+		SCALAR* allocateStorage(size_t allocated)
+		{
+			if (!mAllocPolicy)
+				return (SCALAR*) _mm_malloc(allocated*mRows*mCols*sizeof(SCALAR), Alignment);
+
+			SCALAR* data = mAllocPolicy->allocate(allocated*mRows*mCols);
+			Check(reinterpret_cast<size_t>(data) % Alignment == 0, "Storage is aligned.");
+			return data;
+		}
+
+		void release()
+		{
+			if (mData)
+			{
+				if (mStatistics)
+					mStatistics->recordDeallocation(allocatedBytes());
+
+				if (mAllocPolicy)
+					mAllocPolicy->deallocate(mData, mAllocated*mRows*mCols);
+				else
+					_mm_free(mData);
+				mData = nullptr;
+			}
+		}
+
 	private:
 		SCALAR* mData;
 		size_t mSize;
@@ -237,5 +657,11 @@ namespace Vcl { namespace Core
 		size_t mRows;
 		size_t mCols;
 		size_t mStride;
+
+		//! Statistics recording the allocations, if tracked
+		AllocationStatistics* mStatistics{ nullptr };
+
+		//! Policy providing the storage, _mm_malloc if not set
+		std::unique_ptr<PolymorphicAllocPolicy<SCALAR>> mAllocPolicy;
 	};
 }}
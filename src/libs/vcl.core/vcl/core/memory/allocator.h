@@ -33,6 +33,7 @@
 #endif
 #include <stddef.h>    // Required for size_t and ptrdiff_t and NULL
 #include <limits>      // Required for numeric_limits
+#include <memory>      // Required for unique_ptr
 #include <new>         // Required for placement new and std::bad_alloc
 #include <stdexcept>   // Required for std::length_error
 
@@ -235,6 +236,7 @@ namespace Vcl { namespace Core
 		inline explicit Allocator() {}
 		inline ~Allocator() {}
 		inline Allocator(Allocator const& rhs) : Policy(rhs), Traits(rhs) {}
+		inline explicit Allocator(Policy const& policy) : Policy(policy) {}
 		template <typename U, typename P, typename T2>
 		inline Allocator(Allocator<U, P, T2> const& rhs) : Traits(rhs), Policy(rhs) {}
 	};
@@ -273,4 +275,68 @@ namespace Vcl { namespace Core
 	{
 		return !operator==(lhs, rhs);
 	}
+
+	/*!
+	 *	\brief Allocation policy interface selected at runtime
+	 *
+	 *	Allows containers to exchange the policy used to manage their memory
+	 *	without changing their type.
+	 */
+	template<typename T>
+	class PolymorphicAllocPolicy
+	{
+	public: // Typedefs
+		typedef T value_type;
+		typedef value_type* pointer;
+		typedef std::size_t size_type;
+
+	public:
+		virtual ~PolymorphicAllocPolicy() = default;
+
+	public:
+		virtual pointer allocate(size_type cnt) = 0;
+		virtual void deallocate(pointer p, size_type cnt) = 0;
+
+		//! Create a copy sharing the underlying memory resource
+		virtual std::unique_ptr<PolymorphicAllocPolicy<T>> clone() const = 0;
+	};
+
+	//! Implementation of PolymorphicAllocPolicy forwarding to a static policy
+	template<typename Policy>
+	class PolymorphicAllocPolicyAdapter : public PolymorphicAllocPolicy<typename Policy::value_type>
+	{
+	public:
+		typedef typename Policy::value_type value_type;
+		typedef typename Policy::pointer pointer;
+		typedef typename Policy::size_type size_type;
+
+	public:
+		explicit PolymorphicAllocPolicyAdapter(Policy const& policy) : _policy(policy) {}
+
+	public:
+		pointer allocate(size_type cnt) override
+		{
+			return _policy.allocate(cnt);
+		}
+		void deallocate(pointer p, size_type cnt) override
+		{
+			_policy.deallocate(p, cnt);
+		}
+
+		std::unique_ptr<PolymorphicAllocPolicy<value_type>> clone() const override
+		{
+			return std::make_unique<PolymorphicAllocPolicyAdapter<Policy>>(_policy);
+		}
+
+	private:
+		Policy _policy;
+	};
+
+	//! Wrap \a policy, rebound to \a T, into a PolymorphicAllocPolicy
+	template<typename T, typename Policy>
+	std::unique_ptr<PolymorphicAllocPolicy<T>> makePolymorphicAllocPolicy(Policy const& policy)
+	{
+		using ReboundPolicy = typename Policy::template rebind<T>::other;
+		return std::make_unique<PolymorphicAllocPolicyAdapter<ReboundPolicy>>(ReboundPolicy(policy));
+	}
 }}
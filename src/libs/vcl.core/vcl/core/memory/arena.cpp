@@ -0,0 +1,113 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/arena.h>
+
+// C++ standard library
+#ifndef VCL_COMPILER_MSVC
+#include <mm_malloc.h> // Required for _mm_malloc
+#endif
+#include <new>
+
+namespace Vcl { namespace Core
+{
+	MemoryArena::MemoryArena(size_t block_size)
+	: _blockSize(block_size)
+	{
+		Require(block_size > 0, "Block size is valid.");
+	}
+
+	MemoryArena::~MemoryArena()
+	{
+		release();
+	}
+
+	void* MemoryArena::allocate(size_t bytes, size_t alignment)
+	{
+		Require(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment is a power of two.");
+
+		// Search the retained blocks for enough space
+		for (; _currentBlock < _blocks.size(); _currentBlock++, _offset = 0)
+		{
+			const Block& block = _blocks[_currentBlock];
+			const size_t base = reinterpret_cast<size_t>(block.data);
+			const size_t offset = ((base + _offset + alignment - 1) & ~(alignment - 1)) - base;
+			if (offset + bytes <= block.size)
+			{
+				_offset = offset + bytes;
+				return block.data + offset;
+			}
+		}
+
+		// Allocate a new block large enough for the request
+		const size_t padding = alignment > BlockAlignment ? alignment : 0;
+		const size_t size = std::max(_blockSize, bytes + padding);
+		char* data = static_cast<char*>(_mm_malloc(size, BlockAlignment));
+		if (!data)
+			throw std::bad_alloc{};
+
+		_blocks.push_back({ data, size });
+		_currentBlock = _blocks.size() - 1;
+
+		const size_t base = reinterpret_cast<size_t>(data);
+		const size_t offset = ((base + alignment - 1) & ~(alignment - 1)) - base;
+		_offset = offset + bytes;
+
+		Ensure(_offset <= size, "Allocation fits into the block.");
+		return data + offset;
+	}
+
+	void MemoryArena::reset()
+	{
+		_currentBlock = 0;
+		_offset = 0;
+	}
+
+	void MemoryArena::release()
+	{
+		for (auto& block : _blocks)
+			_mm_free(block.data);
+
+		_blocks.clear();
+		reset();
+	}
+
+	size_t MemoryArena::used() const
+	{
+		size_t bytes = 0;
+		for (size_t b = 0; b < _currentBlock && b < _blocks.size(); b++)
+			bytes += _blocks[b].size;
+
+		return bytes + _offset;
+	}
+
+	size_t MemoryArena::capacity() const
+	{
+		size_t bytes = 0;
+		for (const auto& block : _blocks)
+			bytes += block.size;
+
+		return bytes;
+	}
+}}
@@ -0,0 +1,177 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core
+{
+	/*!
+	 *	\brief Monotonic memory arena
+	 *
+	 *	Memory is handed out by advancing a pointer through a list of large
+	 *	blocks. Individual allocations are never released; instead the entire
+	 *	arena is reset at once, which keeps the blocks for reuse. The arena is
+	 *	not thread-safe.
+	 */
+	class MemoryArena
+	{
+	public:
+		//! Alignment of the memory blocks
+		static const size_t BlockAlignment = 64;
+
+	public:
+		explicit MemoryArena(size_t block_size = 1 << 20);
+		MemoryArena(const MemoryArena&) = delete;
+		~MemoryArena();
+
+		MemoryArena& operator=(const MemoryArena&) = delete;
+
+	public:
+		/*!
+		 *	\brief Allocate memory from the arena
+		 *	\param bytes Number of bytes to allocate
+		 *	\param alignment Alignment of the returned memory, must be a power of two
+		 *	\returns a pointer to the allocated memory
+		 */
+		void* allocate(size_t bytes, size_t alignment);
+
+		//! Make the entire memory available again without releasing the blocks
+		void reset();
+
+		//! Release all the memory blocks
+		void release();
+
+	public:
+		//! Number of bytes handed out since the last reset, including alignment padding
+		size_t used() const;
+
+		//! Number of bytes allocated from the system
+		size_t capacity() const;
+
+	private:
+		struct Block
+		{
+			char* data;
+			size_t size;
+		};
+
+		//! Size of newly allocated memory blocks
+		size_t _blockSize;
+
+		//! Allocated memory blocks
+		std::vector<Block> _blocks;
+
+		//! Block currently used for allocation
+		size_t _currentBlock{ 0 };
+
+		//! Offset of the next allocation in the current block
+		size_t _offset{ 0 };
+	};
+
+	/*!
+	 *	\brief Allocation policy drawing memory from a MemoryArena
+	 *
+	 *	Deallocation is a no-op, memory is reclaimed when the arena is reset.
+	 *	All copies and rebound versions of the policy share the same arena.
+	 */
+	template<typename T, int Alignment = 16>
+	class ArenaAllocPolicy
+	{
+	public: // Typedefs
+		typedef T value_type;
+		typedef value_type* pointer;
+		typedef const value_type* const_pointer;
+		typedef value_type& reference;
+		typedef const value_type& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+	public: // Convert an ArenaAllocPolicy<T> to ArenaAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			typedef ArenaAllocPolicy<U, Alignment> other;
+		};
+
+	public:
+		inline explicit ArenaAllocPolicy(MemoryArena* arena = nullptr) : _arena(arena) {}
+		inline ~ArenaAllocPolicy() {}
+		inline explicit ArenaAllocPolicy(ArenaAllocPolicy const& rhs) : _arena(rhs._arena) {}
+		template <typename U, int AlignmentRhs>
+		inline explicit ArenaAllocPolicy(ArenaAllocPolicy<U, AlignmentRhs> const& rhs) : _arena(rhs.arena()) {}
+
+	public: // Memory allocation
+		inline pointer allocate(size_type cnt, typename std::allocator<void>::const_pointer = 0)
+		{
+			Require(_arena, "Arena is set.");
+
+			const size_t alignment = std::max<size_t>(Alignment, alignof(T));
+			return reinterpret_cast<pointer>(_arena->allocate(cnt * sizeof(T), alignment));
+		}
+		inline void deallocate(pointer, size_type)
+		{
+		}
+
+	public: // Size
+		inline size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max();
+		}
+
+	public:
+		inline MemoryArena* arena() const { return _arena; }
+
+	private:
+		//! Arena providing the memory
+		MemoryArena* _arena;
+	};
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, int Alignment, typename T2, int Alignment2>
+	inline bool operator==(ArenaAllocPolicy<T, Alignment> const& lhs, ArenaAllocPolicy<T2, Alignment2> const& rhs)
+	{
+		return lhs.arena() == rhs.arena();
+	}
+
+	template<typename T, int Alignment, typename OtherAllocator>
+	inline bool operator==(ArenaAllocPolicy<T, Alignment> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+}}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/frameallocator.h>
+
+// C++ standard library
+#ifndef VCL_COMPILER_MSVC
+#include <mm_malloc.h> // Required for _mm_malloc
+#endif
+#include <new>
+
+namespace Vcl { namespace Core
+{
+	FrameAllocator::FrameAllocator(size_t capacity)
+	: _memory(nullptr)
+	, _capacity(capacity)
+	{
+		_memory = static_cast<char*>(_mm_malloc(std::max<size_t>(capacity, 1), BufferAlignment));
+		if (!_memory)
+			throw std::bad_alloc{};
+	}
+
+	FrameAllocator::~FrameAllocator()
+	{
+		_mm_free(_memory);
+	}
+
+	void* FrameAllocator::allocate(size_t bytes, size_t alignment)
+	{
+		Require(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment is a power of two.");
+
+		const size_t base = reinterpret_cast<size_t>(_memory);
+		const size_t offset = ((base + _top + alignment - 1) & ~(alignment - 1)) - base;
+		if (offset + bytes > _capacity)
+			throw std::bad_alloc{};
+
+		_top = offset + bytes;
+		return _memory + offset;
+	}
+
+	void FrameAllocator::deallocate(void* p, size_t bytes)
+	{
+		// Only the top-most allocation can be returned, the alignment
+		// padding in front of it is kept until the stack is rewound.
+		if (p && static_cast<char*>(p) + bytes == _memory + _top)
+			_top = static_cast<size_t>(static_cast<char*>(p) - _memory);
+	}
+}}
@@ -0,0 +1,202 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core
+{
+	/*!
+	 *	\brief Stack allocator for temporary memory
+	 *
+	 *	Memory is allocated in LIFO order from a fixed-size buffer. Releasing
+	 *	the most recent allocation returns its memory immediately, all other
+	 *	memory is reclaimed by rewinding the stack to a previously recorded
+	 *	marker (see FrameAllocator::Scope) or by resetting it at the end of a
+	 *	frame. The allocator is not thread-safe.
+	 */
+	class FrameAllocator
+	{
+	public:
+		//! Position in the stack
+		using Marker = size_t;
+
+		//! Rewinds the stack to its state at construction when leaving the scope
+		class Scope
+		{
+		public:
+			explicit Scope(FrameAllocator& allocator)
+			: _allocator(allocator)
+			, _marker(allocator.mark())
+			{
+			}
+			Scope(const Scope&) = delete;
+			~Scope()
+			{
+				_allocator.rewind(_marker);
+			}
+
+			Scope& operator=(const Scope&) = delete;
+
+		private:
+			FrameAllocator& _allocator;
+			Marker _marker;
+		};
+
+	public:
+		//! Alignment of the stack memory
+		static const size_t BufferAlignment = 64;
+
+	public:
+		explicit FrameAllocator(size_t capacity);
+		FrameAllocator(const FrameAllocator&) = delete;
+		~FrameAllocator();
+
+		FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+	public:
+		/*!
+		 *	\brief Allocate memory from the top of the stack
+		 *	\param bytes Number of bytes to allocate
+		 *	\param alignment Alignment of the returned memory, must be a power of two
+		 *	\returns a pointer to the allocated memory
+		 *	\throws std::bad_alloc if the remaining space is insufficient
+		 */
+		void* allocate(size_t bytes, size_t alignment);
+
+		//! Release memory, takes only effect on the most recent allocation
+		void deallocate(void* p, size_t bytes);
+
+		//! \returns the current top of the stack
+		Marker mark() const { return _top; }
+
+		//! Release all the memory allocated after \a marker was taken
+		void rewind(Marker marker)
+		{
+			Require(marker <= _top, "Marker is below the top of the stack.");
+			_top = marker;
+		}
+
+		//! Release all the memory
+		void reset() { _top = 0; }
+
+	public:
+		size_t used() const { return _top; }
+		size_t capacity() const { return _capacity; }
+
+	private:
+		//! Memory of the stack
+		char* _memory;
+
+		//! Size of the memory
+		size_t _capacity;
+
+		//! Offset of the first free byte
+		size_t _top{ 0 };
+	};
+
+	/*!
+	 *	\brief Allocation policy drawing memory from a FrameAllocator
+	 *
+	 *	All copies and rebound versions of the policy share the same stack.
+	 */
+	template<typename T, int Alignment = 16>
+	class FrameAllocPolicy
+	{
+	public: // Typedefs
+		typedef T value_type;
+		typedef value_type* pointer;
+		typedef const value_type* const_pointer;
+		typedef value_type& reference;
+		typedef const value_type& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+	public: // Convert an FrameAllocPolicy<T> to FrameAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			typedef FrameAllocPolicy<U, Alignment> other;
+		};
+
+	public:
+		inline explicit FrameAllocPolicy(FrameAllocator* stack = nullptr) : _stack(stack) {}
+		inline ~FrameAllocPolicy() {}
+		inline explicit FrameAllocPolicy(FrameAllocPolicy const& rhs) : _stack(rhs._stack) {}
+		template <typename U, int AlignmentRhs>
+		inline explicit FrameAllocPolicy(FrameAllocPolicy<U, AlignmentRhs> const& rhs) : _stack(rhs.stack()) {}
+
+	public: // Memory allocation
+		inline pointer allocate(size_type cnt, typename std::allocator<void>::const_pointer = 0)
+		{
+			Require(_stack, "Stack is set.");
+
+			const size_t alignment = std::max<size_t>(Alignment, alignof(T));
+			return reinterpret_cast<pointer>(_stack->allocate(cnt * sizeof(T), alignment));
+		}
+		inline void deallocate(pointer p, size_type cnt)
+		{
+			_stack->deallocate(p, cnt * sizeof(T));
+		}
+
+	public: // Size
+		inline size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max();
+		}
+
+	public:
+		inline FrameAllocator* stack() const { return _stack; }
+
+	private:
+		//! Stack providing the memory
+		FrameAllocator* _stack;
+	};
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, int Alignment, typename T2, int Alignment2>
+	inline bool operator==(FrameAllocPolicy<T, Alignment> const& lhs, FrameAllocPolicy<T2, Alignment2> const& rhs)
+	{
+		return lhs.stack() == rhs.stack();
+	}
+
+	template<typename T, int Alignment, typename OtherAllocator>
+	inline bool operator==(FrameAllocPolicy<T, Alignment> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+}}
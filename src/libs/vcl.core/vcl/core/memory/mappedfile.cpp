@@ -0,0 +1,106 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/mappedfile.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+#ifdef VCL_ABI_WINAPI
+#	include <windows.h>
+#elif defined(VCL_ABI_POSIX)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif // VCL_ABI_WINAPI
+VCL_END_EXTERNAL_HEADERS
+
+namespace Vcl { namespace Core
+{
+	std::shared_ptr<MappedFile> MappedFile::open(const std::string& path)
+	{
+#if defined VCL_ABI_WINAPI
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return nullptr;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		// The view keeps a reference to the mapping object
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping)
+			return nullptr;
+
+		void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+		CloseHandle(mapping);
+		if (!data)
+			return nullptr;
+
+		return std::shared_ptr<MappedFile>(new MappedFile(static_cast<char*>(data), static_cast<size_t>(size.QuadPart)));
+#elif defined VCL_ABI_POSIX
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return nullptr;
+
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size == 0)
+		{
+			close(fd);
+			return nullptr;
+		}
+
+		// The mapping stays valid after closing the descriptor
+		const size_t size = static_cast<size_t>(info.st_size);
+		void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (data == MAP_FAILED)
+			return nullptr;
+
+		return std::shared_ptr<MappedFile>(new MappedFile(static_cast<char*>(data), size));
+#else
+		VCL_UNREFERENCED_PARAMETER(path);
+		return nullptr;
+#endif
+	}
+
+	MappedFile::MappedFile(char* data, size_t size)
+	: _data(data)
+	, _size(size)
+	{
+	}
+
+	MappedFile::~MappedFile()
+	{
+#if defined VCL_ABI_WINAPI
+		UnmapViewOfFile(_data);
+#elif defined VCL_ABI_POSIX
+		munmap(_data, _size);
+#endif
+	}
+}}
@@ -0,0 +1,163 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#ifndef VCL_COMPILER_MSVC
+#include <mm_malloc.h>
+#endif
+#include <limits>
+#include <memory>
+#include <string>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core
+{
+	/*!
+	 *	\brief Private, copy-on-write mapping of a file
+	 *
+	 *	The content of the file is loaded on demand by the operating system.
+	 *	Writes to the mapped memory are visible only to this process and are
+	 *	never written back to the file.
+	 */
+	class MappedFile
+	{
+	public:
+		/*!
+		 *	\brief Map a file into memory
+		 *	\param path Path to the file
+		 *	\returns the mapped file or nullptr if the file cannot be mapped
+		 */
+		static std::shared_ptr<MappedFile> open(const std::string& path);
+
+	public:
+		MappedFile(const MappedFile&) = delete;
+		~MappedFile();
+
+		MappedFile& operator=(const MappedFile&) = delete;
+
+	public:
+		//! Begin of the mapping. The mapping is page aligned.
+		char* data() const { return _data; }
+
+		//! Size of the file in bytes
+		size_t size() const { return _size; }
+
+		//! Check if \a p points into the mapping
+		bool owns(const void* p) const
+		{
+			return static_cast<const char*>(p) >= _data && static_cast<const char*>(p) < _data + _size;
+		}
+
+	private:
+		MappedFile(char* data, size_t size);
+
+	private:
+		//! Begin of the mapping
+		char* _data;
+
+		//! Size of the mapping
+		size_t _size;
+	};
+
+	/*!
+	 *	\brief Allocation policy for containers adopting memory of a mapped file
+	 *
+	 *	Memory inside the mapping is released together with the file, new
+	 *	allocations are served from the heap. Containers growing beyond the
+	 *	mapped region thus move their content to regular memory.
+	 */
+	template<typename T, int Alignment = 32>
+	class MappedFileAllocPolicy
+	{
+	public: // Typedefs
+		typedef T value_type;
+		typedef value_type* pointer;
+		typedef const value_type* const_pointer;
+		typedef value_type& reference;
+		typedef const value_type& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+	public: // Convert an MappedFileAllocPolicy<T> to MappedFileAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			typedef MappedFileAllocPolicy<U, Alignment> other;
+		};
+
+	public:
+		inline explicit MappedFileAllocPolicy(std::shared_ptr<const MappedFile> file) : _file(std::move(file)) {}
+		inline ~MappedFileAllocPolicy() {}
+		inline explicit MappedFileAllocPolicy(MappedFileAllocPolicy const& rhs) : _file(rhs._file) {}
+		template <typename U>
+		inline explicit MappedFileAllocPolicy(MappedFileAllocPolicy<U, Alignment> const& rhs) : _file(rhs.file()) {}
+
+	public: // Memory allocation
+		inline pointer allocate(size_type cnt, typename std::allocator<void>::const_pointer = 0)
+		{
+			return reinterpret_cast<pointer>(_mm_malloc(cnt * sizeof(T), Alignment));
+		}
+		inline void deallocate(pointer p, size_type)
+		{
+			if (p && !(_file && _file->owns(p)))
+				_mm_free(p);
+		}
+
+	public: // Size
+		inline size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max();
+		}
+
+	public:
+		inline const std::shared_ptr<const MappedFile>& file() const { return _file; }
+
+	private:
+		//! File providing the adopted memory
+		std::shared_ptr<const MappedFile> _file;
+	};
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, typename T2, int Alignment>
+	inline bool operator==(MappedFileAllocPolicy<T, Alignment> const& lhs, MappedFileAllocPolicy<T2, Alignment> const& rhs)
+	{
+		return lhs.file() == rhs.file();
+	}
+
+	template<typename T, int Alignment, typename OtherAllocator>
+	inline bool operator==(MappedFileAllocPolicy<T, Alignment> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+}}
@@ -0,0 +1,251 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/pages.h>
+
+// C++ standard library
+#include <fstream>
+#include <string>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+#ifdef VCL_ABI_WINAPI
+#	include <windows.h>
+#elif defined(VCL_ABI_POSIX)
+#	include <sys/mman.h>
+#	include <unistd.h>
+#	ifdef __linux__
+#		include <sys/syscall.h>
+#	endif // __linux__
+#else
+#	include <mm_malloc.h>
+#endif // VCL_ABI_WINAPI
+VCL_END_EXTERNAL_HEADERS
+
+namespace Vcl { namespace Core
+{
+	namespace
+	{
+		size_t pageSize()
+		{
+#if defined VCL_ABI_WINAPI
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			return info.dwPageSize;
+#elif defined VCL_ABI_POSIX
+			return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+			return 4096;
+#endif
+		}
+
+		size_t roundUp(size_t bytes, size_t granularity)
+		{
+			return (bytes + granularity - 1) / granularity * granularity;
+		}
+
+		//! Size of the mapping backing an allocation of \a bytes
+		size_t mappedSize(size_t bytes, const PageOptions& options)
+		{
+			const size_t granularity = options.pageSize == PageSize::Default ? pageSize() : hugePageSize();
+			return roundUp(std::max<size_t>(bytes, 1), granularity);
+		}
+
+#if defined VCL_ABI_POSIX && defined __linux__
+		//! Mask of the online NUMA nodes
+		uint64_t onlineNodes()
+		{
+			// The file lists ranges of nodes, e.g. "0-1,4"
+			std::ifstream file{ "/sys/devices/system/node/online" };
+			std::string ranges;
+			if (!(file >> ranges))
+				return 1;
+
+			uint64_t mask = 0;
+			size_t pos = 0;
+			while (pos < ranges.size())
+			{
+				size_t end = ranges.find(',', pos);
+				if (end == std::string::npos)
+					end = ranges.size();
+
+				const std::string range = ranges.substr(pos, end - pos);
+				const size_t dash = range.find('-');
+				const unsigned long first = std::stoul(range.substr(0, dash));
+				const unsigned long last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+				for (unsigned long n = first; n <= last && n < 64; n++)
+					mask |= uint64_t(1) << n;
+
+				pos = end + 1;
+			}
+
+			return mask != 0 ? mask : 1;
+		}
+
+		//! Apply the NUMA placement to a mapping. Failures are ignored, as
+		//! the placement only affects performance.
+		void applyPlacement(void* p, size_t size, const PageOptions& options)
+		{
+			// Modes defined in linux/mempolicy.h
+			const int MPolBind = 2;
+			const int MPolInterleave = 3;
+
+			if (options.placement == NumaPlacement::Default)
+				return;
+
+			const int mode = options.placement == NumaPlacement::Bind ? MPolBind : MPolInterleave;
+			const unsigned long mask = static_cast<unsigned long>(options.nodeMask != 0 ? options.nodeMask : onlineNodes());
+			syscall(SYS_mbind, p, size, mode, &mask, 8 * sizeof(mask) + 1, 0);
+		}
+#endif // VCL_ABI_POSIX && __linux__
+	}
+
+	size_t hugePageSize()
+	{
+		static const size_t size = []() -> size_t
+		{
+#if defined VCL_ABI_WINAPI
+			const size_t large_page = GetLargePageMinimum();
+			return large_page > 0 ? large_page : 2 * 1024 * 1024;
+#else
+			// Read the default huge page size, e.g. "Hugepagesize:    2048 kB"
+			std::ifstream meminfo{ "/proc/meminfo" };
+			std::string key;
+			while (meminfo >> key)
+			{
+				if (key == "Hugepagesize:")
+				{
+					size_t kb = 0;
+					if (meminfo >> kb && kb > 0)
+						return kb * 1024;
+				}
+			}
+
+			return 2 * 1024 * 1024;
+#endif
+		}();
+
+		return size;
+	}
+
+	void* allocatePages(size_t bytes, const PageOptions& options)
+	{
+		const size_t size = mappedSize(bytes, options);
+
+#if defined VCL_ABI_WINAPI
+		void* p = nullptr;
+		if (options.pageSize == PageSize::Huge)
+			p = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+		if (!p && options.placement != NumaPlacement::Default && options.nodeMask != 0)
+		{
+			// Windows places the pages on a single preferred node
+			DWORD node = 0;
+			while (!(options.nodeMask & (uint64_t(1) << node)))
+				node++;
+			p = VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+		}
+		if (!p)
+			p = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+		if (!p)
+			throw std::bad_alloc{};
+
+		return p;
+#elif defined VCL_ABI_POSIX
+		void* p = MAP_FAILED;
+#	ifdef MAP_HUGETLB
+		if (options.pageSize == PageSize::Huge)
+			p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#	endif // MAP_HUGETLB
+
+		if (p == MAP_FAILED && options.pageSize == PageSize::Default)
+		{
+			p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+				throw std::bad_alloc{};
+		}
+		else if (p == MAP_FAILED)
+		{
+			// Transparent huge pages are only used for aligned regions. Map
+			// additional space and trim it to a huge page boundary.
+			const size_t huge_page = hugePageSize();
+			void* mapped = mmap(nullptr, size + huge_page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (mapped == MAP_FAILED)
+				throw std::bad_alloc{};
+
+			char* begin = static_cast<char*>(mapped);
+			char* aligned = reinterpret_cast<char*>(roundUp(reinterpret_cast<size_t>(begin), huge_page));
+			if (aligned > begin)
+				munmap(begin, aligned - begin);
+			if (aligned + size < begin + size + huge_page)
+				munmap(aligned + size, begin + huge_page - aligned);
+
+			p = aligned;
+#	ifdef MADV_HUGEPAGE
+			madvise(p, size, MADV_HUGEPAGE);
+#	endif // MADV_HUGEPAGE
+		}
+
+#	ifdef __linux__
+		applyPlacement(p, size, options);
+#	endif // __linux__
+
+		return p;
+#else
+		void* p = _mm_malloc(size, pageSize());
+		if (!p)
+			throw std::bad_alloc{};
+
+		return p;
+#endif
+	}
+
+	void releasePages(void* p, size_t bytes, const PageOptions& options)
+	{
+		if (!p)
+			return;
+
+#if defined VCL_ABI_WINAPI
+		VCL_UNREFERENCED_PARAMETER(bytes);
+		VCL_UNREFERENCED_PARAMETER(options);
+		VirtualFree(p, 0, MEM_RELEASE);
+#elif defined VCL_ABI_POSIX
+		munmap(p, mappedSize(bytes, options));
+#else
+		VCL_UNREFERENCED_PARAMETER(bytes);
+		VCL_UNREFERENCED_PARAMETER(options);
+		_mm_free(p);
+#endif
+	}
+
+	void firstTouch(void* p, size_t count, size_t size)
+	{
+		char* data = static_cast<char*>(p);
+		const ptrdiff_t nr_objects = static_cast<ptrdiff_t>(count);
+
+#ifdef _OPENMP
+#	pragma omp parallel for schedule(static)
+#endif // _OPENMP
+		for (ptrdiff_t i = 0; i < nr_objects; i++)
+			memset(data + i*size, 0, size);
+	}
+}}
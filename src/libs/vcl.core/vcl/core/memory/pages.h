@@ -0,0 +1,187 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core
+{
+	//! Size of the pages backing an allocation
+	enum class PageSize
+	{
+		//! Regular pages of the operating system
+		Default,
+
+		//! Regular pages, marked to be merged to huge pages by the kernel
+		Transparent,
+
+		//! Huge pages reserved by the operating system. Falls back to
+		//! transparent huge pages if none are available.
+		Huge
+	};
+
+	//! Placement of the allocated pages on the NUMA nodes
+	enum class NumaPlacement
+	{
+		//! Placement policy of the calling thread, usually the node of the first touch
+		Default,
+
+		//! Restrict the pages to the selected nodes
+		Bind,
+
+		//! Distribute the pages round-robin across the selected nodes
+		Interleave
+	};
+
+	//! Configuration of page allocations
+	struct PageOptions
+	{
+		PageSize pageSize{ PageSize::Default };
+		NumaPlacement placement{ NumaPlacement::Default };
+
+		//! Nodes used for NumaPlacement::Bind and NumaPlacement::Interleave.
+		//! Bit i selects node i, zero selects all nodes.
+		uint64_t nodeMask{ 0 };
+
+		/*!
+		 *	Initialise new allocations from the threads later processing them.
+		 *	The memory is zeroed in a parallel loop with static scheduling
+		 *	over the allocated objects, such that each page is placed on the
+		 *	node of the thread processing the same range in a loop with the
+		 *	same schedule.
+		 */
+		bool firstTouch{ false };
+	};
+
+	//! Size of the huge pages provided by the operating system
+	size_t hugePageSize();
+
+	/*!
+	 *	\brief Allocate memory directly from the operating system
+	 *	\param bytes Number of bytes to allocate
+	 *	\param options Page size and NUMA placement of the memory
+	 *	\returns page aligned memory
+	 *	\throws std::bad_alloc if no memory could be allocated
+	 */
+	void* allocatePages(size_t bytes, const PageOptions& options);
+
+	//! Release memory allocated with allocatePages using the same size and options
+	void releasePages(void* p, size_t bytes, const PageOptions& options);
+
+	/*!
+	 *	\brief Zero memory from the threads processing it afterwards
+	 *
+	 *	The \a count objects of \a size bytes are distributed by a static OpenMP
+	 *	schedule. Without OpenMP the memory is touched by the calling thread.
+	 */
+	void firstTouch(void* p, size_t count, size_t size);
+
+	/*!
+	 *	\brief Allocation policy requesting memory from the operating system
+	 *
+	 *	Intended for large, long living buffers. Each allocation occupies at
+	 *	least a full page.
+	 */
+	template<typename T>
+	class PageAllocPolicy
+	{
+	public: // Typedefs
+		typedef T value_type;
+		typedef value_type* pointer;
+		typedef const value_type* const_pointer;
+		typedef value_type& reference;
+		typedef const value_type& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+	public: // Convert an PageAllocPolicy<T> to PageAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			typedef PageAllocPolicy<U> other;
+		};
+
+	public:
+		inline explicit PageAllocPolicy(const PageOptions& options = PageOptions()) : _options(options) {}
+		inline ~PageAllocPolicy() {}
+		inline explicit PageAllocPolicy(PageAllocPolicy const& rhs) : _options(rhs._options) {}
+		template <typename U>
+		inline explicit PageAllocPolicy(PageAllocPolicy<U> const& rhs) : _options(rhs.options()) {}
+
+	public: // Memory allocation
+		inline pointer allocate(size_type cnt, typename std::allocator<void>::const_pointer = 0)
+		{
+			void* p = allocatePages(cnt * sizeof(T), _options);
+			if (_options.firstTouch)
+				firstTouch(p, cnt, sizeof(T));
+
+			return reinterpret_cast<pointer>(p);
+		}
+		inline void deallocate(pointer p, size_type cnt)
+		{
+			if (p)
+				releasePages(p, cnt * sizeof(T), _options);
+		}
+
+	public: // Size
+		inline size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max();
+		}
+
+	public:
+		inline const PageOptions& options() const { return _options; }
+
+	private:
+		PageOptions _options;
+	};
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, typename T2>
+	inline bool operator==(PageAllocPolicy<T> const& lhs, PageAllocPolicy<T2> const& rhs)
+	{
+		return lhs.options().pageSize == rhs.options().pageSize;
+	}
+
+	template<typename T, typename OtherAllocator>
+	inline bool operator==(PageAllocPolicy<T> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+}}
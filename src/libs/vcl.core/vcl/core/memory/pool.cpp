@@ -0,0 +1,95 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/pool.h>
+
+namespace Vcl { namespace Core
+{
+	FixedSizePool::FixedSizePool(size_t block_size, size_t capacity, size_t alignment)
+	: _blockSize(block_size)
+	, _alignment(alignment)
+	, _capacity(capacity)
+	, _memory(nullptr)
+	, _head(EndOfList)
+	{
+		Require(block_size > 0, "Block size is valid.");
+		Require(capacity < EndOfList, "Blocks can be indexed.");
+		Require(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment is a power of two.");
+
+		_stride = (block_size + alignment - 1) & ~(alignment - 1);
+		if (capacity == 0)
+			return;
+
+		_memory = static_cast<char*>(_mm_malloc(_stride * capacity, alignment));
+		if (!_memory)
+			throw std::bad_alloc{};
+
+		// Chain all the blocks in the free list
+		_next = std::make_unique<std::atomic<uint32_t>[]>(capacity);
+		for (size_t i = 0; i < capacity; i++)
+			_next[i].store(i + 1 < capacity ? static_cast<uint32_t>(i + 1) : EndOfList, std::memory_order_relaxed);
+
+		_head.store(0, std::memory_order_release);
+	}
+
+	FixedSizePool::~FixedSizePool()
+	{
+		_mm_free(_memory);
+	}
+
+	void* FixedSizePool::allocate()
+	{
+		uint64_t head = _head.load(std::memory_order_acquire);
+		for (;;)
+		{
+			const uint32_t idx = static_cast<uint32_t>(head);
+			if (idx == EndOfList)
+				return nullptr;
+
+			// The successor may be outdated if another thread took the block
+			// in the meantime, which is detected by the changed counter.
+			const uint64_t next = _next[idx].load(std::memory_order_relaxed);
+			const uint64_t new_head = (((head >> 32) + 1) << 32) | next;
+			if (_head.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire))
+				return _memory + idx * _stride;
+		}
+	}
+
+	void FixedSizePool::deallocate(void* p)
+	{
+		Require(owns(p), "Block belongs to the pool.");
+
+		const size_t offset = static_cast<size_t>(static_cast<char*>(p) - _memory);
+		Require(offset % _stride == 0, "Pointer addresses the begin of a block.");
+
+		const uint32_t idx = static_cast<uint32_t>(offset / _stride);
+		uint64_t head = _head.load(std::memory_order_relaxed);
+		uint64_t new_head;
+		do
+		{
+			_next[idx].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+			new_head = (((head >> 32) + 1) << 32) | idx;
+		} while (!_head.compare_exchange_weak(head, new_head, std::memory_order_release, std::memory_order_relaxed));
+	}
+}}
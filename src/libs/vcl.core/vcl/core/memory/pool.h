@@ -0,0 +1,201 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#ifndef VCL_COMPILER_MSVC
+#include <mm_malloc.h> // Required for _mm_malloc
+#endif
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <new>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core
+{
+	/*!
+	 *	\brief Pool of equally sized memory blocks
+	 *
+	 *	The blocks are carved from a single allocation made upfront. Free
+	 *	blocks are kept in a lock-free stack, such that blocks can be
+	 *	allocated and released concurrently from any thread without locking.
+	 */
+	class FixedSizePool
+	{
+	public:
+		/*!
+		 *	\param block_size Size of an individual block in bytes
+		 *	\param capacity Number of blocks in the pool
+		 *	\param alignment Alignment of each block, must be a power of two
+		 */
+		FixedSizePool(size_t block_size, size_t capacity, size_t alignment = 64);
+		FixedSizePool(const FixedSizePool&) = delete;
+		~FixedSizePool();
+
+		FixedSizePool& operator=(const FixedSizePool&) = delete;
+
+	public:
+		//! \returns a free block or nullptr if the pool is exhausted
+		void* allocate();
+
+		//! Return a block allocated from this pool
+		void deallocate(void* p);
+
+		//! \returns true if \a p points to a block of this pool
+		bool owns(const void* p) const
+		{
+			const char* ptr = static_cast<const char*>(p);
+			return ptr >= _memory && ptr < _memory + _capacity * _stride;
+		}
+
+	public:
+		size_t blockSize() const { return _blockSize; }
+		size_t alignment() const { return _alignment; }
+		size_t capacity() const { return _capacity; }
+
+	private:
+		//! Index marking the end of the free list
+		static const uint32_t EndOfList = 0xffffffff;
+
+		//! Size of a single block
+		size_t _blockSize;
+
+		//! Alignment of the blocks
+		size_t _alignment;
+
+		//! Distance between two blocks
+		size_t _stride;
+
+		//! Number of blocks
+		size_t _capacity;
+
+		//! Memory of all the blocks
+		char* _memory;
+
+		//! Successor in the free list of each block
+		std::unique_ptr<std::atomic<uint32_t>[]> _next;
+
+		//! Head of the free list. The upper 32 bit store a counter
+		//! incremented on each change to prevent ABA problems.
+		std::atomic<uint64_t> _head;
+	};
+
+	/*!
+	 *	\brief Allocation policy drawing memory from a FixedSizePool
+	 *
+	 *	Requests which do not fit into a single block, or which cannot be
+	 *	served because the pool is exhausted, are forwarded to the aligned
+	 *	system allocator. All copies and rebound versions of the policy share
+	 *	the same pool.
+	 */
+	template<typename T>
+	class PoolAllocPolicy
+	{
+	public: // Typedefs
+		typedef T value_type;
+		typedef value_type* pointer;
+		typedef const value_type* const_pointer;
+		typedef value_type& reference;
+		typedef const value_type& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+	public: // Convert an PoolAllocPolicy<T> to PoolAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			typedef PoolAllocPolicy<U> other;
+		};
+
+	public:
+		inline explicit PoolAllocPolicy(FixedSizePool* pool = nullptr) : _pool(pool) {}
+		inline ~PoolAllocPolicy() {}
+		inline explicit PoolAllocPolicy(PoolAllocPolicy const& rhs) : _pool(rhs._pool) {}
+		template <typename U>
+		inline explicit PoolAllocPolicy(PoolAllocPolicy<U> const& rhs) : _pool(rhs.pool()) {}
+
+	public: // Memory allocation
+		inline pointer allocate(size_type cnt, typename std::allocator<void>::const_pointer = 0)
+		{
+			Require(_pool, "Pool is set.");
+
+			const size_t bytes = cnt * sizeof(T);
+			if (bytes <= _pool->blockSize() && alignof(T) <= _pool->alignment())
+			{
+				if (void* p = _pool->allocate())
+					return reinterpret_cast<pointer>(p);
+			}
+
+			void* p = _mm_malloc(bytes, std::max(_pool->alignment(), alignof(T)));
+			if (!p)
+				throw std::bad_alloc{};
+
+			return reinterpret_cast<pointer>(p);
+		}
+		inline void deallocate(pointer p, size_type)
+		{
+			if (_pool->owns(p))
+				_pool->deallocate(p);
+			else
+				_mm_free(p);
+		}
+
+	public: // Size
+		inline size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max();
+		}
+
+	public:
+		inline FixedSizePool* pool() const { return _pool; }
+
+	private:
+		//! Pool providing the memory
+		FixedSizePool* _pool;
+	};
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, typename T2>
+	inline bool operator==(PoolAllocPolicy<T> const& lhs, PoolAllocPolicy<T2> const& rhs)
+	{
+		return lhs.pool() == rhs.pool();
+	}
+
+	template<typename T, typename OtherAllocator>
+	inline bool operator==(PoolAllocPolicy<T> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+}}
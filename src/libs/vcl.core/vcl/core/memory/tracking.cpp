@@ -0,0 +1,158 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/tracking.h>
+
+// C++ standard library
+#include <algorithm>
+
+// JSON library
+#include <json.hpp>
+
+namespace Vcl { namespace Core
+{
+	AllocationStatistics::AllocationStatistics()
+	: _liveBytes(0)
+	, _peakBytes(0)
+	, _totalBytes(0)
+	, _allocations(0)
+	, _deallocations(0)
+	{
+		for (auto& count : _histogram)
+			count.store(0, std::memory_order_relaxed);
+	}
+
+	int AllocationStatistics::sizeClass(size_t bytes)
+	{
+		int size_class = 0;
+		while (bytes > 1 && size_class < NrSizeClasses - 1)
+		{
+			bytes >>= 1;
+			size_class++;
+		}
+
+		return size_class;
+	}
+
+	void AllocationStatistics::recordAllocation(size_t bytes)
+	{
+		const size_t live = _liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+		size_t peak = _peakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !_peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+			;
+
+		_totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+		_allocations.fetch_add(1, std::memory_order_relaxed);
+		_histogram[sizeClass(bytes)].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void AllocationStatistics::recordDeallocation(size_t bytes)
+	{
+		_liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+		_deallocations.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void AllocationStatistics::reset()
+	{
+		_peakBytes.store(liveBytes(), std::memory_order_relaxed);
+		_totalBytes.store(0, std::memory_order_relaxed);
+		_allocations.store(0, std::memory_order_relaxed);
+		_deallocations.store(0, std::memory_order_relaxed);
+		for (auto& count : _histogram)
+			count.store(0, std::memory_order_relaxed);
+	}
+
+	AllocationTracker& AllocationTracker::instance()
+	{
+		static AllocationTracker tracker;
+		return tracker;
+	}
+
+	AllocationStatistics& AllocationTracker::statistics(const std::string& tag)
+	{
+		std::lock_guard<std::mutex> guard{ _mutex };
+
+		auto& entry = _statistics[tag];
+		if (!entry)
+			entry = std::make_unique<AllocationStatistics>();
+
+		return *entry;
+	}
+
+	const AllocationStatistics* AllocationTracker::find(const std::string& tag) const
+	{
+		std::lock_guard<std::mutex> guard{ _mutex };
+
+		auto entry = _statistics.find(tag);
+		if (entry != _statistics.end())
+			return entry->second.get();
+
+		return nullptr;
+	}
+
+	std::vector<std::string> AllocationTracker::tags() const
+	{
+		std::vector<std::string> tags;
+		{
+			std::lock_guard<std::mutex> guard{ _mutex };
+			tags.reserve(_statistics.size());
+			for (const auto& entry : _statistics)
+				tags.emplace_back(entry.first);
+		}
+
+		std::sort(tags.begin(), tags.end());
+		return tags;
+	}
+
+	std::string AllocationTracker::toJson(int indent) const
+	{
+		using json = nlohmann::json;
+
+		json dump = json::object();
+		for (const auto& tag : tags())
+		{
+			const AllocationStatistics& stats = *find(tag);
+
+			// Only list the used size classes, keyed by their upper bound in bytes
+			json histogram = json::object();
+			for (int c = 0; c < AllocationStatistics::NrSizeClasses; c++)
+			{
+				if (stats.histogram(c) > 0)
+					histogram[std::to_string(size_t(2) << c)] = stats.histogram(c);
+			}
+
+			dump[tag] =
+			{
+				{ "live_bytes", stats.liveBytes() },
+				{ "peak_bytes", stats.peakBytes() },
+				{ "total_bytes", stats.totalBytes() },
+				{ "allocations", stats.allocations() },
+				{ "deallocations", stats.deallocations() },
+				{ "histogram", histogram }
+			};
+		}
+
+		return dump.dump(indent);
+	}
+}}
@@ -0,0 +1,266 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// VCL
+#include <vcl/core/memory/allocator.h>
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core
+{
+	/*!
+	 *	\brief Allocation counters of a single tag
+	 *
+	 *	The counters are updated atomically and can be read while allocations
+	 *	are recorded by other threads.
+	 */
+	class AllocationStatistics
+	{
+	public:
+		//! Number of size classes. Class i counts the requests of [2^i, 2^(i+1)) bytes.
+		static const int NrSizeClasses = 48;
+
+	public:
+		AllocationStatistics();
+		AllocationStatistics(const AllocationStatistics&) = delete;
+		AllocationStatistics& operator=(const AllocationStatistics&) = delete;
+
+	public:
+		void recordAllocation(size_t bytes);
+		void recordDeallocation(size_t bytes);
+
+		//! Reset all counters except for the live bytes
+		void reset();
+
+	public:
+		//! Bytes currently allocated
+		size_t liveBytes() const { return _liveBytes.load(std::memory_order_relaxed); }
+
+		//! Maximum number of bytes allocated at once
+		size_t peakBytes() const { return _peakBytes.load(std::memory_order_relaxed); }
+
+		//! Bytes allocated over the entire lifetime
+		size_t totalBytes() const { return _totalBytes.load(std::memory_order_relaxed); }
+
+		size_t allocations() const { return _allocations.load(std::memory_order_relaxed); }
+		size_t deallocations() const { return _deallocations.load(std::memory_order_relaxed); }
+
+		//! Number of allocations in the size class \a size_class
+		size_t histogram(int size_class) const
+		{
+			Require(0 <= size_class && size_class < NrSizeClasses, "Size class is valid.");
+			return _histogram[size_class].load(std::memory_order_relaxed);
+		}
+
+		//! \returns the size class of an allocation of \a bytes
+		static int sizeClass(size_t bytes);
+
+	private:
+		std::atomic<size_t> _liveBytes;
+		std::atomic<size_t> _peakBytes;
+		std::atomic<size_t> _totalBytes;
+		std::atomic<size_t> _allocations;
+		std::atomic<size_t> _deallocations;
+		std::array<std::atomic<size_t>, NrSizeClasses> _histogram;
+	};
+
+	/*!
+	 *	\brief Registry of the allocation statistics per tag
+	 */
+	class AllocationTracker
+	{
+	public:
+		//! Process wide tracker used by default
+		static AllocationTracker& instance();
+
+	public:
+		/*!
+		 *	\brief Access the statistics of a tag, creating them if necessary
+		 *
+		 *	The returned reference stays valid for the lifetime of the tracker.
+		 */
+		AllocationStatistics& statistics(const std::string& tag);
+
+		//! \returns the statistics of a tag or nullptr if nothing was recorded
+		const AllocationStatistics* find(const std::string& tag) const;
+
+		//! \returns all the registered tags in sorted order
+		std::vector<std::string> tags() const;
+
+		/*!
+		 *	\brief Write the statistics of all tags as JSON
+		 *	\param indent Indentation of the output, -1 for compact output
+		 */
+		std::string toJson(int indent = 2) const;
+
+	private:
+		mutable std::mutex _mutex;
+		std::unordered_map<std::string, std::unique_ptr<AllocationStatistics>> _statistics;
+	};
+
+	/*!
+	 *	\brief Allocation policy recording all requests to a wrapped policy
+	 *
+	 *	Rebound copies of the policy record to the same statistics.
+	 */
+	template<typename T, typename Policy = StandardAllocPolicy<T>>
+	class TrackingAllocPolicy
+	{
+	public: // Typedefs
+		typedef T value_type;
+		typedef value_type* pointer;
+		typedef const value_type* const_pointer;
+		typedef value_type& reference;
+		typedef const value_type& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+	public: // Convert an TrackingAllocPolicy<T> to TrackingAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			typedef TrackingAllocPolicy<U, typename Policy::template rebind<U>::other> other;
+		};
+
+	public:
+		inline explicit TrackingAllocPolicy(const std::string& tag = "untagged", Policy const& policy = Policy())
+		: _policy(policy), _statistics(&AllocationTracker::instance().statistics(tag)) {}
+		inline explicit TrackingAllocPolicy(AllocationStatistics& statistics, Policy const& policy = Policy())
+		: _policy(policy), _statistics(&statistics) {}
+		inline ~TrackingAllocPolicy() {}
+		inline explicit TrackingAllocPolicy(TrackingAllocPolicy const& rhs)
+		: _policy(rhs._policy), _statistics(rhs._statistics) {}
+		template <typename U, typename PolicyRhs>
+		inline explicit TrackingAllocPolicy(TrackingAllocPolicy<U, PolicyRhs> const& rhs)
+		: _policy(rhs.policy()), _statistics(&rhs.statistics()) {}
+
+	public: // Memory allocation
+		inline pointer allocate(size_type cnt, typename std::allocator<void>::const_pointer hint = 0)
+		{
+			pointer p = _policy.allocate(cnt, hint);
+			_statistics->recordAllocation(cnt * sizeof(T));
+			return p;
+		}
+		inline void deallocate(pointer p, size_type cnt)
+		{
+			if (!p)
+				return;
+
+			_policy.deallocate(p, cnt);
+			_statistics->recordDeallocation(cnt * sizeof(T));
+		}
+
+	public: // Size
+		inline size_type max_size() const
+		{
+			return _policy.max_size();
+		}
+
+	public:
+		inline const Policy& policy() const { return _policy; }
+		inline AllocationStatistics& statistics() const { return *_statistics; }
+
+	private:
+		//! Policy performing the allocations
+		Policy _policy;
+
+		//! Statistics the allocations are recorded to
+		AllocationStatistics* _statistics;
+	};
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, typename P, typename T2, typename P2>
+	inline bool operator==(TrackingAllocPolicy<T, P> const& lhs, TrackingAllocPolicy<T2, P2> const& rhs)
+	{
+		return lhs.policy() == rhs.policy();
+	}
+
+	template<typename T, typename P, typename OtherAllocator>
+	inline bool operator==(TrackingAllocPolicy<T, P> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+
+	/*!
+	 *	\brief Decorator recording the requests to a PolymorphicAllocPolicy
+	 *
+	 *	Used to add tracking to containers after their construction.
+	 */
+	template<typename T>
+	class TrackingPolymorphicAllocPolicy : public PolymorphicAllocPolicy<T>
+	{
+	public:
+		typedef typename PolymorphicAllocPolicy<T>::pointer pointer;
+		typedef typename PolymorphicAllocPolicy<T>::size_type size_type;
+
+	public:
+		TrackingPolymorphicAllocPolicy(std::unique_ptr<PolymorphicAllocPolicy<T>> policy, AllocationStatistics& statistics)
+		: _policy(std::move(policy)), _statistics(&statistics)
+		{
+			Require(_policy, "Policy is set.");
+		}
+
+	public:
+		pointer allocate(size_type cnt) override
+		{
+			pointer p = _policy->allocate(cnt);
+			_statistics->recordAllocation(cnt * sizeof(T));
+			return p;
+		}
+		void deallocate(pointer p, size_type cnt) override
+		{
+			if (!p)
+				return;
+
+			_policy->deallocate(p, cnt);
+			_statistics->recordDeallocation(cnt * sizeof(T));
+		}
+
+		std::unique_ptr<PolymorphicAllocPolicy<T>> clone() const override
+		{
+			return std::make_unique<TrackingPolymorphicAllocPolicy<T>>(_policy->clone(), *_statistics);
+		}
+
+	private:
+		std::unique_ptr<PolymorphicAllocPolicy<T>> _policy;
+		AllocationStatistics* _statistics;
+	};
+}}
@@ -34,7 +34,7 @@
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<bool, 16>
@@ -57,7 +57,14 @@ namespace Vcl
 			mF8[1] = _mm256_castsi256_ps(I8_1);
 		}
 
-		
+	public:
+		VCL_STRONG_INLINE __m256 get(int i) const
+		{
+			Require(0 <= i && i < 2, "Access is in range.");
+
+			return mF8[i];
+		}
+
 	public:
 		VCL_STRONG_INLINE VectorScalar<bool, 16> operator&& (const VectorScalar<bool, 16>& rhs)
 		{
@@ -116,4 +123,4 @@ namespace Vcl
 
 		return static_cast<unsigned int>(mask) == 0x0;
 	}
-}
+}}
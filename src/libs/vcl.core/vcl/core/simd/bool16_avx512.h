@@ -0,0 +1,102 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+
+// VCL
+#include <vcl/core/simd/vectorscalar.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<bool, 16>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(bool s)
+		{
+			mMask = s ? 0xffff : 0x0;
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__mmask16 M16) : mMask(M16) {}
+
+	public:
+		VCL_STRONG_INLINE explicit operator __mmask16() const
+		{
+			return mMask;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator&& (const VectorScalar<bool, 16>& rhs)
+		{
+			return VectorScalar<bool, 16>(_mm512_kand(mMask, rhs.mMask));
+		}
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator|| (const VectorScalar<bool, 16>& rhs)
+		{
+			return VectorScalar<bool, 16>(_mm512_kor(mMask, rhs.mMask));
+		}
+
+		VCL_STRONG_INLINE VectorScalar<bool, 16>& operator&= (const VectorScalar<bool, 16>& rhs)
+		{
+			mMask = _mm512_kand(mMask, rhs.mMask);
+			return *this;
+		}
+		VCL_STRONG_INLINE VectorScalar<bool, 16>& operator|= (const VectorScalar<bool, 16>& rhs)
+		{
+			mMask = _mm512_kor(mMask, rhs.mMask);
+			return *this;
+		}
+
+	public:
+		friend VectorScalar<float, 16> select(const VectorScalar<bool, 16>& mask, const VectorScalar<float, 16>& a, const VectorScalar<float, 16>& b);
+		friend VectorScalar<int, 16> select(const VectorScalar<bool, 16>& mask, const VectorScalar<int, 16>& a, const VectorScalar<int, 16>& b);
+		friend bool any(const VectorScalar<bool, 16>& b);
+		friend bool all(const VectorScalar<bool, 16>& b);
+		friend bool none(const VectorScalar<bool, 16>& b);
+
+	private:
+		__mmask16 mMask;
+	};
+
+	VCL_STRONG_INLINE bool any(const VectorScalar<bool, 16>& b)
+	{
+		return b.mMask != 0;
+	}
+
+	VCL_STRONG_INLINE bool all(const VectorScalar<bool, 16>& b)
+	{
+		return b.mMask == 0xffff;
+	}
+
+	VCL_STRONG_INLINE bool none(const VectorScalar<bool, 16>& b)
+	{
+		return b.mMask == 0x0;
+	}
+}}
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+
+// VCL
+#include <vcl/core/simd/vectorscalar.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<bool, 2>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(bool s)
+		{
+			mD2 = s ? _mm_castsi128_pd(_mm_set1_epi32(-1)) : _mm_setzero_pd();
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__m128d D2) : mD2(D2) {}
+		
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 2> operator&& (const VectorScalar<bool, 2>& rhs) { return VectorScalar<bool, 2>(_mm_and_pd(mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 2> operator|| (const VectorScalar<bool, 2>& rhs) { return VectorScalar<bool, 2>(_mm_or_pd (mD2, rhs.mD2)); }
+
+		VCL_STRONG_INLINE VectorScalar<bool, 2>& operator&= (const VectorScalar<bool, 2>& rhs) { mD2 = _mm_and_pd(mD2, rhs.mD2); return *this; }
+		VCL_STRONG_INLINE VectorScalar<bool, 2>& operator|= (const VectorScalar<bool, 2>& rhs) { mD2 = _mm_or_pd(mD2, rhs.mD2);  return *this; }
+
+	public:
+		friend VectorScalar<double, 2> select(const VectorScalar<bool, 2>& mask, const VectorScalar<double, 2>& a, const VectorScalar<double, 2>& b);
+		friend bool any(const VectorScalar<bool, 2>& b);
+		friend bool all(const VectorScalar<bool, 2>& b);
+		friend bool none(const VectorScalar<bool, 2>& b);
+
+	private:
+		__m128d mD2;
+	};
+
+	VCL_STRONG_INLINE bool any(const VectorScalar<bool, 2>& b)
+	{
+		return _mm_movemask_pd(b.mD2) != 0;
+	}
+
+	VCL_STRONG_INLINE bool all(const VectorScalar<bool, 2>& b)
+	{
+		return static_cast<unsigned int>(_mm_movemask_pd(b.mD2)) == 0x3;
+	}
+
+	VCL_STRONG_INLINE bool none(const VectorScalar<bool, 2>& b)
+	{
+		return static_cast<unsigned int>(_mm_movemask_pd(b.mD2)) == 0x0;
+	}
+}}
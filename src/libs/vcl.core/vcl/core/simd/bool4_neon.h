@@ -35,7 +35,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_neon.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<bool, 4>
@@ -83,4 +83,4 @@ namespace Vcl
 	{
 		return static_cast<unsigned int>(vmovemaskq_f32(b._data[0])) == 0x0;
 	}
-}
+}}
@@ -34,7 +34,7 @@
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<bool, 4>
@@ -47,7 +47,13 @@ namespace Vcl
 		}
 		explicit VCL_STRONG_INLINE VectorScalar(__m128 F4) : mF4(F4) {}
 		explicit VCL_STRONG_INLINE VectorScalar(__m128i I4) : mF4(_mm_castsi128_ps(I4)) {}
-		
+
+	public:
+		VCL_STRONG_INLINE explicit operator __m128() const
+		{
+			return mF4;
+		}
+
 	public:
 		VCL_STRONG_INLINE VectorScalar<bool, 4> operator&& (const VectorScalar<bool, 4>& rhs) { return VectorScalar<bool, 4>(_mm_and_ps(mF4, rhs.mF4)); }
 		VCL_STRONG_INLINE VectorScalar<bool, 4> operator|| (const VectorScalar<bool, 4>& rhs) { return VectorScalar<bool, 4>(_mm_or_ps (mF4, rhs.mF4)); }
@@ -58,6 +64,7 @@ namespace Vcl
 	public:
 		friend VectorScalar<float, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<float, 4>& a, const VectorScalar<float, 4>& b);
 		friend VectorScalar<int, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<int, 4>& a, const VectorScalar<int, 4>& b);
+		friend VectorScalar<double, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<double, 4>& a, const VectorScalar<double, 4>& b);
 		friend bool any(const VectorScalar<bool, 4>& b);
 		friend bool all(const VectorScalar<bool, 4>& b);
 		friend bool none(const VectorScalar<bool, 4>& b);
@@ -95,4 +102,4 @@ namespace Vcl
 
 		return static_cast<unsigned int>(_mm_movemask_ps(b.mF4)) == 0x0;
 	}
-}
+}}
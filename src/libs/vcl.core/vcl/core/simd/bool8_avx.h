@@ -34,7 +34,7 @@
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<bool, 8>
@@ -48,6 +48,12 @@ namespace Vcl
 		explicit VCL_STRONG_INLINE VectorScalar(__m256 F8) : mF8(F8) { }
 		explicit VCL_STRONG_INLINE VectorScalar(__m256i I8) : mF8(_mm256_castsi256_ps(I8)) {}
 
+	public:
+		VCL_STRONG_INLINE explicit operator __m256() const
+		{
+			return mF8;
+		}
+
 	public:
 		VCL_STRONG_INLINE VectorScalar<bool, 8> operator&& (const VectorScalar<bool, 8>& rhs)
 		{
@@ -64,6 +70,7 @@ namespace Vcl
 	public:
 		friend VectorScalar<float, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<float, 8>& a, const VectorScalar<float, 8>& b);
 		friend VectorScalar<int, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<int, 8>& a, const VectorScalar<int, 8>& b);
+		friend VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b);
 		friend bool any(const VectorScalar<bool, 8>& b);
 		friend bool all(const VectorScalar<bool, 8>& b);
 		friend bool none(const VectorScalar<bool, 8>& b);
@@ -86,4 +93,4 @@ namespace Vcl
 	{
 		return static_cast<unsigned int>(_mm256_movemask_ps(b.mF8)) == 0x0;
 	}
-}
+}}
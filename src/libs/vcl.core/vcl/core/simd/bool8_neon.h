@@ -34,7 +34,7 @@
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<bool, 8>
@@ -109,4 +109,4 @@ namespace Vcl
 
 		return static_cast<unsigned int>(mask) == 0x0;
 	}
-}
+}}
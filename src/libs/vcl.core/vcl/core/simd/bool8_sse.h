@@ -34,7 +34,7 @@
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<bool, 8>
@@ -83,6 +83,7 @@ namespace Vcl
 	public:
 		friend VectorScalar<float, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<float, 8>& a, const VectorScalar<float, 8>& b);
 		friend VectorScalar<int, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<int, 8>& a, const VectorScalar<int, 8>& b);
+		friend VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b);
 		friend bool any(const VectorScalar<bool, 8>& b);
 		friend bool all(const VectorScalar<bool, 8>& b);
 		friend bool none(const VectorScalar<bool, 8>& b);
@@ -128,4 +129,4 @@ namespace Vcl
 
 		return static_cast<unsigned int>(mask) == 0x0;
 	}
-}
+}}
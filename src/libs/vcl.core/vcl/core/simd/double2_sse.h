@@ -0,0 +1,155 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+#include <cmath>
+
+// VCL 
+#include <vcl/core/simd/bool2_sse.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/intrinsics_sse.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<double, 2>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(const VectorScalar<double, 2>& rhs)
+		{
+			mD2 = rhs.mD2;
+		}
+		VCL_STRONG_INLINE VectorScalar(double s)
+		{
+			mD2 = _mm_set1_pd(s);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(double s0, double s1)
+		{
+			mD2 = _mm_set_pd(s1, s0);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__m128d D2) : mD2(D2) {}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 2>& operator= (const VectorScalar<double, 2>& rhs) { mD2 = rhs.mD2; return *this; }
+
+	public:
+		VCL_STRONG_INLINE double operator[] (int idx) const
+		{
+			Require(0 <= idx && idx < 2, "Access is in range.");
+
+			return _mmVCL_extract_pd(mD2, idx);
+		}
+
+		VCL_STRONG_INLINE explicit operator __m128d() const
+		{
+			return mD2;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 2> operator- () const
+		{
+			return VectorScalar<double, 2>(_mm_xor_pd(mD2, _mm_set1_pd(-0.0)));
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 2> operator+ (const VectorScalar<double, 2>& rhs) const { return VectorScalar<double, 2>(_mm_add_pd(mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> operator- (const VectorScalar<double, 2>& rhs) const { return VectorScalar<double, 2>(_mm_sub_pd(mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> operator* (const VectorScalar<double, 2>& rhs) const { return VectorScalar<double, 2>(_mm_mul_pd(mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> operator/ (const VectorScalar<double, 2>& rhs) const { return VectorScalar<double, 2>(_mm_div_pd(mD2, rhs.mD2)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 2>& operator += (const VectorScalar<double, 2>& rhs) { mD2 = _mm_add_pd(mD2, rhs.mD2); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 2>& operator -= (const VectorScalar<double, 2>& rhs) { mD2 = _mm_sub_pd(mD2, rhs.mD2); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 2>& operator *= (const VectorScalar<double, 2>& rhs) { mD2 = _mm_mul_pd(mD2, rhs.mD2); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 2>& operator /= (const VectorScalar<double, 2>& rhs) { mD2 = _mm_div_pd(mD2, rhs.mD2); return *this; }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 2> operator== (const VectorScalar<double, 2>& rhs) const { return VectorScalar<bool, 2>(_mm_cmpeq_pd (mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 2> operator!= (const VectorScalar<double, 2>& rhs) const { return VectorScalar<bool, 2>(_mm_cmpneq_pd(mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 2> operator<  (const VectorScalar<double, 2>& rhs) const { return VectorScalar<bool, 2>(_mm_cmplt_pd (mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 2> operator<= (const VectorScalar<double, 2>& rhs) const { return VectorScalar<bool, 2>(_mm_cmple_pd (mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 2> operator>  (const VectorScalar<double, 2>& rhs) const { return VectorScalar<bool, 2>(_mm_cmpgt_pd (mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 2> operator>= (const VectorScalar<double, 2>& rhs) const { return VectorScalar<bool, 2>(_mm_cmpge_pd (mD2, rhs.mD2)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 2> abs()   const { return VectorScalar<double, 2>(_mm_abs_pd (mD2)); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> sgn()   const { return VectorScalar<double, 2>(_mm_sgn_pd (mD2)); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> sqrt()  const { return VectorScalar<double, 2>(_mm_sqrt_pd(mD2)); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> rcp()   const { return VectorScalar<double, 2>(_mm_div_pd(_mm_set1_pd(1.0), mD2)); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> rsqrt() const { return VectorScalar<double, 2>(_mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(mD2))); }
+
+		// There are no vectorized double precision transcendentals, evaluate per lane
+		VCL_STRONG_INLINE VectorScalar<double, 2> sin()  const { return map([](double x) { return std::sin(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> cos()  const { return map([](double x) { return std::cos(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> exp()  const { return map([](double x) { return std::exp(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> log()  const { return map([](double x) { return std::log(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> acos() const { return map([](double x) { return std::acos(x); }); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 2> min(const VectorScalar<double, 2>& rhs) const { return VectorScalar<double, 2>(_mm_min_pd(mD2, rhs.mD2)); }
+		VCL_STRONG_INLINE VectorScalar<double, 2> max(const VectorScalar<double, 2>& rhs) const { return VectorScalar<double, 2>(_mm_max_pd(mD2, rhs.mD2)); }
+
+		VCL_STRONG_INLINE double min() const { return _mmVCL_hmin_pd(mD2); }
+		VCL_STRONG_INLINE double max() const { return _mmVCL_hmax_pd(mD2); }
+
+	public:
+		friend std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 2>& rhs);
+		friend VectorScalar<double, 2> select(const VectorScalar<bool, 2>& mask, const VectorScalar<double, 2>& a, const VectorScalar<double, 2>& b);
+
+	private:
+		template<typename Func>
+		VCL_STRONG_INLINE VectorScalar<double, 2> map(Func f) const
+		{
+			VCL_ALIGN(16) double vars[2];
+			_mm_store_pd(vars, mD2);
+
+			return VectorScalar<double, 2>(f(vars[0]), f(vars[1]));
+		}
+
+	private:
+		__m128d mD2;
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 2> select(const VectorScalar<bool, 2>& mask, const VectorScalar<double, 2>& a, const VectorScalar<double, 2>& b)
+	{
+		return VectorScalar<double, 2>(_mmVCL_blend_pd(b.mD2, a.mD2, mask.mD2));
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 2>& rhs)
+	{
+		VCL_ALIGN(16) double vars[2];
+		_mm_store_pd(vars, rhs.mD2);
+
+		s << "'" << vars[0] << ", " << vars[1] << "'";
+		return s;
+	}
+}}
@@ -0,0 +1,155 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+#include <cmath>
+
+// VCL 
+#include <vcl/core/simd/bool4_sse.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/intrinsics_avx.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<double, 4>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(const VectorScalar<double, 4>& rhs)
+		{
+			mD4 = rhs.mD4;
+		}
+		VCL_STRONG_INLINE VectorScalar(double s)
+		{
+			mD4 = _mm256_set1_pd(s);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(double s0, double s1, double s2, double s3)
+		{
+			mD4 = _mm256_set_pd(s3, s2, s1, s0);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__m256d D4) : mD4(D4) {}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator= (const VectorScalar<double, 4>& rhs) { mD4 = rhs.mD4; return *this; }
+
+	public:
+		VCL_STRONG_INLINE double operator[] (int idx) const
+		{
+			Require(0 <= idx && idx < 4, "Access is in range.");
+
+			return _mmVCL_extract_pd(mD4, idx);
+		}
+
+		VCL_STRONG_INLINE explicit operator __m256d() const
+		{
+			return mD4;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator- () const
+		{
+			return VectorScalar<double, 4>(_mm256_xor_pd(mD4, _mm256_set1_pd(-0.0)));
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator+ (const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm256_add_pd(mD4, rhs.mD4)); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator- (const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm256_sub_pd(mD4, rhs.mD4)); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator* (const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm256_mul_pd(mD4, rhs.mD4)); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator/ (const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm256_div_pd(mD4, rhs.mD4)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator += (const VectorScalar<double, 4>& rhs) { mD4 = _mm256_add_pd(mD4, rhs.mD4); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator -= (const VectorScalar<double, 4>& rhs) { mD4 = _mm256_sub_pd(mD4, rhs.mD4); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator *= (const VectorScalar<double, 4>& rhs) { mD4 = _mm256_mul_pd(mD4, rhs.mD4); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator /= (const VectorScalar<double, 4>& rhs) { mD4 = _mm256_div_pd(mD4, rhs.mD4); return *this; }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator== (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm256_cmp_pd(mD4, rhs.mD4, _CMP_EQ_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator!= (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm256_cmp_pd(mD4, rhs.mD4, _CMP_NEQ_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator<  (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm256_cmp_pd(mD4, rhs.mD4, _CMP_LT_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator<= (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm256_cmp_pd(mD4, rhs.mD4, _CMP_LE_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator>  (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm256_cmp_pd(mD4, rhs.mD4, _CMP_GT_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator>= (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm256_cmp_pd(mD4, rhs.mD4, _CMP_GE_OQ))); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4> abs()   const { return VectorScalar<double, 4>(_mm256_abs_pd (mD4)); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> sgn()   const { return VectorScalar<double, 4>(_mm256_sgn_pd (mD4)); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> sqrt()  const { return VectorScalar<double, 4>(_mm256_sqrt_pd(mD4)); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> rcp()   const { return VectorScalar<double, 4>(_mm256_div_pd(_mm256_set1_pd(1.0), mD4)); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> rsqrt() const { return VectorScalar<double, 4>(_mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(mD4))); }
+
+		// There are no vectorized double precision transcendentals, evaluate per lane
+		VCL_STRONG_INLINE VectorScalar<double, 4> sin()  const { return map([](double x) { return std::sin(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> cos()  const { return map([](double x) { return std::cos(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> exp()  const { return map([](double x) { return std::exp(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> log()  const { return map([](double x) { return std::log(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> acos() const { return map([](double x) { return std::acos(x); }); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4> min(const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm256_min_pd(mD4, rhs.mD4)); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> max(const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm256_max_pd(mD4, rhs.mD4)); }
+
+		VCL_STRONG_INLINE double min() const { return _mmVCL_hmin_pd(mD4); }
+		VCL_STRONG_INLINE double max() const { return _mmVCL_hmax_pd(mD4); }
+
+	public:
+		friend std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 4>& rhs);
+		friend VectorScalar<double, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<double, 4>& a, const VectorScalar<double, 4>& b);
+
+	private:
+		template<typename Func>
+		VCL_STRONG_INLINE VectorScalar<double, 4> map(Func f) const
+		{
+			VCL_ALIGN(32) double vars[4];
+			_mm256_store_pd(vars, mD4);
+
+			return VectorScalar<double, 4>(f(vars[0]), f(vars[1]), f(vars[2]), f(vars[3]));
+		}
+
+	private:
+		__m256d mD4;
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<double, 4>& a, const VectorScalar<double, 4>& b)
+	{
+		return VectorScalar<double, 4>(_mm256_blendv_pd(b.mD4, a.mD4, _mmVCL_unpack_mask_ps(mask.mF4)));
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 4>& rhs)
+	{
+		VCL_ALIGN(32) double vars[4];
+		_mm256_store_pd(vars, rhs.mD4);
+
+		s << "'" << vars[0] << ", " << vars[1] << ", " << vars[2] << ", " << vars[3] << "'";
+		return s;
+	}
+}}
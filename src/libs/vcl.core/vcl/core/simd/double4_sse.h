@@ -0,0 +1,175 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+#include <cmath>
+
+// VCL 
+#include <vcl/core/simd/bool4_sse.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/intrinsics_sse.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<double, 4>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(const VectorScalar<double, 4>& rhs)
+		{
+			mD2[0] = rhs.mD2[0];
+			mD2[1] = rhs.mD2[1];
+		}
+		VCL_STRONG_INLINE VectorScalar(double s)
+		{
+			mD2[0] = _mm_set1_pd(s);
+			mD2[1] = _mm_set1_pd(s);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(double s0, double s1, double s2, double s3)
+		{
+			mD2[0] = _mm_set_pd(s1, s0);
+			mD2[1] = _mm_set_pd(s3, s2);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__m128d D2_0, __m128d D2_1)
+		{
+			mD2[0] = D2_0;
+			mD2[1] = D2_1;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator= (const VectorScalar<double, 4>& rhs)
+		{
+			mD2[0] = rhs.mD2[0];
+			mD2[1] = rhs.mD2[1];
+			return *this;
+		}
+
+	public:
+		VCL_STRONG_INLINE double operator[] (int idx) const
+		{
+			Require(0 <= idx && idx < 4, "Access is in range.");
+
+			return _mmVCL_extract_pd(mD2[idx / 2], idx % 2);
+		}
+
+		VCL_STRONG_INLINE __m128d get(int i) const
+		{
+			Require(0 <= i && i < 2, "Access is in range.");
+
+			return mD2[i];
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator- () const
+		{
+			return (*this) * VectorScalar<double, 4>(-1);
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator+ (const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm_add_pd(mD2[0], rhs.mD2[0]), _mm_add_pd(mD2[1], rhs.mD2[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator- (const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm_sub_pd(mD2[0], rhs.mD2[0]), _mm_sub_pd(mD2[1], rhs.mD2[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator* (const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm_mul_pd(mD2[0], rhs.mD2[0]), _mm_mul_pd(mD2[1], rhs.mD2[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> operator/ (const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm_div_pd(mD2[0], rhs.mD2[0]), _mm_div_pd(mD2[1], rhs.mD2[1])); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator += (const VectorScalar<double, 4>& rhs) { return *this = *this + rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator -= (const VectorScalar<double, 4>& rhs) { return *this = *this - rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator *= (const VectorScalar<double, 4>& rhs) { return *this = *this * rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 4>& operator /= (const VectorScalar<double, 4>& rhs) { return *this = *this / rhs; }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator== (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm_cmpeq_pd (mD2[0], rhs.mD2[0]), _mm_cmpeq_pd (mD2[1], rhs.mD2[1]))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator!= (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm_cmpneq_pd(mD2[0], rhs.mD2[0]), _mm_cmpneq_pd(mD2[1], rhs.mD2[1]))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator<  (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm_cmplt_pd (mD2[0], rhs.mD2[0]), _mm_cmplt_pd (mD2[1], rhs.mD2[1]))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator<= (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm_cmple_pd (mD2[0], rhs.mD2[0]), _mm_cmple_pd (mD2[1], rhs.mD2[1]))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator>  (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm_cmpgt_pd (mD2[0], rhs.mD2[0]), _mm_cmpgt_pd (mD2[1], rhs.mD2[1]))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 4> operator>= (const VectorScalar<double, 4>& rhs) const { return VectorScalar<bool, 4>(_mmVCL_pack_mask_pd(_mm_cmpge_pd (mD2[0], rhs.mD2[0]), _mm_cmpge_pd (mD2[1], rhs.mD2[1]))); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4> abs()   const { return VectorScalar<double, 4>(_mm_abs_pd (mD2[0]), _mm_abs_pd (mD2[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> sgn()   const { return VectorScalar<double, 4>(_mm_sgn_pd (mD2[0]), _mm_sgn_pd (mD2[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> sqrt()  const { return VectorScalar<double, 4>(_mm_sqrt_pd(mD2[0]), _mm_sqrt_pd(mD2[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> rcp()   const { return VectorScalar<double, 4>(1.0) / *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 4> rsqrt() const { return VectorScalar<double, 4>(1.0) / sqrt(); }
+
+		// There are no vectorized double precision transcendentals, evaluate per lane
+		VCL_STRONG_INLINE VectorScalar<double, 4> sin()  const { return map([](double x) { return std::sin(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> cos()  const { return map([](double x) { return std::cos(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> exp()  const { return map([](double x) { return std::exp(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> log()  const { return map([](double x) { return std::log(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> acos() const { return map([](double x) { return std::acos(x); }); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 4> min(const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm_min_pd(mD2[0], rhs.mD2[0]), _mm_min_pd(mD2[1], rhs.mD2[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 4> max(const VectorScalar<double, 4>& rhs) const { return VectorScalar<double, 4>(_mm_max_pd(mD2[0], rhs.mD2[0]), _mm_max_pd(mD2[1], rhs.mD2[1])); }
+
+		VCL_STRONG_INLINE double min() const { return _mmVCL_hmin_pd(_mm_min_pd(mD2[0], mD2[1])); }
+		VCL_STRONG_INLINE double max() const { return _mmVCL_hmax_pd(_mm_max_pd(mD2[0], mD2[1])); }
+
+	public:
+		friend std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 4>& rhs);
+		friend VectorScalar<double, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<double, 4>& a, const VectorScalar<double, 4>& b);
+
+	private:
+		template<typename Func>
+		VCL_STRONG_INLINE VectorScalar<double, 4> map(Func f) const
+		{
+			VCL_ALIGN(16) double vars[4];
+			_mm_store_pd(vars + 0, mD2[0]);
+			_mm_store_pd(vars + 2, mD2[1]);
+
+			return VectorScalar<double, 4>(f(vars[0]), f(vars[1]), f(vars[2]), f(vars[3]));
+		}
+
+	private:
+		__m128d mD2[2];
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<double, 4>& a, const VectorScalar<double, 4>& b)
+	{
+		return VectorScalar<double, 4>
+		(
+			_mmVCL_blend_pd(b.mD2[0], a.mD2[0], _mmVCL_unpacklo_mask_ps(mask.mF4)),
+			_mmVCL_blend_pd(b.mD2[1], a.mD2[1], _mmVCL_unpackhi_mask_ps(mask.mF4))
+		);
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 4>& rhs)
+	{
+		VCL_ALIGN(16) double vars[4];
+		_mm_store_pd(vars + 0, rhs.mD2[0]);
+		_mm_store_pd(vars + 2, rhs.mD2[1]);
+
+		s << "'" << vars[0] << ", " << vars[1] << ", " << vars[2] << ", " << vars[3] << "'";
+		return s;
+	}
+}}
@@ -0,0 +1,182 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+#include <cmath>
+
+// VCL 
+#include <vcl/core/simd/bool8_avx.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/intrinsics_avx.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<double, 8>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(const VectorScalar<double, 8>& rhs)
+		{
+			mD4[0] = rhs.mD4[0];
+			mD4[1] = rhs.mD4[1];
+		}
+		VCL_STRONG_INLINE VectorScalar(double s)
+		{
+			mD4[0] = _mm256_set1_pd(s);
+			mD4[1] = _mm256_set1_pd(s);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(double s0, double s1, double s2, double s3, double s4, double s5, double s6, double s7)
+		{
+			mD4[0] = _mm256_set_pd(s3, s2, s1, s0);
+			mD4[1] = _mm256_set_pd(s7, s6, s5, s4);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__m256d D4_0, __m256d D4_1)
+		{
+			mD4[0] = D4_0;
+			mD4[1] = D4_1;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator= (const VectorScalar<double, 8>& rhs)
+		{
+			mD4[0] = rhs.mD4[0];
+			mD4[1] = rhs.mD4[1];
+			return *this;
+		}
+
+	public:
+		VCL_STRONG_INLINE double operator[] (int idx) const
+		{
+			Require(0 <= idx && idx < 8, "Access is in range.");
+
+			return _mmVCL_extract_pd(mD4[idx / 4], idx % 4);
+		}
+
+		VCL_STRONG_INLINE __m256d get(int i) const
+		{
+			Require(0 <= i && i < 2, "Access is in range.");
+
+			return mD4[i];
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator- () const
+		{
+			return (*this) * VectorScalar<double, 8>(-1);
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator+ (const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm256_add_pd(mD4[0], rhs.mD4[0]), _mm256_add_pd(mD4[1], rhs.mD4[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator- (const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm256_sub_pd(mD4[0], rhs.mD4[0]), _mm256_sub_pd(mD4[1], rhs.mD4[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator* (const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm256_mul_pd(mD4[0], rhs.mD4[0]), _mm256_mul_pd(mD4[1], rhs.mD4[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator/ (const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm256_div_pd(mD4[0], rhs.mD4[0]), _mm256_div_pd(mD4[1], rhs.mD4[1])); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator += (const VectorScalar<double, 8>& rhs) { return *this = *this + rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator -= (const VectorScalar<double, 8>& rhs) { return *this = *this - rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator *= (const VectorScalar<double, 8>& rhs) { return *this = *this * rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator /= (const VectorScalar<double, 8>& rhs) { return *this = *this / rhs; }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator== (const VectorScalar<double, 8>& rhs) const { return compare<_CMP_EQ_OQ >(rhs); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator!= (const VectorScalar<double, 8>& rhs) const { return compare<_CMP_NEQ_OQ>(rhs); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator<  (const VectorScalar<double, 8>& rhs) const { return compare<_CMP_LT_OQ >(rhs); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator<= (const VectorScalar<double, 8>& rhs) const { return compare<_CMP_LE_OQ >(rhs); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator>  (const VectorScalar<double, 8>& rhs) const { return compare<_CMP_GT_OQ >(rhs); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator>= (const VectorScalar<double, 8>& rhs) const { return compare<_CMP_GE_OQ >(rhs); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> abs()   const { return VectorScalar<double, 8>(_mm256_abs_pd (mD4[0]), _mm256_abs_pd (mD4[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> sgn()   const { return VectorScalar<double, 8>(_mm256_sgn_pd (mD4[0]), _mm256_sgn_pd (mD4[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> sqrt()  const { return VectorScalar<double, 8>(_mm256_sqrt_pd(mD4[0]), _mm256_sqrt_pd(mD4[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> rcp()   const { return VectorScalar<double, 8>(1.0) / *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 8> rsqrt() const { return VectorScalar<double, 8>(1.0) / sqrt(); }
+
+		// There are no vectorized double precision transcendentals, evaluate per lane
+		VCL_STRONG_INLINE VectorScalar<double, 8> sin()  const { return map([](double x) { return std::sin(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> cos()  const { return map([](double x) { return std::cos(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> exp()  const { return map([](double x) { return std::exp(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> log()  const { return map([](double x) { return std::log(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> acos() const { return map([](double x) { return std::acos(x); }); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> min(const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm256_min_pd(mD4[0], rhs.mD4[0]), _mm256_min_pd(mD4[1], rhs.mD4[1])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> max(const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm256_max_pd(mD4[0], rhs.mD4[0]), _mm256_max_pd(mD4[1], rhs.mD4[1])); }
+
+		VCL_STRONG_INLINE double min() const { return _mmVCL_hmin_pd(_mm256_min_pd(mD4[0], mD4[1])); }
+		VCL_STRONG_INLINE double max() const { return _mmVCL_hmax_pd(_mm256_max_pd(mD4[0], mD4[1])); }
+
+	public:
+		friend std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 8>& rhs);
+		friend VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b);
+
+	private:
+		template<int Predicate>
+		VCL_STRONG_INLINE VectorScalar<bool, 8> compare(const VectorScalar<double, 8>& rhs) const
+		{
+			const __m128 lo = _mmVCL_pack_mask_pd(_mm256_cmp_pd(mD4[0], rhs.mD4[0], Predicate));
+			const __m128 hi = _mmVCL_pack_mask_pd(_mm256_cmp_pd(mD4[1], rhs.mD4[1], Predicate));
+			return VectorScalar<bool, 8>(_mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1));
+		}
+
+		template<typename Func>
+		VCL_STRONG_INLINE VectorScalar<double, 8> map(Func f) const
+		{
+			VCL_ALIGN(32) double vars[8];
+			_mm256_store_pd(vars + 0, mD4[0]);
+			_mm256_store_pd(vars + 4, mD4[1]);
+
+			return VectorScalar<double, 8>(f(vars[0]), f(vars[1]), f(vars[2]), f(vars[3]), f(vars[4]), f(vars[5]), f(vars[6]), f(vars[7]));
+		}
+
+	private:
+		__m256d mD4[2];
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b)
+	{
+		const __m256d lo = _mmVCL_unpack_mask_ps(_mm256_castps256_ps128(mask.mF8));
+		const __m256d hi = _mmVCL_unpack_mask_ps(_mm256_extractf128_ps(mask.mF8, 1));
+		return VectorScalar<double, 8>(_mm256_blendv_pd(b.mD4[0], a.mD4[0], lo), _mm256_blendv_pd(b.mD4[1], a.mD4[1], hi));
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 8>& rhs)
+	{
+		VCL_ALIGN(32) double vars[8];
+		_mm256_store_pd(vars + 0, rhs.mD4[0]);
+		_mm256_store_pd(vars + 4, rhs.mD4[1]);
+
+		s << "'" << vars[0] << ", " << vars[1] << ", " << vars[2] << ", " << vars[3] << ", "
+		         << vars[4] << ", " << vars[5] << ", " << vars[6] << ", " << vars[7] << "'";
+		return s;
+	}
+}}
@@ -0,0 +1,156 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+#include <cmath>
+
+// VCL 
+#include <vcl/core/simd/bool8_avx.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/intrinsics_avx512.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<double, 8>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(const VectorScalar<double, 8>& rhs)
+		{
+			mD8 = rhs.mD8;
+		}
+		VCL_STRONG_INLINE VectorScalar(double s)
+		{
+			mD8 = _mm512_set1_pd(s);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(double s0, double s1, double s2, double s3, double s4, double s5, double s6, double s7)
+		{
+			mD8 = _mm512_set_pd(s7, s6, s5, s4, s3, s2, s1, s0);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__m512d D8) : mD8(D8) {}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator= (const VectorScalar<double, 8>& rhs) { mD8 = rhs.mD8; return *this; }
+
+	public:
+		VCL_STRONG_INLINE double operator[] (int idx) const
+		{
+			Require(0 <= idx && idx < 8, "Access is in range.");
+
+			return _mmVCL_extract_pd(mD8, idx);
+		}
+
+		VCL_STRONG_INLINE explicit operator __m512d() const
+		{
+			return mD8;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator- () const
+		{
+			return VectorScalar<double, 8>(_mm512_xor_pd(mD8, _mm512_set1_pd(-0.0)));
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator+ (const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm512_add_pd(mD8, rhs.mD8)); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator- (const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm512_sub_pd(mD8, rhs.mD8)); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator* (const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm512_mul_pd(mD8, rhs.mD8)); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator/ (const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm512_div_pd(mD8, rhs.mD8)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator += (const VectorScalar<double, 8>& rhs) { mD8 = _mm512_add_pd(mD8, rhs.mD8); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator -= (const VectorScalar<double, 8>& rhs) { mD8 = _mm512_sub_pd(mD8, rhs.mD8); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator *= (const VectorScalar<double, 8>& rhs) { mD8 = _mm512_mul_pd(mD8, rhs.mD8); return *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator /= (const VectorScalar<double, 8>& rhs) { mD8 = _mm512_div_pd(mD8, rhs.mD8); return *this; }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator== (const VectorScalar<double, 8>& rhs) const { return VectorScalar<bool, 8>(_mmVCL_mask_to_ps(_mm512_cmp_pd_mask(mD8, rhs.mD8, _CMP_EQ_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator!= (const VectorScalar<double, 8>& rhs) const { return VectorScalar<bool, 8>(_mmVCL_mask_to_ps(_mm512_cmp_pd_mask(mD8, rhs.mD8, _CMP_NEQ_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator<  (const VectorScalar<double, 8>& rhs) const { return VectorScalar<bool, 8>(_mmVCL_mask_to_ps(_mm512_cmp_pd_mask(mD8, rhs.mD8, _CMP_LT_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator<= (const VectorScalar<double, 8>& rhs) const { return VectorScalar<bool, 8>(_mmVCL_mask_to_ps(_mm512_cmp_pd_mask(mD8, rhs.mD8, _CMP_LE_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator>  (const VectorScalar<double, 8>& rhs) const { return VectorScalar<bool, 8>(_mmVCL_mask_to_ps(_mm512_cmp_pd_mask(mD8, rhs.mD8, _CMP_GT_OQ))); }
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator>= (const VectorScalar<double, 8>& rhs) const { return VectorScalar<bool, 8>(_mmVCL_mask_to_ps(_mm512_cmp_pd_mask(mD8, rhs.mD8, _CMP_GE_OQ))); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> abs()   const { return VectorScalar<double, 8>(_mm512_abs_pd (mD8)); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> sgn()   const { return VectorScalar<double, 8>(_mm512_sgn_pd (mD8)); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> sqrt()  const { return VectorScalar<double, 8>(_mm512_sqrt_pd(mD8)); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> rcp()   const { return VectorScalar<double, 8>(_mm512_div_pd(_mm512_set1_pd(1.0), mD8)); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> rsqrt() const { return VectorScalar<double, 8>(_mm512_div_pd(_mm512_set1_pd(1.0), _mm512_sqrt_pd(mD8))); }
+
+		// There are no vectorized double precision transcendentals, evaluate per lane
+		VCL_STRONG_INLINE VectorScalar<double, 8> sin()  const { return map([](double x) { return std::sin(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> cos()  const { return map([](double x) { return std::cos(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> exp()  const { return map([](double x) { return std::exp(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> log()  const { return map([](double x) { return std::log(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> acos() const { return map([](double x) { return std::acos(x); }); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> min(const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm512_min_pd(mD8, rhs.mD8)); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> max(const VectorScalar<double, 8>& rhs) const { return VectorScalar<double, 8>(_mm512_max_pd(mD8, rhs.mD8)); }
+
+		VCL_STRONG_INLINE double min() const { return _mmVCL_hmin_pd(mD8); }
+		VCL_STRONG_INLINE double max() const { return _mmVCL_hmax_pd(mD8); }
+
+	public:
+		friend std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 8>& rhs);
+		friend VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b);
+
+	private:
+		template<typename Func>
+		VCL_STRONG_INLINE VectorScalar<double, 8> map(Func f) const
+		{
+			VCL_ALIGN(64) double vars[8];
+			_mm512_store_pd(vars, mD8);
+
+			return VectorScalar<double, 8>(f(vars[0]), f(vars[1]), f(vars[2]), f(vars[3]), f(vars[4]), f(vars[5]), f(vars[6]), f(vars[7]));
+		}
+
+	private:
+		__m512d mD8;
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b)
+	{
+		return VectorScalar<double, 8>(_mm512_mask_blend_pd(_mmVCL_ps_to_mask(mask.mF8), b.mD8, a.mD8));
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 8>& rhs)
+	{
+		VCL_ALIGN(64) double vars[8];
+		_mm512_store_pd(vars, rhs.mD8);
+
+		s << "'" << vars[0] << ", " << vars[1] << ", " << vars[2] << ", " << vars[3] << ", "
+		         << vars[4] << ", " << vars[5] << ", " << vars[6] << ", " << vars[7] << "'";
+		return s;
+	}
+}}
@@ -0,0 +1,252 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+#include <cmath>
+
+// VCL 
+#include <vcl/core/simd/bool8_sse.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/intrinsics_sse.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<double, 8>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(const VectorScalar<double, 8>& rhs)
+		{
+			mD2[0] = rhs.mD2[0];
+			mD2[1] = rhs.mD2[1];
+			mD2[2] = rhs.mD2[2];
+			mD2[3] = rhs.mD2[3];
+		}
+		VCL_STRONG_INLINE VectorScalar(double s)
+		{
+			mD2[0] = _mm_set1_pd(s);
+			mD2[1] = _mm_set1_pd(s);
+			mD2[2] = _mm_set1_pd(s);
+			mD2[3] = _mm_set1_pd(s);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(double s0, double s1, double s2, double s3, double s4, double s5, double s6, double s7)
+		{
+			mD2[0] = _mm_set_pd(s1, s0);
+			mD2[1] = _mm_set_pd(s3, s2);
+			mD2[2] = _mm_set_pd(s5, s4);
+			mD2[3] = _mm_set_pd(s7, s6);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__m128d D2_0, __m128d D2_1, __m128d D2_2, __m128d D2_3)
+		{
+			mD2[0] = D2_0;
+			mD2[1] = D2_1;
+			mD2[2] = D2_2;
+			mD2[3] = D2_3;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator= (const VectorScalar<double, 8>& rhs)
+		{
+			mD2[0] = rhs.mD2[0];
+			mD2[1] = rhs.mD2[1];
+			mD2[2] = rhs.mD2[2];
+			mD2[3] = rhs.mD2[3];
+			return *this;
+		}
+
+	public:
+		VCL_STRONG_INLINE double operator[] (int idx) const
+		{
+			Require(0 <= idx && idx < 8, "Access is in range.");
+
+			return _mmVCL_extract_pd(mD2[idx / 2], idx % 2);
+		}
+
+		VCL_STRONG_INLINE __m128d get(int i) const
+		{
+			Require(0 <= i && i < 4, "Access is in range.");
+
+			return mD2[i];
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator- () const
+		{
+			return (*this) * VectorScalar<double, 8>(-1);
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator+ (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<double, 8>(_mm_add_pd(mD2[0], rhs.mD2[0]), _mm_add_pd(mD2[1], rhs.mD2[1]), _mm_add_pd(mD2[2], rhs.mD2[2]), _mm_add_pd(mD2[3], rhs.mD2[3]));
+		}
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator- (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<double, 8>(_mm_sub_pd(mD2[0], rhs.mD2[0]), _mm_sub_pd(mD2[1], rhs.mD2[1]), _mm_sub_pd(mD2[2], rhs.mD2[2]), _mm_sub_pd(mD2[3], rhs.mD2[3]));
+		}
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator* (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<double, 8>(_mm_mul_pd(mD2[0], rhs.mD2[0]), _mm_mul_pd(mD2[1], rhs.mD2[1]), _mm_mul_pd(mD2[2], rhs.mD2[2]), _mm_mul_pd(mD2[3], rhs.mD2[3]));
+		}
+		VCL_STRONG_INLINE VectorScalar<double, 8> operator/ (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<double, 8>(_mm_div_pd(mD2[0], rhs.mD2[0]), _mm_div_pd(mD2[1], rhs.mD2[1]), _mm_div_pd(mD2[2], rhs.mD2[2]), _mm_div_pd(mD2[3], rhs.mD2[3]));
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator += (const VectorScalar<double, 8>& rhs) { return *this = *this + rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator -= (const VectorScalar<double, 8>& rhs) { return *this = *this - rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator *= (const VectorScalar<double, 8>& rhs) { return *this = *this * rhs; }
+		VCL_STRONG_INLINE VectorScalar<double, 8>& operator /= (const VectorScalar<double, 8>& rhs) { return *this = *this / rhs; }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator== (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<bool, 8>
+			(
+				_mmVCL_pack_mask_pd(_mm_cmpeq_pd(mD2[0], rhs.mD2[0]), _mm_cmpeq_pd(mD2[1], rhs.mD2[1])),
+				_mmVCL_pack_mask_pd(_mm_cmpeq_pd(mD2[2], rhs.mD2[2]), _mm_cmpeq_pd(mD2[3], rhs.mD2[3]))
+			);
+		}
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator!= (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<bool, 8>
+			(
+				_mmVCL_pack_mask_pd(_mm_cmpneq_pd(mD2[0], rhs.mD2[0]), _mm_cmpneq_pd(mD2[1], rhs.mD2[1])),
+				_mmVCL_pack_mask_pd(_mm_cmpneq_pd(mD2[2], rhs.mD2[2]), _mm_cmpneq_pd(mD2[3], rhs.mD2[3]))
+			);
+		}
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator< (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<bool, 8>
+			(
+				_mmVCL_pack_mask_pd(_mm_cmplt_pd(mD2[0], rhs.mD2[0]), _mm_cmplt_pd(mD2[1], rhs.mD2[1])),
+				_mmVCL_pack_mask_pd(_mm_cmplt_pd(mD2[2], rhs.mD2[2]), _mm_cmplt_pd(mD2[3], rhs.mD2[3]))
+			);
+		}
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator<= (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<bool, 8>
+			(
+				_mmVCL_pack_mask_pd(_mm_cmple_pd(mD2[0], rhs.mD2[0]), _mm_cmple_pd(mD2[1], rhs.mD2[1])),
+				_mmVCL_pack_mask_pd(_mm_cmple_pd(mD2[2], rhs.mD2[2]), _mm_cmple_pd(mD2[3], rhs.mD2[3]))
+			);
+		}
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator> (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<bool, 8>
+			(
+				_mmVCL_pack_mask_pd(_mm_cmpgt_pd(mD2[0], rhs.mD2[0]), _mm_cmpgt_pd(mD2[1], rhs.mD2[1])),
+				_mmVCL_pack_mask_pd(_mm_cmpgt_pd(mD2[2], rhs.mD2[2]), _mm_cmpgt_pd(mD2[3], rhs.mD2[3]))
+			);
+		}
+		VCL_STRONG_INLINE VectorScalar<bool, 8> operator>= (const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<bool, 8>
+			(
+				_mmVCL_pack_mask_pd(_mm_cmpge_pd(mD2[0], rhs.mD2[0]), _mm_cmpge_pd(mD2[1], rhs.mD2[1])),
+				_mmVCL_pack_mask_pd(_mm_cmpge_pd(mD2[2], rhs.mD2[2]), _mm_cmpge_pd(mD2[3], rhs.mD2[3]))
+			);
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> abs()   const { return VectorScalar<double, 8>(_mm_abs_pd (mD2[0]), _mm_abs_pd (mD2[1]), _mm_abs_pd (mD2[2]), _mm_abs_pd (mD2[3])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> sgn()   const { return VectorScalar<double, 8>(_mm_sgn_pd (mD2[0]), _mm_sgn_pd (mD2[1]), _mm_sgn_pd (mD2[2]), _mm_sgn_pd (mD2[3])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> sqrt()  const { return VectorScalar<double, 8>(_mm_sqrt_pd(mD2[0]), _mm_sqrt_pd(mD2[1]), _mm_sqrt_pd(mD2[2]), _mm_sqrt_pd(mD2[3])); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> rcp()   const { return VectorScalar<double, 8>(1.0) / *this; }
+		VCL_STRONG_INLINE VectorScalar<double, 8> rsqrt() const { return VectorScalar<double, 8>(1.0) / sqrt(); }
+
+		// There are no vectorized double precision transcendentals, evaluate per lane
+		VCL_STRONG_INLINE VectorScalar<double, 8> sin()  const { return map([](double x) { return std::sin(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> cos()  const { return map([](double x) { return std::cos(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> exp()  const { return map([](double x) { return std::exp(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> log()  const { return map([](double x) { return std::log(x); }); }
+		VCL_STRONG_INLINE VectorScalar<double, 8> acos() const { return map([](double x) { return std::acos(x); }); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<double, 8> min(const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<double, 8>(_mm_min_pd(mD2[0], rhs.mD2[0]), _mm_min_pd(mD2[1], rhs.mD2[1]), _mm_min_pd(mD2[2], rhs.mD2[2]), _mm_min_pd(mD2[3], rhs.mD2[3]));
+		}
+		VCL_STRONG_INLINE VectorScalar<double, 8> max(const VectorScalar<double, 8>& rhs) const
+		{
+			return VectorScalar<double, 8>(_mm_max_pd(mD2[0], rhs.mD2[0]), _mm_max_pd(mD2[1], rhs.mD2[1]), _mm_max_pd(mD2[2], rhs.mD2[2]), _mm_max_pd(mD2[3], rhs.mD2[3]));
+		}
+
+		VCL_STRONG_INLINE double min() const { return _mmVCL_hmin_pd(_mm_min_pd(_mm_min_pd(mD2[0], mD2[1]), _mm_min_pd(mD2[2], mD2[3]))); }
+		VCL_STRONG_INLINE double max() const { return _mmVCL_hmax_pd(_mm_max_pd(_mm_max_pd(mD2[0], mD2[1]), _mm_max_pd(mD2[2], mD2[3]))); }
+
+	public:
+		friend std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 8>& rhs);
+		friend VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b);
+
+	private:
+		template<typename Func>
+		VCL_STRONG_INLINE VectorScalar<double, 8> map(Func f) const
+		{
+			VCL_ALIGN(16) double vars[8];
+			_mm_store_pd(vars + 0, mD2[0]);
+			_mm_store_pd(vars + 2, mD2[1]);
+			_mm_store_pd(vars + 4, mD2[2]);
+			_mm_store_pd(vars + 6, mD2[3]);
+
+			return VectorScalar<double, 8>(f(vars[0]), f(vars[1]), f(vars[2]), f(vars[3]), f(vars[4]), f(vars[5]), f(vars[6]), f(vars[7]));
+		}
+
+	private:
+		__m128d mD2[4];
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b)
+	{
+		return VectorScalar<double, 8>
+		(
+			_mmVCL_blend_pd(b.mD2[0], a.mD2[0], _mmVCL_unpacklo_mask_ps(mask.mF4[0])),
+			_mmVCL_blend_pd(b.mD2[1], a.mD2[1], _mmVCL_unpackhi_mask_ps(mask.mF4[0])),
+			_mmVCL_blend_pd(b.mD2[2], a.mD2[2], _mmVCL_unpacklo_mask_ps(mask.mF4[1])),
+			_mmVCL_blend_pd(b.mD2[3], a.mD2[3], _mmVCL_unpackhi_mask_ps(mask.mF4[1]))
+		);
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<< (std::ostream &s, const VectorScalar<double, 8>& rhs)
+	{
+		VCL_ALIGN(16) double vars[8];
+		_mm_store_pd(vars + 0, rhs.mD2[0]);
+		_mm_store_pd(vars + 2, rhs.mD2[1]);
+		_mm_store_pd(vars + 4, rhs.mD2[2]);
+		_mm_store_pd(vars + 6, rhs.mD2[3]);
+
+		s << "'" << vars[0] << ", " << vars[1] << ", " << vars[2] << ", " << vars[3] << ", "
+		         << vars[4] << ", " << vars[5] << ", " << vars[6] << ", " << vars[7] << "'";
+		return s;
+	}
+}}
@@ -36,7 +36,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_avx.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<float, 16>
@@ -246,4 +246,4 @@ namespace Vcl
 			_mm256_blendv_ps(b.mF8[1], a.mF8[1], mask.mF8[1])
 		);
 	}
-}
+}}
@@ -0,0 +1,168 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+
+// VCL 
+#include <vcl/core/simd/bool16_avx512.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/intrinsics_avx512.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<float, 16>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() = default;
+		VCL_STRONG_INLINE VectorScalar(float s)
+		{
+			mF16 = _mm512_set1_ps(s);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar
+		(
+			float s00, float s01, float s02, float s03, float s04, float s05, float s06, float s07,
+			float s08, float s09, float s10, float s11, float s12, float s13, float s14, float s15
+		)
+		{
+			mF16 = _mm512_set_ps(s15, s14, s13, s12, s11, s10, s09, s08, s07, s06, s05, s04, s03, s02, s01, s00);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar(__m512 F16) : mF16(F16) {}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<float, 16>& operator = (const VectorScalar<float, 16>& rhs)
+		{
+			mF16 = rhs.mF16;
+
+			return *this;
+		}
+
+	public:
+		VCL_STRONG_INLINE float operator[] (int idx) const
+		{
+			Require(0 <= idx && idx < 16, "Access is in range.");
+
+			return _mmVCL_extract_ps(mF16, idx);
+		}
+
+		VCL_STRONG_INLINE explicit operator __m512() const
+		{
+			return mF16;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<float, 16> operator- () const
+		{
+			return VectorScalar<float, 16>(_mm512_xor_ps(mF16, _mm512_castsi512_ps(_mm512_set1_epi32(0x80000000))));
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<float, 16> operator+ (const VectorScalar<float, 16>& rhs) const { return VectorScalar<float, 16>(_mm512_add_ps(mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> operator- (const VectorScalar<float, 16>& rhs) const { return VectorScalar<float, 16>(_mm512_sub_ps(mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> operator* (const VectorScalar<float, 16>& rhs) const { return VectorScalar<float, 16>(_mm512_mul_ps(mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> operator/ (const VectorScalar<float, 16>& rhs) const { return VectorScalar<float, 16>(_mm512_div_ps(mF16, rhs.mF16)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<float, 16>& operator += (const VectorScalar<float, 16>& rhs)
+		{
+			mF16 = _mm512_add_ps(mF16, rhs.mF16);
+			return *this;
+		}
+		VCL_STRONG_INLINE VectorScalar<float, 16>& operator -= (const VectorScalar<float, 16>& rhs)
+		{
+			mF16 = _mm512_sub_ps(mF16, rhs.mF16);
+			return *this;
+		}
+		VCL_STRONG_INLINE VectorScalar<float, 16>& operator *= (const VectorScalar<float, 16>& rhs)
+		{
+			mF16 = _mm512_mul_ps(mF16, rhs.mF16);
+			return *this;
+		}
+		VCL_STRONG_INLINE VectorScalar<float, 16>& operator /= (const VectorScalar<float, 16>& rhs)
+		{
+			mF16 = _mm512_div_ps(mF16, rhs.mF16);
+			return *this;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator== (const VectorScalar<float, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmpeq_ps (mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator!= (const VectorScalar<float, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmpneq_ps(mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator<  (const VectorScalar<float, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmplt_ps (mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator<= (const VectorScalar<float, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmple_ps (mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator>  (const VectorScalar<float, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmpgt_ps (mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator>= (const VectorScalar<float, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmpge_ps (mF16, rhs.mF16)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<float, 16> abs()   const { return VectorScalar<float, 16>(_mm512_abs_ps  (mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> sin()   const { return VectorScalar<float, 16>(_mm512_sin_ps  (mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> cos()   const { return VectorScalar<float, 16>(_mm512_cos_ps  (mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> exp()   const { return VectorScalar<float, 16>(_mm512_exp_ps  (mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> log()   const { return VectorScalar<float, 16>(_mm512_log_ps  (mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> sgn()   const { return VectorScalar<float, 16>(_mm512_sgn_ps  (mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> sqrt()  const { return VectorScalar<float, 16>(_mm512_sqrt_ps (mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> rcp()   const { return VectorScalar<float, 16>(_mmVCL_rcp_ps  (mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> rsqrt() const { return VectorScalar<float, 16>(_mmVCL_rsqrt_ps(mF16)); }
+
+		VCL_STRONG_INLINE VectorScalar<float, 16> acos() const { return VectorScalar<float, 16>(_mm512_acos_ps(mF16)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<float, 16> min(const VectorScalar<float, 16>& rhs) const { return VectorScalar<float, 16>(_mm512_min_ps(mF16, rhs.mF16)); }
+		VCL_STRONG_INLINE VectorScalar<float, 16> max(const VectorScalar<float, 16>& rhs) const { return VectorScalar<float, 16>(_mm512_max_ps(mF16, rhs.mF16)); }
+
+		VCL_STRONG_INLINE float min() const { return _mmVCL_hmin_ps(mF16); }
+		VCL_STRONG_INLINE float max() const { return _mmVCL_hmax_ps(mF16); }
+
+	public:
+		friend std::ostream& operator<< (std::ostream &s, const VectorScalar<float, 16>& rhs);
+		friend VectorScalar<float, 16> select(const VectorScalar<bool, 16>& mask, const VectorScalar<float, 16>& a, const VectorScalar<float, 16>& b);
+
+	private:
+		__m512 mF16;
+	};
+
+	VCL_STRONG_INLINE std::ostream& operator<< (std::ostream &s, const VectorScalar<float, 16>& rhs)
+	{
+		float VCL_ALIGN(64) vars[16];
+		_mm512_store_ps(vars, rhs.mF16);
+
+		s << "'" << vars[ 0] << ", " << vars[ 1] << ", " << vars[ 2] << ", " << vars[ 3] << ", "
+		         << vars[ 4] << ", " << vars[ 5] << ", " << vars[ 6] << ", " << vars[ 7] << ", "
+		         << vars[ 8] << ", " << vars[ 9] << ", " << vars[10] << ", " << vars[11] << ", "
+		         << vars[12] << ", " << vars[13] << ", " << vars[14] << ", " << vars[15] << "'";
+
+		return s;
+	}
+
+	VCL_STRONG_INLINE VectorScalar<float, 16> select(const VectorScalar<bool, 16>& mask, const VectorScalar<float, 16>& a, const VectorScalar<float, 16>& b)
+	{
+		return VectorScalar<float, 16>(_mm512_mask_blend_ps(mask.mMask, b.mF16, a.mF16));
+	}
+}}
@@ -36,7 +36,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_neon.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<float, 16>
@@ -359,4 +359,4 @@ namespace Vcl
 			vbslq_f32(mask.mF4[3], a.get(3), b.get(3))
 		);
 	}
-}
+}}
@@ -36,7 +36,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_sse.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<float, 16>
@@ -342,4 +342,4 @@ namespace Vcl
 		);
 #endif
 	}
-}
+}}
@@ -36,7 +36,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_neon.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<float, 8>
@@ -279,4 +279,4 @@ namespace Vcl
 			vbslq_f32(mask.mF4[1], a.get(1), b.get(1))
 		);
 	}
-}
+}}
@@ -0,0 +1,217 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/simd/instructionset.h>
+
+// C++ standard library
+#include <atomic>
+
+// Platform specific processor queries
+#if defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)
+#	if defined(VCL_COMPILER_MSVC)
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#endif
+
+namespace Vcl
+{
+	namespace
+	{
+#if defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)
+		struct CpuIdRegisters
+		{
+			unsigned int eax{ 0 };
+			unsigned int ebx{ 0 };
+			unsigned int ecx{ 0 };
+			unsigned int edx{ 0 };
+		};
+
+		CpuIdRegisters cpuid(unsigned int leaf, unsigned int subleaf)
+		{
+			CpuIdRegisters regs;
+#	if defined(VCL_COMPILER_MSVC)
+			int info[4];
+			__cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+			regs.eax = info[0];
+			regs.ebx = info[1];
+			regs.ecx = info[2];
+			regs.edx = info[3];
+#	else
+			__cpuid_count(leaf, subleaf, regs.eax, regs.ebx, regs.ecx, regs.edx);
+#	endif
+			return regs;
+		}
+
+		unsigned long long xgetbv(unsigned int index)
+		{
+#	if defined(VCL_COMPILER_MSVC)
+			return _xgetbv(index);
+#	else
+			// Use the instruction directly as '_xgetbv' requires -mxsave
+			unsigned int eax, edx;
+			__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+			return (static_cast<unsigned long long>(edx) << 32) | eax;
+#	endif
+		}
+
+		InstructionSet detectInstructionSet()
+		{
+			const unsigned int max_leaf = cpuid(0, 0).eax;
+			if (max_leaf < 1)
+				return InstructionSet::Scalar;
+
+			const auto leaf1 = cpuid(1, 0);
+			const auto leaf7 = max_leaf >= 7 ? cpuid(7, 0) : CpuIdRegisters{};
+
+			const bool sse2   = (leaf1.edx & (1u << 26)) != 0;
+			const bool sse3   = (leaf1.ecx & (1u <<  0)) != 0;
+			const bool ssse3  = (leaf1.ecx & (1u <<  9)) != 0;
+			const bool sse4_1 = (leaf1.ecx & (1u << 19)) != 0;
+			const bool sse4_2 = (leaf1.ecx & (1u << 20)) != 0;
+			const bool fma    = (leaf1.ecx & (1u << 12)) != 0;
+			const bool avx    = (leaf1.ecx & (1u << 28)) != 0;
+			const bool avx2   = (leaf7.ebx & (1u <<  5)) != 0;
+
+			// AVX-512 subsets used by the 16-wide kernels
+			const bool avx512f  = (leaf7.ebx & (1u << 16)) != 0;
+			const bool avx512dq = (leaf7.ebx & (1u << 17)) != 0;
+			const bool avx512cd = (leaf7.ebx & (1u << 28)) != 0;
+			const bool avx512bw = (leaf7.ebx & (1u << 30)) != 0;
+			const bool avx512vl = (leaf7.ebx & (1u << 31)) != 0;
+
+			// The operating system has to save the extended register state
+			const bool osxsave = (leaf1.ecx & (1u << 27)) != 0;
+			const unsigned long long xcr0 = osxsave ? xgetbv(0) : 0;
+			const bool os_avx    = (xcr0 & 0x06) == 0x06;
+			const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+
+			if (os_avx512 && avx2 && fma && avx512f && avx512dq && avx512cd && avx512bw && avx512vl)
+				return InstructionSet::AVX512;
+			if (os_avx && avx2 && fma)
+				return InstructionSet::AVX2;
+			if (os_avx && avx)
+				return InstructionSet::AVX;
+			if (sse4_2)
+				return InstructionSet::SSE4_2;
+			if (sse4_1)
+				return InstructionSet::SSE4_1;
+			if (ssse3)
+				return InstructionSet::SSSE3;
+			if (sse3)
+				return InstructionSet::SSE3;
+			if (sse2)
+				return InstructionSet::SSE2;
+
+			return InstructionSet::Scalar;
+		}
+#else
+		InstructionSet detectInstructionSet()
+		{
+			return compiledInstructionSet();
+		}
+#endif
+
+		//! Marks that the runtime dispatched kernels are not restricted
+		const int NoInstructionSetLimit = -1;
+
+		std::atomic<int> InstructionSetLimit{ NoInstructionSetLimit };
+	}
+
+	InstructionSet compiledInstructionSet()
+	{
+#if defined(VCL_VECTORIZE_AVX512)
+		return InstructionSet::AVX512;
+#elif defined(VCL_VECTORIZE_AVX2)
+		return InstructionSet::AVX2;
+#elif defined(VCL_VECTORIZE_AVX)
+		return InstructionSet::AVX;
+#elif defined(VCL_VECTORIZE_SSE4_2)
+		return InstructionSet::SSE4_2;
+#elif defined(VCL_VECTORIZE_SSE4_1)
+		return InstructionSet::SSE4_1;
+#elif defined(VCL_VECTORIZE_SSSE3)
+		return InstructionSet::SSSE3;
+#elif defined(VCL_VECTORIZE_SSE3)
+		return InstructionSet::SSE3;
+#elif defined(VCL_VECTORIZE_SSE2)
+		return InstructionSet::SSE2;
+#elif defined(VCL_VECTORIZE_NEON)
+		return InstructionSet::NEON;
+#else
+		return InstructionSet::Scalar;
+#endif
+	}
+
+	InstructionSet hostInstructionSet()
+	{
+		static const InstructionSet isa = detectInstructionSet();
+		return isa;
+	}
+
+	InstructionSet activeInstructionSet()
+	{
+		const InstructionSet host = hostInstructionSet();
+		const int limit = InstructionSetLimit.load(std::memory_order_relaxed);
+		if (limit == NoInstructionSetLimit)
+			return host;
+
+		// NEON and the x86 instruction sets only share the scalar fallback
+		const InstructionSet isa = static_cast<InstructionSet>(limit);
+		if (host == InstructionSet::NEON || isa == InstructionSet::NEON)
+			return isa == InstructionSet::Scalar ? InstructionSet::Scalar : host;
+
+		return static_cast<int>(host) < limit ? host : isa;
+	}
+
+	void setInstructionSetLimit(InstructionSet limit)
+	{
+		InstructionSetLimit.store(static_cast<int>(limit), std::memory_order_relaxed);
+	}
+
+	void resetInstructionSetLimit()
+	{
+		InstructionSetLimit.store(NoInstructionSetLimit, std::memory_order_relaxed);
+	}
+
+	const char* name(InstructionSet isa)
+	{
+		switch (isa)
+		{
+		case InstructionSet::Scalar: return "Scalar";
+		case InstructionSet::SSE2:   return "SSE2";
+		case InstructionSet::SSE3:   return "SSE3";
+		case InstructionSet::SSSE3:  return "SSSE3";
+		case InstructionSet::SSE4_1: return "SSE4.1";
+		case InstructionSet::SSE4_2: return "SSE4.2";
+		case InstructionSet::AVX:    return "AVX";
+		case InstructionSet::AVX2:   return "AVX2";
+		case InstructionSet::AVX512: return "AVX512";
+		case InstructionSet::NEON:   return "NEON";
+		}
+
+		return "Unknown";
+	}
+}
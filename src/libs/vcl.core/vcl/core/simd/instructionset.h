@@ -0,0 +1,86 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+namespace Vcl
+{
+	/*!
+	 *	\brief Instruction sets the SIMD kernels can be compiled for
+	 *
+	 *	The values are ordered such that a later instruction set includes
+	 *	all the earlier x86 ones.
+	 */
+	enum class InstructionSet
+	{
+		Scalar = 0,
+		SSE2,
+		SSE3,
+		SSSE3,
+		SSE4_1,
+		SSE4_2,
+		AVX,
+		AVX2,
+		AVX512,
+		NEON
+	};
+
+	/*!
+	 *	\returns the instruction set the library was configured with
+	 *			 using the VCL_VECTORIZE_* options.
+	 */
+	InstructionSet compiledInstructionSet();
+
+	/*!
+	 *	\returns the widest instruction set supported by the processor and
+	 *			 the operating system. The value is determined on first use.
+	 */
+	InstructionSet hostInstructionSet();
+
+	/*!
+	 *	\returns the instruction set runtime dispatched kernels are selected for.
+	 *			 This is the host instruction set clamped to the limit set
+	 *			 using \a setInstructionSetLimit.
+	 */
+	InstructionSet activeInstructionSet();
+
+	/*!
+	 *	\brief Restrict the kernels selected at runtime
+	 *
+	 *	Allows to compare the different kernel implementations on a single
+	 *	machine. The limit cannot extend the set beyond the host capabilities.
+	 *	NEON is not ordered with respect to the x86 instruction sets, thus on
+	 *	a NEON host only a limit of \a InstructionSet::Scalar has an effect.
+	 */
+	void setInstructionSetLimit(InstructionSet limit);
+
+	//! Remove the limit set using \a setInstructionSetLimit
+	void resetInstructionSetLimit();
+
+	//! \returns a readable name of the instruction set
+	const char* name(InstructionSet isa);
+}
@@ -35,7 +35,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_avx.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<int, 16>
@@ -224,4 +224,4 @@ namespace Vcl
 
 		return s;
 	}
-}
+}}
@@ -0,0 +1,130 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ Standard Library
+#include <array>
+
+// VCL 
+#include <vcl/core/simd/bool16_avx512.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/intrinsics_avx512.h>
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
+{
+	template<>
+	class VectorScalar<int, 16>
+	{
+	public:
+		VCL_STRONG_INLINE VectorScalar() {}
+		VCL_STRONG_INLINE VectorScalar(int s)
+		{
+			mI16 = _mm512_set1_epi32(s);
+		}
+		explicit VCL_STRONG_INLINE VectorScalar
+		(
+			int s00, int s01, int s02, int s03, int s04, int s05, int s06, int s07,
+			int s08, int s09, int s10, int s11, int s12, int s13, int s14, int s15
+		)
+		{
+			mI16 = _mm512_set_epi32(s15, s14, s13, s12, s11, s10, s09, s08, s07, s06, s05, s04, s03, s02, s01, s00);
+		}
+		VCL_STRONG_INLINE explicit VectorScalar(__m512i I16) : mI16(I16) {}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<int, 16>& operator = (const VectorScalar<int, 16>& rhs)
+		{
+			mI16 = rhs.mI16;
+
+			return *this;
+		}
+
+	public:
+		VCL_STRONG_INLINE int operator[] (int idx) const
+		{
+			Require(0 <= idx && idx < 16, "Access is in range.");
+
+			return _mmVCL_extract_epi32(mI16, idx);
+		}
+
+		VCL_STRONG_INLINE explicit operator __m512i() const
+		{
+			return mI16;
+		}
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<int, 16> operator+ (const VectorScalar<int, 16>& rhs) const { return VectorScalar<int, 16>(_mm512_add_epi32  (mI16, rhs.mI16)); }
+		VCL_STRONG_INLINE VectorScalar<int, 16> operator- (const VectorScalar<int, 16>& rhs) const { return VectorScalar<int, 16>(_mm512_sub_epi32  (mI16, rhs.mI16)); }
+		VCL_STRONG_INLINE VectorScalar<int, 16> operator* (const VectorScalar<int, 16>& rhs) const { return VectorScalar<int, 16>(_mm512_mullo_epi32(mI16, rhs.mI16)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<int, 16> abs() const { return VectorScalar<int, 16>(_mm512_abs_epi32(mI16)); }
+		VCL_STRONG_INLINE VectorScalar<int, 16> max(const VectorScalar<int, 16>& rhs) const { return VectorScalar<int, 16>(_mm512_max_epi32(mI16, rhs.mI16)); }
+
+	public:
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator== (const VectorScalar<int, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmpeq_epi32_mask(mI16, rhs.mI16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator<  (const VectorScalar<int, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmplt_epi32_mask(mI16, rhs.mI16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator<= (const VectorScalar<int, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmple_epi32_mask(mI16, rhs.mI16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator>  (const VectorScalar<int, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmpgt_epi32_mask(mI16, rhs.mI16)); }
+		VCL_STRONG_INLINE VectorScalar<bool, 16> operator>= (const VectorScalar<int, 16>& rhs) const { return VectorScalar<bool, 16>(_mm512_cmpge_epi32_mask(mI16, rhs.mI16)); }
+
+	public:
+		friend std::ostream& operator<< (std::ostream &s, const VectorScalar<int, 16>& rhs);
+		friend VectorScalar<int, 16> select(const VectorScalar<bool, 16>& mask, const VectorScalar<int, 16>& a, const VectorScalar<int, 16>& b);
+		friend VectorScalar<int, 16> signum(const VectorScalar<int, 16>& a);
+
+	private:
+		__m512i mI16;
+	};
+	
+	VCL_STRONG_INLINE VectorScalar<int, 16> select(const VectorScalar<bool, 16>& mask, const VectorScalar<int, 16>& a, const VectorScalar<int, 16>& b)
+	{
+		return VectorScalar<int, 16>(_mm512_mask_blend_epi32(mask.mMask, b.mI16, a.mI16));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<int, 16> signum(const VectorScalar<int, 16>& a)
+	{
+		const __mmask16 nonzero = _mm512_test_epi32_mask(a.mI16, a.mI16);
+		const __m512i sign = _mm512_srai_epi32(a.mI16, 31);
+
+		return VectorScalar<int, 16>(_mm512_maskz_mov_epi32(nonzero, _mm512_or_si512(sign, _mm512_set1_epi32(1))));
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<< (std::ostream &s, const VectorScalar<int, 16>& rhs)
+	{
+		int VCL_ALIGN(64) vars[16];
+		_mm512_store_si512(vars, rhs.mI16);
+
+		s << "'" << vars[ 0] << ", " << vars[ 1] << ", " << vars[ 2] << ", " << vars[ 3] << ", "
+		         << vars[ 4] << ", " << vars[ 5] << ", " << vars[ 6] << ", " << vars[ 7] << ", "
+		         << vars[ 8] << ", " << vars[ 9] << ", " << vars[10] << ", " << vars[11] << ", "
+		         << vars[12] << ", " << vars[13] << ", " << vars[14] << ", " << vars[15] << "'";
+
+		return s;
+	}
+}}
@@ -35,7 +35,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_neon.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<int, 16>
@@ -160,8 +160,8 @@ namespace Vcl
 			(
 				vceqq_s32(mF4[0], rhs.mF4[0]),
 				vceqq_s32(mF4[1], rhs.mF4[1]),
-				vceqq_s32(mF4[0], rhs.mF4[2]),
-				vceqq_s32(mF4[1], rhs.mF4[3])
+				vceqq_s32(mF4[2], rhs.mF4[2]),
+				vceqq_s32(mF4[3], rhs.mF4[3])
 			);
 		}
 
@@ -171,8 +171,8 @@ namespace Vcl
 			(
 				vcltq_s32(mF4[0], rhs.mF4[0]),
 				vcltq_s32(mF4[1], rhs.mF4[1]),
-				vcltq_s32(mF4[0], rhs.mF4[2]),
-				vcltq_s32(mF4[1], rhs.mF4[3])
+				vcltq_s32(mF4[2], rhs.mF4[2]),
+				vcltq_s32(mF4[3], rhs.mF4[3])
 			);
 		}
 		VCL_STRONG_INLINE VectorScalar<bool, 16> operator<= (const VectorScalar<int, 16>& rhs) const
@@ -181,8 +181,8 @@ namespace Vcl
 			(
 				vcleq_s32(mF4[0], rhs.mF4[0]),
 				vcleq_s32(mF4[1], rhs.mF4[1]),
-				vcleq_s32(mF4[0], rhs.mF4[2]),
-				vcleq_s32(mF4[1], rhs.mF4[3])
+				vcleq_s32(mF4[2], rhs.mF4[2]),
+				vcleq_s32(mF4[3], rhs.mF4[3])
 			);
 		}
 		VCL_STRONG_INLINE VectorScalar<bool, 16> operator> (const VectorScalar<int, 16>& rhs) const
@@ -191,8 +191,8 @@ namespace Vcl
 			(
 				vcgtq_s32(mF4[0], rhs.mF4[0]),
 				vcgtq_s32(mF4[1], rhs.mF4[1]),
-				vcgtq_s32(mF4[0], rhs.mF4[2]),
-				vcgtq_s32(mF4[1], rhs.mF4[3])
+				vcgtq_s32(mF4[2], rhs.mF4[2]),
+				vcgtq_s32(mF4[3], rhs.mF4[3])
 			);
 		}
 		VCL_STRONG_INLINE VectorScalar<bool, 16> operator>= (const VectorScalar<int, 16>& rhs) const
@@ -201,8 +201,8 @@ namespace Vcl
 			(
 				vcgeq_s32(mF4[0], rhs.mF4[0]),
 				vcgeq_s32(mF4[1], rhs.mF4[1]),
-				vcgeq_s32(mF4[0], rhs.mF4[2]),
-				vcgeq_s32(mF4[1], rhs.mF4[3])
+				vcgeq_s32(mF4[2], rhs.mF4[2]),
+				vcgeq_s32(mF4[3], rhs.mF4[3])
 			);
 		}
 		
@@ -299,4 +299,4 @@ namespace Vcl
 
 		return s;
 	}
-}
+}}
@@ -35,7 +35,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_sse.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<int, 16>
@@ -155,8 +155,8 @@ namespace Vcl
 			(
 				_mm_cmpeq_epi32(mF4[0], rhs.mF4[0]),
 				_mm_cmpeq_epi32(mF4[1], rhs.mF4[1]),
-				_mm_cmpeq_epi32(mF4[0], rhs.mF4[2]),
-				_mm_cmpeq_epi32(mF4[1], rhs.mF4[3])
+				_mm_cmpeq_epi32(mF4[2], rhs.mF4[2]),
+				_mm_cmpeq_epi32(mF4[3], rhs.mF4[3])
 			);
 		}
 
@@ -166,8 +166,8 @@ namespace Vcl
 			(
 				_mm_cmplt_epi32(mF4[0], rhs.mF4[0]),
 				_mm_cmplt_epi32(mF4[1], rhs.mF4[1]),
-				_mm_cmplt_epi32(mF4[0], rhs.mF4[2]),
-				_mm_cmplt_epi32(mF4[1], rhs.mF4[3])
+				_mm_cmplt_epi32(mF4[2], rhs.mF4[2]),
+				_mm_cmplt_epi32(mF4[3], rhs.mF4[3])
 			);
 		}
 		VCL_STRONG_INLINE VectorScalar<bool, 16> operator<= (const VectorScalar<int, 16>& rhs) const
@@ -176,8 +176,8 @@ namespace Vcl
 			(
 				_mm_cmple_epi32(mF4[0], rhs.mF4[0]),
 				_mm_cmple_epi32(mF4[1], rhs.mF4[1]),
-				_mm_cmple_epi32(mF4[0], rhs.mF4[2]),
-				_mm_cmple_epi32(mF4[1], rhs.mF4[3])
+				_mm_cmple_epi32(mF4[2], rhs.mF4[2]),
+				_mm_cmple_epi32(mF4[3], rhs.mF4[3])
 			);
 		}
 		VCL_STRONG_INLINE VectorScalar<bool, 16> operator> (const VectorScalar<int, 16>& rhs) const
@@ -186,8 +186,8 @@ namespace Vcl
 			(
 				_mm_cmpgt_epi32(mF4[0], rhs.mF4[0]),
 				_mm_cmpgt_epi32(mF4[1], rhs.mF4[1]),
-				_mm_cmpgt_epi32(mF4[0], rhs.mF4[2]),
-				_mm_cmpgt_epi32(mF4[1], rhs.mF4[3])
+				_mm_cmpgt_epi32(mF4[2], rhs.mF4[2]),
+				_mm_cmpgt_epi32(mF4[3], rhs.mF4[3])
 			);
 		}
 		VCL_STRONG_INLINE VectorScalar<bool, 16> operator>= (const VectorScalar<int, 16>& rhs) const
@@ -196,8 +196,8 @@ namespace Vcl
 			(
 				_mm_cmpge_epi32(mF4[0], rhs.mF4[0]),
 				_mm_cmpge_epi32(mF4[1], rhs.mF4[1]),
-				_mm_cmpge_epi32(mF4[0], rhs.mF4[2]),
-				_mm_cmpge_epi32(mF4[1], rhs.mF4[3])
+				_mm_cmpge_epi32(mF4[2], rhs.mF4[2]),
+				_mm_cmpge_epi32(mF4[3], rhs.mF4[3])
 			);
 		}
 
@@ -273,4 +273,4 @@ namespace Vcl
 
 		return s;
 	}
-}
+}}
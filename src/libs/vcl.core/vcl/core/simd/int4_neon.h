@@ -32,7 +32,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_neon.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<int, 4>
@@ -165,4 +165,4 @@ namespace Vcl
 
 		return s;
 	}
-}
+}}
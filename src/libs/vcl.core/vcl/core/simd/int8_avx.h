@@ -32,7 +32,7 @@
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_avx.h>
 
-namespace Vcl
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<>
 	class VectorScalar<int, 8>
@@ -166,4 +166,4 @@ namespace Vcl
 
 		return s;
 	}
-}
+}}
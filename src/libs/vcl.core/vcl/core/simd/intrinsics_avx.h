@@ -483,5 +483,46 @@ namespace Vcl
 		return dest;
 #endif
 	}
+
+	VCL_STRONG_INLINE __m256d _mm256_abs_pd(__m256d v)
+	{
+		return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v);
+	}
+
+	VCL_STRONG_INLINE __m256d _mm256_sgn_pd(__m256d v)
+	{
+		return _mm256_and_pd(_mm256_or_pd(_mm256_and_pd(v, _mm256_set1_pd(-0.0)), _mm256_set1_pd(1.0)), _mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_NEQ_OQ));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmin_pd(__m256d v)
+	{
+		return _mmVCL_hmin_pd(_mm_min_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmax_pd(__m256d v)
+	{
+		return _mmVCL_hmax_pd(_mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_extract_pd(__m256d v, int i)
+	{
+		typedef union
+		{
+			__m256d x;
+			double a[4];
+		} F64;
+
+		return F64{ v }.a[i];
+	}
+
+	// Convert a 4-lane double mask to a 4-lane float mask and back
+	VCL_STRONG_INLINE __m128 _mmVCL_pack_mask_pd(__m256d m)
+	{
+		return _mmVCL_pack_mask_pd(_mm256_castpd256_pd128(m), _mm256_extractf128_pd(m, 1));
+	}
+	VCL_STRONG_INLINE __m256d _mmVCL_unpack_mask_ps(__m128 m)
+	{
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mmVCL_unpacklo_mask_ps(m)), _mmVCL_unpackhi_mask_ps(m), 1);
+	}
 }
 #endif // VCL_VECTORIZE_AVX
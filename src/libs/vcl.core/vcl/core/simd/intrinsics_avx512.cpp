@@ -0,0 +1,258 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/simd/intrinsics_avx512.h>
+
+#ifdef VCL_VECTORIZE_AVX512
+
+// VCL
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/bool16_avx512.h>
+#include <vcl/core/simd/float16_avx512.h>
+
+namespace Vcl
+{
+	namespace
+	{
+		// The polynomial approximations of sin, cos, exp and log are the
+		// cephes single precision versions also used in avx_mathfun.h.
+		// The branch selection uses mask registers instead of bit masks.
+		VCL_STRONG_INLINE __m512 _mmVCL_sincos_ps(__m512 x, __m512 y, __mmask16 poly_mask, __m512 sign_bit)
+		{
+			// Extended precision modular arithmetic
+			x = _mm512_fmadd_ps(y, _mm512_set1_ps(-0.78515625f), x);
+			x = _mm512_fmadd_ps(y, _mm512_set1_ps(-2.4187564849853515625e-4f), x);
+			x = _mm512_fmadd_ps(y, _mm512_set1_ps(-3.77489497744594108e-8f), x);
+
+			const __m512 z = _mm512_mul_ps(x, x);
+
+			// Polynomial for 0 <= x <= Pi/4 of the cosine
+			__m512 y1 = _mm512_set1_ps(2.443315711809948E-005f);
+			y1 = _mm512_fmadd_ps(y1, z, _mm512_set1_ps(-1.388731625493765E-003f));
+			y1 = _mm512_fmadd_ps(y1, z, _mm512_set1_ps(4.166664568298827E-002f));
+			y1 = _mm512_mul_ps(_mm512_mul_ps(y1, z), z);
+			y1 = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y1);
+			y1 = _mm512_add_ps(y1, _mm512_set1_ps(1.0f));
+
+			// Polynomial for 0 <= x <= Pi/4 of the sine
+			__m512 y2 = _mm512_set1_ps(-1.9515295891E-4f);
+			y2 = _mm512_fmadd_ps(y2, z, _mm512_set1_ps(8.3321608736E-3f));
+			y2 = _mm512_fmadd_ps(y2, z, _mm512_set1_ps(-1.6666654611E-1f));
+			y2 = _mm512_mul_ps(y2, z);
+			y2 = _mm512_fmadd_ps(y2, x, x);
+
+			const __m512 res = _mm512_mask_blend_ps(poly_mask, y1, y2);
+			return _mm512_xor_ps(res, sign_bit);
+		}
+
+		VCL_STRONG_INLINE __m512i _mmVCL_octant_epi32(__m512 x)
+		{
+			// j = (int) (x * 4 / Pi); j = (j + 1) & ~1
+			__m512i j = _mm512_cvttps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f)));
+			j = _mm512_add_epi32(j, _mm512_set1_epi32(1));
+			return _mm512_and_si512(j, _mm512_set1_epi32(~1));
+		}
+	}
+
+	__m512 _mm512_sin_ps(__m512 v)
+	{
+		const __m512 x = _mm512_abs_ps(v);
+		const __m512i j = _mmVCL_octant_epi32(x);
+
+		// Swap the sign in the lower half of the circle
+		const __m512i swap_sign_bit = _mm512_slli_epi32(_mm512_and_si512(j, _mm512_set1_epi32(4)), 29);
+		const __m512i sign_bit = _mm512_xor_si512(_mm512_and_si512(_mm512_castps_si512(v), _mm512_set1_epi32(0x80000000)), swap_sign_bit);
+
+		// Use the sine polynomial in the octants 0, 3, 4 and 7
+		const __mmask16 poly_mask = _mm512_testn_epi32_mask(j, _mm512_set1_epi32(2));
+
+		return _mmVCL_sincos_ps(x, _mm512_cvtepi32_ps(j), poly_mask, _mm512_castsi512_ps(sign_bit));
+	}
+
+	__m512 _mm512_cos_ps(__m512 v)
+	{
+		const __m512 x = _mm512_abs_ps(v);
+		const __m512i j = _mmVCL_octant_epi32(x);
+		const __m512i k = _mm512_sub_epi32(j, _mm512_set1_epi32(2));
+
+		const __m512i sign_bit = _mm512_slli_epi32(_mm512_andnot_si512(k, _mm512_set1_epi32(4)), 29);
+		const __mmask16 poly_mask = _mm512_testn_epi32_mask(k, _mm512_set1_epi32(2));
+
+		return _mmVCL_sincos_ps(x, _mm512_cvtepi32_ps(j), poly_mask, _mm512_castsi512_ps(sign_bit));
+	}
+
+	__m512 _mm512_log_ps(__m512 v)
+	{
+		const __m512 one = _mm512_set1_ps(1.0f);
+
+		// Negative arguments and zero map to NaN
+		const __mmask16 invalid_mask = _mm512_cmp_ps_mask(v, _mm512_setzero_ps(), _CMP_LE_OS);
+
+		// Cut off denormalized values
+		__m512 x = _mm512_max_ps(v, _mm512_castsi512_ps(_mm512_set1_epi32(0x00800000)));
+
+		// Split into exponent and mantissa in [0.5, 1)
+		__m512 e = _mm512_add_ps(_mm512_getexp_ps(x), one);
+		x = _mm512_getmant_ps(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+
+		// if (x < SQRTHF) { e -= 1; x = x + x - 1.0; } else { x = x - 1.0; }
+		const __mmask16 mask = _mm512_cmp_ps_mask(x, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OS);
+		x = _mm512_mask_add_ps(x, mask, x, x);
+		x = _mm512_sub_ps(x, one);
+		e = _mm512_mask_sub_ps(e, mask, e, one);
+
+		const __m512 z = _mm512_mul_ps(x, x);
+
+		__m512 y = _mm512_set1_ps(7.0376836292E-2f);
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.1514610310E-1f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps( 1.1676998740E-1f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.2420140846E-1f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps( 1.4249322787E-1f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.6668057665E-1f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps( 2.0000714765E-1f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-2.4999993993E-1f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps( 3.3333331174E-1f));
+		y = _mm512_mul_ps(_mm512_mul_ps(y, x), z);
+
+		y = _mm512_fmadd_ps(e, _mm512_set1_ps(-2.12194440e-4f), y);
+		y = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+
+		x = _mm512_add_ps(x, y);
+		x = _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), x);
+
+		return _mm512_mask_mov_ps(x, invalid_mask, _mm512_castsi512_ps(_mm512_set1_epi32(0xffffffff)));
+	}
+
+	__m512 _mm512_exp_ps(__m512 v)
+	{
+		__m512 x = _mm512_min_ps(v, _mm512_set1_ps(88.3762626647949f));
+		x = _mm512_max_ps(x, _mm512_set1_ps(-88.3762626647949f));
+
+		// Express exp(x) as exp(g + n*log(2))
+		__m512 fx = _mm512_fmadd_ps(x, _mm512_set1_ps(1.44269504088896341f), _mm512_set1_ps(0.5f));
+		fx = _mm512_roundscale_ps(fx, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+		x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(0.693359375f), x);
+		x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(-2.12194440e-4f), x);
+
+		const __m512 z = _mm512_mul_ps(x, x);
+
+		__m512 y = _mm512_set1_ps(1.9875691500E-4f);
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.3981999507E-3f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(8.3334519073E-3f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(4.1665795894E-2f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.6666665459E-1f));
+		y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(5.0000001201E-1f));
+		y = _mm512_fmadd_ps(y, z, x);
+		y = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+
+		// Multiply by 2^n
+		return _mm512_scalef_ps(y, fx);
+	}
+
+	// Handbook of Mathematical Functions
+	// M. Abramowitz and I.A. Stegun, Ed.
+	__m512 _mm512_acos_ps(__m512 v)
+	{
+		using float16 = VectorScalar<float, 16>;
+
+		float16 x{ v };
+
+		// Absolute error <= 6.7e-5
+		float16 negate = select(x < 0, float16{ 1 }, float16{ 0 });
+
+		x = x.abs();
+
+		float16 ret = -0.0187293f;
+		ret = ret * x;
+		ret = ret + 0.0742610f;
+		ret = ret * x;
+		ret = ret - 0.2121144f;
+		ret = ret * x;
+		ret = ret + 1.5707288f;
+		ret = ret * (1.0f - x).sqrt();
+		ret = ret - 2.0f * negate * ret;
+		return static_cast<__m512>(negate * 3.14159265358979f + ret);
+	}
+
+	// Handbook of Mathematical Functions
+	// M. Abramowitz and I.A. Stegun, Ed.
+	__m512 _mm512_asin_ps(__m512 v)
+	{
+		using float16 = VectorScalar<float, 16>;
+
+		float16 x{ v };
+
+		float16 negate = select(x < 0, float16{ 1 }, float16{ 0 });
+
+		x = abs(x);
+		float16 ret = -0.0187293f;
+		ret *= x;
+		ret += 0.0742610f;
+		ret *= x;
+		ret -= 0.2121144f;
+		ret *= x;
+		ret += 1.5707288f;
+		ret = 3.14159265358979f * 0.5f - sqrt(1.0f - x)*ret;
+		return static_cast<__m512>(ret - 2.0f * negate * ret);
+	}
+
+	__m512 _mm512_atan2_ps(__m512 in_y, __m512 in_x)
+	{
+		using float16 = VectorScalar<float, 16>;
+
+		float16 t0, t1, t3, t4;
+
+		float16 x{ in_x };
+		float16 y{ in_y };
+
+		t3 = abs(x);
+		t1 = abs(y);
+		t0 = max(t3, t1);
+		t1 = min(t3, t1);
+		t3 = 1.0f / t0;
+		t3 = t1 * t3;
+
+		t4 = t3 * t3;
+		t0 = -0.013480470f;
+		t0 = t0 * t4 + 0.057477314f;
+		t0 = t0 * t4 - 0.121239071f;
+		t0 = t0 * t4 + 0.195635925f;
+		t0 = t0 * t4 - 0.332994597f;
+		t0 = t0 * t4 + 0.999995630f;
+		t3 = t0 * t3;
+
+		t3 = select(abs(y) > abs(x), 1.570796327f - t3, t3);
+		t3 = select(x < 0, 3.141592654f - t3, t3);
+		t3 = select(y < 0, -t3, t3);
+
+		return static_cast<__m512>(t3);
+	}
+
+	__m512 _mm512_pow_ps(__m512 x, __m512 y)
+	{
+		return _mm512_exp_ps(_mm512_mul_ps(_mm512_log_ps(x), y));
+	}
+}
+#endif // VCL_VECTORIZE_AVX512
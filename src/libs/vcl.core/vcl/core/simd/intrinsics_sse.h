@@ -256,5 +256,61 @@ namespace Vcl
 #endif
 #endif
 	}
+
+	VCL_STRONG_INLINE __m128d _mm_abs_pd(__m128d v)
+	{
+		return _mm_andnot_pd(_mm_set1_pd(-0.0), v);
+	}
+
+	VCL_STRONG_INLINE __m128d _mm_sgn_pd(__m128d v)
+	{
+		return _mm_and_pd(_mm_or_pd(_mm_and_pd(v, _mm_set1_pd(-0.0)), _mm_set1_pd(1.0)), _mm_cmpneq_pd(v, _mm_setzero_pd()));
+	}
+
+	VCL_STRONG_INLINE __m128d _mmVCL_blend_pd(__m128d b, __m128d a, __m128d mask)
+	{
+#ifdef VCL_VECTORIZE_SSE4_1
+		return _mm_blendv_pd(b, a, mask);
+#else
+		return _mm_or_pd(_mm_andnot_pd(mask, b), _mm_and_pd(mask, a));
+#endif
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmin_pd(__m128d v)
+	{
+		return _mm_cvtsd_f64(_mm_min_sd(v, _mm_unpackhi_pd(v, v)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmax_pd(__m128d v)
+	{
+		return _mm_cvtsd_f64(_mm_max_sd(v, _mm_unpackhi_pd(v, v)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_extract_pd(__m128d v, int i)
+	{
+		typedef union
+		{
+			__m128d x;
+			double a[2];
+		} F64;
+
+		return F64{ v }.a[i];
+	}
+
+	// Convert two 2-lane double masks to a single 4-lane float mask
+	VCL_STRONG_INLINE __m128 _mmVCL_pack_mask_pd(__m128d lo, __m128d hi)
+	{
+		return _mm_shuffle_ps(_mm_castpd_ps(lo), _mm_castpd_ps(hi), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	// Expand the lower/upper half of a 4-lane float mask to a double mask
+	VCL_STRONG_INLINE __m128d _mmVCL_unpacklo_mask_ps(__m128 m)
+	{
+		return _mm_castps_pd(_mm_unpacklo_ps(m, m));
+	}
+	VCL_STRONG_INLINE __m128d _mmVCL_unpackhi_mask_ps(__m128 m)
+	{
+		return _mm_castps_pd(_mm_unpackhi_ps(m, m));
+	}
 }
 #endif // defined(VCL_VECTORIZE_SSE)
@@ -40,6 +40,10 @@
 #	include <vcl/core/simd/memory_avx.h>
 #endif //VCL_VECTORIZE_AVX
 
+#if defined VCL_VECTORIZE_AVX512
+#	include <vcl/core/simd/memory_avx512.h>
+#endif //VCL_VECTORIZE_AVX512
+
 #if defined VCL_VECTORIZE_NEON
 #	include <vcl/core/simd/memory_neon.h>
 #endif //VCL_VECTORIZE_NEON
@@ -115,27 +119,126 @@ namespace Vcl
 		return res;
 	}
 
+	template<typename Scalar, int Width>
+	VectorScalar<Scalar, Width> gather
+	(
+		Scalar const * base,
+		const VectorScalar<int, Width>& vindex,
+		const VectorScalar<bool, Width>& mask
+	)
+	{
+		using intN_t = VectorScalar<int, Width>;
+
+		// Inactive lanes read the first entry, which is always accessible
+		const intN_t idx = select(mask, vindex, intN_t(0));
+		return select(mask, gather(base, idx), VectorScalar<Scalar, Width>(0));
+	}
+
+	namespace Detail
+	{
+		/*!
+		 *	\brief Compute the location of entries in an interleaved array
+		 *
+		 *	\param base    Interleaved array holding the entries
+		 *	\param vindex  Indices of the entries
+		 *	\param offsets Offsets to the first scalar of each entry
+		 *
+		 *	\returns The distance between two scalars of the same entry.
+		 *
+		 *	In the grouped layout (1 < stride < allocated), entries are stored in
+		 *	blocks of 'stride' entries. The offsets are then computed per lane,
+		 *	which for a compile-time power-of-two stride reduces to a shift and
+		 *	a mask. All scalars are subsequently gathered vectorised.
+		 */
+		template<typename Scalar, int Width, int Rows, int Cols, int Stride>
+		VCL_STRONG_INLINE size_t interleavedOffsets
+		(
+			const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride>& base,
+			const VectorScalar<int, Width>& vindex,
+			VectorScalar<int, Width>& offsets
+		)
+		{
+			using intN_t = VectorScalar<int, Width>;
+
+			const size_t stride = (base.stride() == Vcl::Core::DynamicStride) ? base.allocated() : static_cast<size_t>(base.stride());
+			if (stride == 0 || stride == 1)
+			{
+				// The scalars of an entry are consecutive
+				offsets = intN_t(Rows*Cols) * vindex;
+				return 1;
+			}
+			else if (stride >= base.allocated())
+			{
+				// Each scalar of all entries is stored in a separate block
+				offsets = vindex;
+				return stride;
+			}
+
+			// Entry i is located in group i / stride at position i % stride
+			Check(Stride <= 1 || stride == static_cast<size_t>(Stride), "Runtime stride matches the compile-time stride.");
+			const unsigned int group_size = (Stride > 1) ? static_cast<unsigned int>(Stride) : static_cast<unsigned int>(stride);
+			VCL_ALIGN(64) int lanes[Width];
+			for (int i = 0; i < Width; i++)
+			{
+				const unsigned int idx = static_cast<unsigned int>(vindex[i]);
+				const unsigned int entry = idx % group_size;
+				lanes[i] = static_cast<int>((idx - entry)*Rows*Cols + entry);
+			}
+			load(offsets, lanes);
+
+			return stride;
+		}
+	}
+
 	template<typename Scalar, int Width, int Rows, int Cols, int Stride>
 	Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> gather
 	(
 		const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride>& base,
-		VectorScalar<int, Width>& vindex
+		const VectorScalar<int, Width>& vindex
 	)
 	{
 		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
 
 		Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> res;
+
+		VectorScalar<int, Width> offsets{ 0 };
+		const size_t scalar_stride = Detail::interleavedOffsets(base, vindex, offsets);
 		for (int c = 0; c < Cols; c++)
 		{
 			for (int r = 0; r < Rows; r++)
 			{
-				VectorScalar<Scalar, Width> tmp;
-				for (int i = 0; i < Width; i++)
-				{
-					tmp[i] = base.template at<Scalar>(vindex[i] * 1)(r, c);
-				}
+				res(r, c) = gather(base.data() + (c*Rows + r)*scalar_stride, offsets);
+			}
+		}
 
-				res(r, c) = tmp;
+		return res;
+	}
+
+	/*!
+	 *	\brief Gather the entries of an interleaved array for the active lanes
+	 *
+	 *	Entries of inactive lanes are set to zero. Their indices do not need
+	 *	to be valid.
+	 */
+	template<typename Scalar, int Width, int Rows, int Cols, int Stride>
+	Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> gather
+	(
+		const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride>& base,
+		const VectorScalar<int, Width>& vindex,
+		const VectorScalar<bool, Width>& mask
+	)
+	{
+		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
+
+		Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> res;
+
+		VectorScalar<int, Width> offsets{ 0 };
+		const size_t scalar_stride = Detail::interleavedOffsets(base, vindex, offsets);
+		for (int c = 0; c < Cols; c++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				res(r, c) = gather(base.data() + (c*Rows + r)*scalar_stride, offsets, mask);
 			}
 		}
 
@@ -165,7 +268,7 @@ namespace Vcl
 	}
 
 	template<typename Scalar, int Width>
-	void scatter(const VectorScalar<Scalar, Width>& value, Scalar* base, VectorScalar<int, Width>& vindex)
+	void scatter(const VectorScalar<Scalar, Width>& value, Scalar* base, const VectorScalar<int, Width>& vindex)
 	{
 		for (int i = 0; i < Width; i++)
 		{
@@ -173,6 +276,25 @@ namespace Vcl
 		}
 	}
 
+	template<typename Scalar, int Width>
+	void scatter
+	(
+		const VectorScalar<Scalar, Width>& value,
+		Scalar* base,
+		const VectorScalar<int, Width>& vindex,
+		const VectorScalar<bool, Width>& mask
+	)
+	{
+		using intN_t = VectorScalar<int, Width>;
+
+		const intN_t active = select(mask, intN_t(1), intN_t(0));
+		for (int i = 0; i < Width; i++)
+		{
+			if (active[i])
+				*(base + vindex[i] * 1) = value[i];
+		}
+	}
+
 	template<typename Scalar, int Width, int Rows, int Cols>
 	void scatter
 	(
@@ -203,4 +325,91 @@ namespace Vcl
 
 		base.template at<Scalar>(vindex * 1) = value;
 	}
+
+	template<typename Scalar, int Width, int Rows, int Cols, int Stride>
+	void scatter
+	(
+		const Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols>& value,
+		Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride>& base,
+		const VectorScalar<int, Width>& vindex
+	)
+	{
+		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
+
+		VectorScalar<int, Width> offsets{ 0 };
+		const size_t scalar_stride = Detail::interleavedOffsets(base, vindex, offsets);
+		for (int c = 0; c < Cols; c++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				scatter(value(r, c), base.data() + (c*Rows + r)*scalar_stride, offsets);
+			}
+		}
+	}
+
+	/*!
+	 *	\brief Scatter the entries of the active lanes to an interleaved array
+	 *
+	 *	Indices of inactive lanes do not need to be valid.
+	 */
+	template<typename Scalar, int Width, int Rows, int Cols, int Stride>
+	void scatter
+	(
+		const Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols>& value,
+		Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride>& base,
+		const VectorScalar<int, Width>& vindex,
+		const VectorScalar<bool, Width>& mask
+	)
+	{
+		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
+
+		VectorScalar<int, Width> offsets{ 0 };
+		const size_t scalar_stride = Detail::interleavedOffsets(base, vindex, offsets);
+		for (int c = 0; c < Cols; c++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				scatter(value(r, c), base.data() + (c*Rows + r)*scalar_stride, offsets, mask);
+			}
+		}
+	}
+
+	template<int Width, int Rows>
+	VCL_STRONG_INLINE void load
+	(
+		Eigen::Matrix<VectorScalar<double, Width>, Rows, 1>& loaded,
+		const Eigen::Matrix<double, Rows, 1>* base
+	)
+	{
+		// Transpose the consecutive vectors to one contiguous block per row
+		VCL_ALIGN(64) double rows[Rows][Width];
+		for (int i = 0; i < Width; i++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				rows[r][i] = base[i](r);
+			}
+		}
+
+		for (int r = 0; r < Rows; r++)
+		{
+			load(loaded(r), rows[r]);
+		}
+	}
+
+	template<int Width, int Rows>
+	VCL_STRONG_INLINE void store
+	(
+		Eigen::Matrix<double, Rows, 1>* base,
+		const Eigen::Matrix<VectorScalar<double, Width>, Rows, 1>& value
+	)
+	{
+		for (int i = 0; i < Width; i++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				base[i](r) = value(r)[i];
+			}
+		}
+	}
 }
@@ -80,6 +80,7 @@ namespace Vcl
 		return VectorScalar<float, 8>(gather(base, idx));
 	}
 
+#ifndef VCL_VECTORIZE_AVX512
 	VCL_STRONG_INLINE VectorScalar<float, 16> gather(float const * base, const VectorScalar<int, 16>& vindex)
 	{
 		return VectorScalar<float, 16>
@@ -88,17 +89,133 @@ namespace Vcl
 			gather(base, vindex.get(1))
 		);
 	}
+#endif // VCL_VECTORIZE_AVX512
+
+#ifdef VCL_VECTORIZE_AVX2
+	VCL_STRONG_INLINE VectorScalar<float, 4> gather(float const * base, const VectorScalar<int, 4>& vindex, const VectorScalar<bool, 4>& mask)
+	{
+		return VectorScalar<float, 4>(_mm_mask_i32gather_ps(_mm_setzero_ps(), base, vindex.get(0), static_cast<__m128>(mask), 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<float, 8> gather(float const * base, const VectorScalar<int, 8>& vindex, const VectorScalar<bool, 8>& mask)
+	{
+		return VectorScalar<float, 8>(_mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, static_cast<__m256i>(vindex), static_cast<__m256>(mask), 4));
+	}
+
+#ifndef VCL_VECTORIZE_AVX512
+	VCL_STRONG_INLINE VectorScalar<float, 16> gather(float const * base, const VectorScalar<int, 16>& vindex, const VectorScalar<bool, 16>& mask)
+	{
+		return VectorScalar<float, 16>
+		(
+			_mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, vindex.get(0), mask.get(0), 4),
+			_mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, vindex.get(1), mask.get(1), 4)
+		);
+	}
+#endif // VCL_VECTORIZE_AVX512
+#endif // VCL_VECTORIZE_AVX2
+
+#ifndef VCL_VECTORIZE_AVX512
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 8>& value, float* base, const VectorScalar<int, 8>& vindex)
+	{
+		// Spill the registers once instead of extracting each lane separately.
+		// Conflicting indices are written in lane order.
+		VCL_ALIGN(32) float values[8];
+		VCL_ALIGN(32) int indices[8];
+		_mm256_store_ps(values, static_cast<__m256>(value));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(indices), static_cast<__m256i>(vindex));
+
+		for (int i = 0; i < 8; i++)
+			base[indices[i]] = values[i];
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 8>& value, float* base, const VectorScalar<int, 8>& vindex, const VectorScalar<bool, 8>& mask)
+	{
+		VCL_ALIGN(32) float values[8];
+		VCL_ALIGN(32) int indices[8];
+		_mm256_store_ps(values, static_cast<__m256>(value));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(indices), static_cast<__m256i>(vindex));
+
+		int active = _mm256_movemask_ps(static_cast<__m256>(mask));
+		for (int i = 0; i < 8; i++, active >>= 1)
+		{
+			if (active & 1)
+				base[indices[i]] = values[i];
+		}
+	}
+#endif // VCL_VECTORIZE_AVX512
 
 	VCL_STRONG_INLINE void load(float8& value, const float* base)
 	{
 		value = float8{ _mm256_loadu_ps(base) };
 	}
 
+	VCL_STRONG_INLINE void load(int8& value, const int* base)
+	{
+		value = int8{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base)) };
+	}
+
+#ifndef VCL_VECTORIZE_AVX512
 	VCL_STRONG_INLINE void load(float16& value, const float* base)
 	{
 		value = float16{ _mm256_loadu_ps(base), _mm256_loadu_ps(base + 8) };
 	}
 
+	VCL_STRONG_INLINE void load(int16& value, const int* base)
+	{
+		value = int16
+		{
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(base + 0)),
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(base + 8))
+		};
+	}
+#endif // VCL_VECTORIZE_AVX512
+
+	VCL_STRONG_INLINE void load(double4& value, const double* base)
+	{
+		value = double4{ _mm256_loadu_pd(base) };
+	}
+
+#ifdef VCL_VECTORIZE_AVX2
+	VCL_STRONG_INLINE __m256d gather(double const* base, __m128i vindex)
+	{
+		// The masked form defines the source operand, which the plain intrinsic leaves uninitialised
+		return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, vindex, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+	}
+#else
+	VCL_STRONG_INLINE __m256d gather(double const* base, __m128i vindex)
+	{
+		return _mm256_set_pd
+		(
+			base[_mmVCL_extract_epi32(vindex, 3)],
+			base[_mmVCL_extract_epi32(vindex, 2)],
+			base[_mmVCL_extract_epi32(vindex, 1)],
+			base[_mmVCL_extract_epi32(vindex, 0)]
+		);
+	}
+#endif
+
+	VCL_STRONG_INLINE VectorScalar<double, 4> gather(double const * base, const VectorScalar<int, 4>& vindex)
+	{
+		return VectorScalar<double, 4>(gather(base, vindex.get(0)));
+	}
+
+#ifndef VCL_VECTORIZE_AVX512
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const * base, const VectorScalar<int, 8>& vindex)
+	{
+		const __m256i idx = static_cast<__m256i>(vindex);
+		return VectorScalar<double, 8>
+		(
+			gather(base, _mm256_castsi256_si128(idx)),
+			gather(base, _mm256_extractf128_si256(idx, 1))
+		);
+	}
+
+	VCL_STRONG_INLINE void load(double8& value, const double* base)
+	{
+		value = double8{ _mm256_loadu_pd(base), _mm256_loadu_pd(base + 4) };
+	}
+#endif // VCL_VECTORIZE_AVX512
+
 	// The load/store implementation for vectors are directly from or based on:
 	// https://software.intel.com/en-us/articles/3d-vector-normalization-using-256-bit-intel-advanced-vector-extensions-intel-avx
 	VCL_STRONG_INLINE void load
@@ -279,6 +396,7 @@ namespace Vcl
 		);
 	}
 
+#ifndef VCL_VECTORIZE_AVX512
 	VCL_STRONG_INLINE void load
 	(
 		Eigen::Matrix<float16, 3, 1>& loaded,
@@ -385,6 +503,7 @@ namespace Vcl
 			_mm256_castsi256_ps(value(2).get(1))
 		);
 	}
+#endif // VCL_VECTORIZE_AVX512
 
 	/*
 	VCL_STRONG_INLINE void load
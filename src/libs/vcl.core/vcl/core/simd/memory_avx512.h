@@ -0,0 +1,268 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// VCL
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/memory_avx.h>
+
+#if defined VCL_VECTORIZE_AVX512
+namespace Vcl
+{
+	VCL_STRONG_INLINE __m512 gather(float const* base, __m512i vindex)
+	{
+		return _mm512_i32gather_ps(vindex, base, 4);
+	}
+
+	VCL_STRONG_INLINE VectorScalar<float, 16> gather(float const * base, const VectorScalar<int, 16>& vindex)
+	{
+		return VectorScalar<float, 16>(gather(base, static_cast<__m512i>(vindex)));
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 16>& value, float* base, const VectorScalar<int, 16>& vindex)
+	{
+		// Conflicting indices are written in lane order, which matches the scalar implementation
+		_mm512_i32scatter_ps(base, static_cast<__m512i>(vindex), static_cast<__m512>(value), 4);
+	}
+
+	VCL_STRONG_INLINE VectorScalar<float, 16> gather(float const * base, const VectorScalar<int, 16>& vindex, const VectorScalar<bool, 16>& mask)
+	{
+		return VectorScalar<float, 16>(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), static_cast<__mmask16>(mask), static_cast<__m512i>(vindex), base, 4));
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 16>& value, float* base, const VectorScalar<int, 16>& vindex, const VectorScalar<bool, 16>& mask)
+	{
+		_mm512_mask_i32scatter_ps(base, static_cast<__mmask16>(mask), static_cast<__m512i>(vindex), static_cast<__m512>(value), 4);
+	}
+
+	// The narrower vector types use the AVX-512VL forms of the scatter instructions
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 4>& value, float* base, const VectorScalar<int, 4>& vindex)
+	{
+		_mm_i32scatter_ps(base, vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 4>& value, float* base, const VectorScalar<int, 4>& vindex, const VectorScalar<bool, 4>& mask)
+	{
+		const __mmask8 active = static_cast<__mmask8>(_mm_movemask_ps(static_cast<__m128>(mask)));
+		_mm_mask_i32scatter_ps(base, active, vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 8>& value, float* base, const VectorScalar<int, 8>& vindex)
+	{
+		_mm256_i32scatter_ps(base, static_cast<__m256i>(vindex), static_cast<__m256>(value), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 8>& value, float* base, const VectorScalar<int, 8>& vindex, const VectorScalar<bool, 8>& mask)
+	{
+		const __mmask8 active = static_cast<__mmask8>(_mm256_movemask_ps(static_cast<__m256>(mask)));
+		_mm256_mask_i32scatter_ps(base, active, static_cast<__m256i>(vindex), static_cast<__m256>(value), 4);
+	}
+
+	VCL_STRONG_INLINE void load(float16& value, const float* base)
+	{
+		value = float16{ _mm512_loadu_ps(base) };
+	}
+
+	VCL_STRONG_INLINE void load(int16& value, const int* base)
+	{
+		value = int16{ _mm512_loadu_si512(base) };
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const * base, const VectorScalar<int, 8>& vindex)
+	{
+		return VectorScalar<double, 8>(_mm512_i32gather_pd(static_cast<__m256i>(vindex), base, 8));
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<double, 8>& value, double* base, const VectorScalar<int, 8>& vindex)
+	{
+		_mm512_i32scatter_pd(base, static_cast<__m256i>(vindex), static_cast<__m512d>(value), 8);
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const * base, const VectorScalar<int, 8>& vindex, const VectorScalar<bool, 8>& mask)
+	{
+		const __mmask8 active = static_cast<__mmask8>(_mm256_movemask_ps(static_cast<__m256>(mask)));
+		return VectorScalar<double, 8>(_mm512_mask_i32gather_pd(_mm512_setzero_pd(), active, static_cast<__m256i>(vindex), base, 8));
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<double, 8>& value, double* base, const VectorScalar<int, 8>& vindex, const VectorScalar<bool, 8>& mask)
+	{
+		const __mmask8 active = static_cast<__mmask8>(_mm256_movemask_ps(static_cast<__m256>(mask)));
+		_mm512_mask_i32scatter_pd(base, active, static_cast<__m256i>(vindex), static_cast<__m512d>(value), 8);
+	}
+
+	VCL_STRONG_INLINE void load(double8& value, const double* base)
+	{
+		value = double8{ _mm512_loadu_pd(base) };
+	}
+
+	VCL_STRONG_INLINE __m512 _mmVCL_combine_ps(__m256 lo, __m256 hi)
+	{
+		return _mm512_insertf32x8(_mm512_castps256_ps512(lo), hi, 1);
+	}
+
+	// Deinterleave 16 consecutive 3-vectors using two cross-lane permutations per component
+	VCL_STRONG_INLINE void load
+	(
+		__m512& x, __m512& y, __m512& z,
+		const Eigen::Vector3f* base
+	)
+	{
+		const float* p = base->data();
+		const __m512 m0 = _mm512_loadu_ps(p +  0);
+		const __m512 m1 = _mm512_loadu_ps(p + 16);
+		const __m512 m2 = _mm512_loadu_ps(p + 32);
+
+		const __m512i x01 = _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30,  0,  0,  0,  0,  0);
+		const __m512i x2  = _mm512_setr_epi32(0, 1, 2, 3,  4,  5,  6,  7,  8,  9, 10, 17, 20, 23, 26, 29);
+		const __m512i y01 = _mm512_setr_epi32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31,  0,  0,  0,  0,  0);
+		const __m512i y2  = _mm512_setr_epi32(0, 1, 2, 3,  4,  5,  6,  7,  8,  9, 10, 18, 21, 24, 27, 30);
+		const __m512i z01 = _mm512_setr_epi32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29,  0,  0,  0,  0,  0,  0);
+		const __m512i z2  = _mm512_setr_epi32(0, 1, 2, 3,  4,  5,  6,  7,  8,  9, 16, 19, 22, 25, 28, 31);
+
+		x = _mm512_permutex2var_ps(_mm512_permutex2var_ps(m0, x01, m1), x2, m2);
+		y = _mm512_permutex2var_ps(_mm512_permutex2var_ps(m0, y01, m1), y2, m2);
+		z = _mm512_permutex2var_ps(_mm512_permutex2var_ps(m0, z01, m1), z2, m2);
+	}
+
+	// Interleave three components into 16 consecutive 3-vectors
+	VCL_STRONG_INLINE void store
+	(
+		Eigen::Vector3f* base,
+		const __m512& x, const __m512& y, const __m512& z
+	)
+	{
+		const __m512i xy0 = _mm512_setr_epi32( 0, 16,  0,  1, 17,  0,  2, 18,  0,  3, 19,  0,  4, 20,  0,  5);
+		const __m512i z0  = _mm512_setr_epi32( 0,  1, 16,  3,  4, 17,  6,  7, 18,  9, 10, 19, 12, 13, 20, 15);
+		const __m512i xy1 = _mm512_setr_epi32(21,  0,  6, 22,  0,  7, 23,  0,  8, 24,  0,  9, 25,  0, 10, 26);
+		const __m512i z1  = _mm512_setr_epi32( 0, 21,  2,  3, 22,  5,  6, 23,  8,  9, 24, 11, 12, 25, 14, 15);
+		const __m512i xy2 = _mm512_setr_epi32( 0, 11, 27,  0, 12, 28,  0, 13, 29,  0, 14, 30,  0, 15, 31,  0);
+		const __m512i z2  = _mm512_setr_epi32(26,  1,  2, 27,  4,  5, 28,  7,  8, 29, 10, 11, 30, 13, 14, 31);
+
+		float* p = base->data();
+		_mm512_storeu_ps(p +  0, _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, xy0, y), z0, z));
+		_mm512_storeu_ps(p + 16, _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, xy1, y), z1, z));
+		_mm512_storeu_ps(p + 32, _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, xy2, y), z2, z));
+	}
+
+	VCL_STRONG_INLINE void load
+	(
+		Eigen::Matrix<float16, 3, 1>& loaded,
+		const Eigen::Vector3f* base
+	)
+	{
+		__m512 x, y, z;
+		load(x, y, z, base);
+
+		loaded =
+		{
+			float16(x),
+			float16(y),
+			float16(z)
+		};
+	}
+
+	VCL_STRONG_INLINE void load
+	(
+		Eigen::Matrix<int16, 3, 1>& loaded,
+		const Eigen::Vector3i* base
+	)
+	{
+		__m512 x, y, z;
+		load(x, y, z, reinterpret_cast<const Eigen::Vector3f*>(base));
+
+		loaded =
+		{
+			int16{ _mm512_castps_si512(x) },
+			int16{ _mm512_castps_si512(y) },
+			int16{ _mm512_castps_si512(z) }
+		};
+	}
+
+	VCL_STRONG_INLINE void load
+	(
+		Eigen::Matrix<float16, 4, 1>& loaded,
+		const Eigen::Vector4f* base
+	)
+	{
+		__m256 x0, x1, y0, w0, y1, z0, z1, w1;
+		load(x0, y0, z0, w0, base);
+		load(x1, y1, z1, w1, base + 8);
+
+		loaded =
+		{
+			float16(_mmVCL_combine_ps(x0, x1)),
+			float16(_mmVCL_combine_ps(y0, y1)),
+			float16(_mmVCL_combine_ps(z0, z1)),
+			float16(_mmVCL_combine_ps(w0, w1))
+		};
+	}
+
+	VCL_STRONG_INLINE void load
+	(
+		Eigen::Matrix<int16, 4, 1>& loaded,
+		const Eigen::Vector4i* base
+	)
+	{
+		__m256 x0, x1, y0, w0, y1, z0, z1, w1;
+		load(x0, y0, z0, w0, reinterpret_cast<const Eigen::Vector4f*>(base));
+		load(x1, y1, z1, w1, reinterpret_cast<const Eigen::Vector4f*>(base) + 8);
+
+		loaded =
+		{
+			int16{ _mm512_castps_si512(_mmVCL_combine_ps(x0, x1)) },
+			int16{ _mm512_castps_si512(_mmVCL_combine_ps(y0, y1)) },
+			int16{ _mm512_castps_si512(_mmVCL_combine_ps(z0, z1)) },
+			int16{ _mm512_castps_si512(_mmVCL_combine_ps(w0, w1)) }
+		};
+	}
+
+	VCL_STRONG_INLINE void store
+	(
+		Eigen::Vector3f* base,
+		const Eigen::Matrix<float16, 3, 1>& value
+	)
+	{
+		store(base, (__m512) value(0), (__m512) value(1), (__m512) value(2));
+	}
+
+	VCL_STRONG_INLINE void store
+	(
+		Eigen::Vector3i* base,
+		const Eigen::Matrix<int16, 3, 1>& value
+	)
+	{
+		store
+		(
+			reinterpret_cast<Eigen::Vector3f*>(base),
+			_mm512_castsi512_ps((__m512i) value(0)),
+			_mm512_castsi512_ps((__m512i) value(1)),
+			_mm512_castsi512_ps((__m512i) value(2))
+		);
+	}
+}
+#endif // defined VCL_VECTORIZE_AVX512
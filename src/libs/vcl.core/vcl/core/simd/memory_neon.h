@@ -76,6 +76,11 @@ namespace Vcl
 		value = float4{ vld1q_f32(base) };
 	}
 
+	VCL_STRONG_INLINE void load(int4& value, const int* base)
+	{
+		value = int4{ vld1q_s32(base) };
+	}
+
 	// https://software.intel.com/en-us/articles/3d-vector-normalization-using-256-bit-intel-advanced-vector-extensions-intel-avx
 	VCL_STRONG_INLINE void load
 	(
@@ -225,6 +230,20 @@ namespace Vcl
 		};
 	}
 
+	VCL_STRONG_INLINE void load(int8& value, const int* base)
+	{
+		value = int8{ vld1q_s32(base), vld1q_s32(base + 4) };
+	}
+
+	VCL_STRONG_INLINE void load(int16& value, const int* base)
+	{
+		value = int16
+		{
+			vld1q_s32(base + 0), vld1q_s32(base +  4),
+			vld1q_s32(base + 8), vld1q_s32(base + 12)
+		};
+	}
+
 	VCL_STRONG_INLINE void load
 	(
 		Eigen::Matrix<float8, 3, 1>& loaded,
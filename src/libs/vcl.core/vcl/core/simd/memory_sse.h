@@ -78,6 +78,11 @@ namespace Vcl
 		value = float4{ _mm_loadu_ps(base) };
 	}
 
+	VCL_STRONG_INLINE void load(int4& value, const int* base)
+	{
+		value = int4{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(base)) };
+	}
+
 	// https://software.intel.com/en-us/articles/3d-vector-normalization-using-256-bit-intel-advanced-vector-extensions-intel-avx
 	VCL_STRONG_INLINE void load
 	(
@@ -225,9 +230,51 @@ namespace Vcl
 			_mm_castsi128_ps(value(2).get(0))
 		);
 	}
+
+	VCL_STRONG_INLINE void load(double2& value, const double* base)
+	{
+		value = double2{ _mm_loadu_pd(base) };
+	}
 #endif // defined VCL_VECTORIZE_SSE
 
 #if defined VCL_VECTORIZE_SSE && !defined VCL_VECTORIZE_AVX
+	VCL_STRONG_INLINE __m128d gather(double const* base, __m128i vindex, int offset)
+	{
+		return _mm_set_pd
+		(
+			base[_mmVCL_extract_epi32(vindex, offset + 1)],
+			base[_mmVCL_extract_epi32(vindex, offset + 0)]
+		);
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 4> gather(double const * base, const VectorScalar<int, 4>& vindex)
+	{
+		return VectorScalar<double, 4>
+		(
+			gather(base, vindex.get(0), 0),
+			gather(base, vindex.get(0), 2)
+		);
+	}
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const * base, const VectorScalar<int, 8>& vindex)
+	{
+		return VectorScalar<double, 8>
+		(
+			gather(base, vindex.get(0), 0),
+			gather(base, vindex.get(0), 2),
+			gather(base, vindex.get(1), 0),
+			gather(base, vindex.get(1), 2)
+		);
+	}
+
+	VCL_STRONG_INLINE void load(double4& value, const double* base)
+	{
+		value = double4{ _mm_loadu_pd(base), _mm_loadu_pd(base + 2) };
+	}
+
+	VCL_STRONG_INLINE void load(double8& value, const double* base)
+	{
+		value = double8{ _mm_loadu_pd(base), _mm_loadu_pd(base + 2), _mm_loadu_pd(base + 4), _mm_loadu_pd(base + 6) };
+	}
 
 	VCL_STRONG_INLINE void load(float8& value, const float* base)
 	{
@@ -243,6 +290,26 @@ namespace Vcl
 		};
 	}
 
+	VCL_STRONG_INLINE void load(int8& value, const int* base)
+	{
+		value = int8
+		{
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 0)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 4))
+		};
+	}
+
+	VCL_STRONG_INLINE void load(int16& value, const int* base)
+	{
+		value = int16
+		{
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 0)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 4)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 8)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 12))
+		};
+	}
+
 	VCL_STRONG_INLINE void load
 	(
 		Eigen::Matrix<float8, 3, 1>& loaded,
@@ -35,7 +35,15 @@
 // VCL
 #include <vcl/core/contract.h>
 
-namespace Vcl
+// Kernels built for a different instruction set than the rest of the library
+// (see VCL_DISPATCH_SOURCE) select a different namespace for the vector types.
+// The types and the functions operating on them are thereby distinct from
+// the baseline ones and cannot be merged by the linker.
+#ifndef VCL_SIMD_ISA_NAMESPACE
+#	define VCL_SIMD_ISA_NAMESPACE baseline
+#endif
+
+namespace Vcl { inline namespace VCL_SIMD_ISA_NAMESPACE
 {
 	template<typename Scalar, int Width>
 	class VectorScalar
@@ -118,17 +126,40 @@ namespace Vcl
 	private:
 		Scalar mData[Width];
 	};
-}
+}}
 
 #if defined(VCL_VECTORIZE_SSE) || defined(VCL_VECTORIZE_AVX)
+#	include <vcl/core/simd/bool2_sse.h>
 #	include <vcl/core/simd/bool4_sse.h>
+#	include <vcl/core/simd/double2_sse.h>
 #	include <vcl/core/simd/float4_sse.h>
 #	include <vcl/core/simd/int4_sse.h>
 #endif
 
-#if defined VCL_VECTORIZE_AVX
+#if defined VCL_VECTORIZE_AVX512
+#	include <vcl/core/simd/bool8_avx.h>
+#	include <vcl/core/simd/bool16_avx512.h>
+#	include <vcl/core/simd/double4_avx.h>
+#	include <vcl/core/simd/double8_avx512.h>
+#	include <vcl/core/simd/float8_avx.h>
+#	include <vcl/core/simd/float16_avx512.h>
+#	include <vcl/core/simd/int8_avx.h>
+#	include <vcl/core/simd/int16_avx512.h>
+
+namespace Vcl
+{
+	template<>
+	class VectorScalar<float, 32>
+	{
+	private:
+		__m512 mF16[2];
+	};
+}
+#elif defined VCL_VECTORIZE_AVX
 #	include <vcl/core/simd/bool8_avx.h>
 #	include <vcl/core/simd/bool16_avx.h>
+#	include <vcl/core/simd/double4_avx.h>
+#	include <vcl/core/simd/double8_avx.h>
 #	include <vcl/core/simd/float8_avx.h>
 #	include <vcl/core/simd/float16_avx.h>
 #	include <vcl/core/simd/int8_avx.h>
@@ -146,6 +177,8 @@ namespace Vcl
 #elif defined VCL_VECTORIZE_SSE
 #	include <vcl/core/simd/bool8_sse.h>
 #	include <vcl/core/simd/bool16_sse.h>
+#	include <vcl/core/simd/double4_sse.h>
+#	include <vcl/core/simd/double8_sse.h>
 #	include <vcl/core/simd/float8_sse.h>
 #	include <vcl/core/simd/float16_sse.h>
 #	include <vcl/core/simd/int8_sse.h>
@@ -210,6 +243,40 @@ namespace Vcl
 		using bool_t = VectorScalar<bool, 16>;
 	};
 
+	template<>
+	struct VectorTypes<double>
+	{
+		using float_t = double;
+		using int_t = int;
+		using bool_t = bool;
+	};
+
+	template<>
+	struct VectorTypes<VectorScalar<double, 2>>
+	{
+		using float_t = VectorScalar<double, 2>;
+
+		//! There is no two-wide integer type, only the lower two lanes are used
+		using int_t = VectorScalar<int, 4>;
+		using bool_t = VectorScalar<bool, 2>;
+	};
+
+	template<>
+	struct VectorTypes<VectorScalar<double, 4>>
+	{
+		using float_t = VectorScalar<double, 4>;
+		using int_t = VectorScalar<int, 4>;
+		using bool_t = VectorScalar<bool, 4>;
+	};
+
+	template<>
+	struct VectorTypes<VectorScalar<double, 8>>
+	{
+		using float_t = VectorScalar<double, 8>;
+		using int_t = VectorScalar<int, 8>;
+		using bool_t = VectorScalar<bool, 8>;
+	};
+
 	template<typename T>
 	struct NumericTrait
 	{
@@ -231,6 +298,21 @@ namespace Vcl
 	{
 		using base_t = float;
 	};
+	template<>
+	struct NumericTrait<VectorScalar<double, 2>>
+	{
+		using base_t = double;
+	};
+	template<>
+	struct NumericTrait<VectorScalar<double, 4>>
+	{
+		using base_t = double;
+	};
+	template<>
+	struct NumericTrait<VectorScalar<double, 8>>
+	{
+		using base_t = double;
+	};
 
 
 
@@ -287,6 +369,16 @@ namespace Vcl
 		return x;
 	}
 
+	VCL_STRONG_INLINE double min(double x)
+	{
+		return x;
+	}
+
+	VCL_STRONG_INLINE double max(double x)
+	{
+		return x;
+	}
+
 	VCL_STRONG_INLINE bool any(bool b)
 	{
 		return b;
@@ -408,6 +500,10 @@ namespace Vcl
 	typedef VectorScalar<float, 16> float16;
 	typedef VectorScalar<float, 32> float32;
 
+	typedef VectorScalar<double, 2> double2;
+	typedef VectorScalar<double, 4> double4;
+	typedef VectorScalar<double, 8> double8;
+
 	typedef VectorScalar<int,  4> int4;
 	typedef VectorScalar<int,  8> int8;
 	typedef VectorScalar<int, 16> int16;
@@ -476,6 +572,51 @@ namespace Eigen
 
 		EIGEN_STRONG_INLINE static float dummy_precision() { return 1e-5f; }
 	};
+	template<> struct NumTraits<Vcl::double2> : GenericNumTraits<Vcl::double2>
+	{
+		enum
+		{
+			IsInteger = std::numeric_limits<double>::is_integer,
+			IsSigned = std::numeric_limits<double>::is_signed,
+			IsComplex = 0,
+			RequireInitialization = internal::is_arithmetic<double>::value ? 0 : 1,
+			ReadCost = 1,
+			AddCost = 1,
+			MulCost = 1
+		};
+
+		EIGEN_STRONG_INLINE static double dummy_precision() { return 1e-12; }
+	};
+	template<> struct NumTraits<Vcl::double4> : GenericNumTraits<Vcl::double4>
+	{
+		enum
+		{
+			IsInteger = std::numeric_limits<double>::is_integer,
+			IsSigned = std::numeric_limits<double>::is_signed,
+			IsComplex = 0,
+			RequireInitialization = internal::is_arithmetic<double>::value ? 0 : 1,
+			ReadCost = 1,
+			AddCost = 1,
+			MulCost = 1
+		};
+
+		EIGEN_STRONG_INLINE static double dummy_precision() { return 1e-12; }
+	};
+	template<> struct NumTraits<Vcl::double8> : GenericNumTraits<Vcl::double8>
+	{
+		enum
+		{
+			IsInteger = std::numeric_limits<double>::is_integer,
+			IsSigned = std::numeric_limits<double>::is_signed,
+			IsComplex = 0,
+			RequireInitialization = internal::is_arithmetic<double>::value ? 0 : 1,
+			ReadCost = 1,
+			AddCost = 1,
+			MulCost = 1
+		};
+
+		EIGEN_STRONG_INLINE static double dummy_precision() { return 1e-12; }
+	};
 }
 
 template<typename Scalar, int Width> EIGEN_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> abs (const Vcl::VectorScalar<Scalar, Width>& x) { return x.abs(); }
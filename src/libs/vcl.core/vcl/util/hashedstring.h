@@ -30,6 +30,7 @@
 // C++ standard libary
 #include <cstring>
 #include <limits>
+#include <string>
 
 // GSL
 #include <gsl/string_span>
@@ -53,10 +54,30 @@ namespace Vcl { namespace Util
 		return hash;
 	}
 
+	/*!
+	 *	\brief Hash a string of known length
+	 *
+	 *	The string does not need to be terminated. The hash matches the one
+	 *	of the terminated string computed by the other methods.
+	 */
+	VCL_STRONG_INLINE VCL_CONSTEXPR_CPP14 unsigned int calculateFNV(const char* str, size_t length)
+	{
+		unsigned int hash = 2166136261u;
+
+		for (size_t i = 0; i < length; ++i)
+		{
+			hash ^= str[i];
+			hash *= 16777619u;
+		}
+
+		// Include the terminating zero
+		return hash * 16777619u;
+	}
+
 	template <unsigned int N, unsigned int I>
 	struct FnvHash
 	{
-		VCL_STRONG_INLINE static unsigned int hash(const char (&str)[N])
+		VCL_STRONG_INLINE VCL_CONSTEXPR_CPP11 static unsigned int hash(const char (&str)[N])
 		{
 			return (FnvHash<N, I-1>::hash(str) ^ str[I-1])*16777619u;
 		}
@@ -65,12 +86,21 @@ namespace Vcl { namespace Util
 	template <unsigned int N>
 	struct FnvHash<N, 1>
 	{
-		VCL_STRONG_INLINE static unsigned int hash(const char (&str)[N])
+		VCL_STRONG_INLINE VCL_CONSTEXPR_CPP11 static unsigned int hash(const char (&str)[N])
 		{
 			return (2166136261u ^ str[0])*16777619u;
 		}
 	};
 
+	/*!
+	 *	\brief FNV-1a hash of a string
+	 *
+	 *	Hashes of string literals are evaluated at compile time when the
+	 *	object is declared constexpr:
+	 *	\code
+	 *	constexpr StringHash key("Vertices");
+	 *	\endcode
+	 */
 	class StringHash
 	{ 
 	public:
@@ -93,11 +123,11 @@ namespace Vcl { namespace Util
 		}
 
 		VCL_STRONG_INLINE StringHash(gsl::cstring_span<> str)
-		: _hash(calculateFNV(str.data()))
+		: _hash(calculateFNV(str.data(), static_cast<size_t>(str.size())))
 		{
 		}
 
-		size_t hash() const
+		VCL_CONSTEXPR_CPP11 size_t hash() const
 		{
 			return _hash;
 		}
@@ -106,4 +136,52 @@ namespace Vcl { namespace Util
 		//! Computed hash value
 		size_t _hash;
 	};
+
+	/*!
+	 *	\brief String paired with its hash
+	 *
+	 *	Used as lookup key by containers indexed by names. The hash of a string
+	 *	literal is computed at compile time, other strings are hashed once on
+	 *	construction. The object does not own the string; it is meant to be
+	 *	passed to functions and must not outlive the string it refers to.
+	 */
+	class HashedString
+	{
+	public:
+		template <size_t N>
+		VCL_STRONG_INLINE VCL_CONSTEXPR_CPP11 HashedString(const char (&str)[N])
+		: _str(str)
+		, _length(N - 1)
+		, _hash(FnvHash<N, N>::hash(str))
+		{
+		}
+
+		VCL_STRONG_INLINE HashedString(const std::string& str)
+		: _str(str.data())
+		, _length(str.size())
+		, _hash(calculateFNV(str.data(), str.size()))
+		{
+		}
+
+		VCL_CONSTEXPR_CPP11 const char* data() const { return _str; }
+		VCL_CONSTEXPR_CPP11 size_t size() const { return _length; }
+		VCL_CONSTEXPR_CPP11 unsigned int hash() const { return _hash; }
+
+		std::string str() const { return{ _str, _length }; }
+
+		bool operator== (const std::string& str) const
+		{
+			return str.size() == _length && str.compare(0, _length, _str, _length) == 0;
+		}
+
+	private:
+		//! Referenced string
+		const char* _str;
+
+		//! Length of the string without the terminating zero
+		size_t _length;
+
+		//! Hash of the string
+		unsigned int _hash;
+	};
 }}
@@ -27,26 +27,53 @@
 // VCL configuration
 #include <vcl/config/global.h>
 
+// C++ standard library
+#include <climits>
+#include <cstdint>
+
 // VCL
 #include <vcl/core/contract.h>
 
+// pdep/pext are only used on request, as they are microcoded on AMD processors before Zen 3
+#if defined(VCL_USE_BMI2) && (defined(__BMI2__) || defined(VCL_COMPILER_MSVC))
+#	define VCL_MORTONCODE_BMI2
+#	include <immintrin.h>
+#endif
+
 namespace Vcl { namespace Util
 {
 	/*!
 	 * Original implementation can be found at: http://www.forceflow.be/2013/10/07/morton-encodingdecoding-through-bit-interleaving-implementations/
+	 *
+	 * The bits are (de-)interleaved using shifts and masks. If VCL_USE_BMI2 is set,
+	 * pdep and pext are used instead, which is only faster where they are not microcoded.
 	 */
 	class MortonCode
 	{
 	public:
+		//! Interleave three coordinates of 21 bits to a 63-bit code
 		VCL_STRONG_INLINE static uint64_t encode(uint32_t x, uint32_t y, uint32_t z)
 		{
+			Require((x & ~0x1fffff) == 0, "x is in only 21 bits large.");
+			Require((y & ~0x1fffff) == 0, "y is in only 21 bits large.");
+			Require((z & ~0x1fffff) == 0, "z is in only 21 bits large.");
+
+#ifdef VCL_MORTONCODE_BMI2
+			return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#else
 			uint64_t answer = 0;
 			answer |= splitBy3(x) | splitBy3(y) << 1 | splitBy3(z) << 2;
 			return answer;
+#endif // VCL_MORTONCODE_BMI2
 		}
 
 		VCL_STRONG_INLINE static void decode(uint64_t morton, uint32_t& x, uint32_t& y, uint32_t& z)
 		{
+#ifdef VCL_MORTONCODE_BMI2
+			x = static_cast<uint32_t>(_pext_u64(morton, 0x1249249249249249ull));
+			y = static_cast<uint32_t>(_pext_u64(morton, 0x2492492492492492ull));
+			z = static_cast<uint32_t>(_pext_u64(morton, 0x4924924924924924ull));
+#else
 			x = 0;
 			y = 0;
 			z = 0;
@@ -57,9 +84,57 @@ namespace Vcl { namespace Util
 				y |= ((morton & (uint64_t(1ull) << uint64_t((3ull * i) + 1ull))) >> uint64_t(((3ull * i) + 1ull) - i));
 				z |= ((morton & (uint64_t(1ull) << uint64_t((3ull * i) + 2ull))) >> uint64_t(((3ull * i) + 2ull) - i));
 			}
+#endif // VCL_MORTONCODE_BMI2
+		}
+
+		//! Interleave three coordinates of 10 bits to a 30-bit code
+		VCL_STRONG_INLINE static uint32_t encode30(uint32_t x, uint32_t y, uint32_t z)
+		{
+			Require((x & ~0x3ff) == 0, "x is in only 10 bits large.");
+			Require((y & ~0x3ff) == 0, "y is in only 10 bits large.");
+			Require((z & ~0x3ff) == 0, "z is in only 10 bits large.");
+
+#ifdef VCL_MORTONCODE_BMI2
+			return _pdep_u32(x, 0x09249249u) | _pdep_u32(y, 0x12492492u) | _pdep_u32(z, 0x24924924u);
+#else
+			return splitBy3_10(x) | splitBy3_10(y) << 1 | splitBy3_10(z) << 2;
+#endif // VCL_MORTONCODE_BMI2
+		}
+
+		VCL_STRONG_INLINE static void decode30(uint32_t morton, uint32_t& x, uint32_t& y, uint32_t& z)
+		{
+#ifdef VCL_MORTONCODE_BMI2
+			x = _pext_u32(morton, 0x09249249u);
+			y = _pext_u32(morton, 0x12492492u);
+			z = _pext_u32(morton, 0x24924924u);
+#else
+			x = compactBy3_10(morton);
+			y = compactBy3_10(morton >> 1);
+			z = compactBy3_10(morton >> 2);
+#endif // VCL_MORTONCODE_BMI2
 		}
 
 	private:
+		VCL_STRONG_INLINE static uint32_t splitBy3_10(uint32_t a)
+		{
+			uint32_t x = a & 0x3ff;
+			x = (x | x << 16) & 0x030000ff;
+			x = (x | x << 8) & 0x0300f00f;
+			x = (x | x << 4) & 0x030c30c3;
+			x = (x | x << 2) & 0x09249249;
+			return x;
+		}
+
+		VCL_STRONG_INLINE static uint32_t compactBy3_10(uint32_t a)
+		{
+			uint32_t x = a & 0x09249249;
+			x = (x | x >> 2) & 0x030c30c3;
+			x = (x | x >> 4) & 0x0300f00f;
+			x = (x | x >> 8) & 0x030000ff;
+			x = (x | x >> 16) & 0x3ff;
+			return x;
+		}
+
 		VCL_STRONG_INLINE static uint64_t splitBy3(uint32_t a)
 		{
 			Require((a & ~0x1fffff) == 0, "a is in only 21 bits large.");
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cstddef>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Util
+{
+	/*!
+	 *	\brief Invoke a function for chunks of an index range in parallel
+	 *	\param count Number of indices in the range [0, count)
+	 *	\param grain_size Number of indices processed as one chunk
+	 *	\param f Function with the signature (size_t first, size_t last),
+	 *	         called concurrently for different chunks
+	 *
+	 *	The chunks are distributed dynamically across the OpenMP threads.
+	 *	Without OpenMP (VCL_OPENMP_SUPPORT, disabled by default) all chunks
+	 *	are processed in order on the calling thread.
+	 */
+	template<typename Func>
+	void parallelForChunks(size_t count, size_t grain_size, Func&& f)
+	{
+		Require(grain_size > 0, "Chunks are not empty.");
+
+		const ptrdiff_t nr_chunks = static_cast<ptrdiff_t>((count + grain_size - 1) / grain_size);
+
+#ifdef _OPENMP
+#		pragma omp parallel for schedule(dynamic) if(nr_chunks > 1)
+#endif // _OPENMP
+		for (ptrdiff_t c = 0; c < nr_chunks; c++)
+		{
+			const size_t first = static_cast<size_t>(c) * grain_size;
+			const size_t last = std::min(first + grain_size, count);
+			f(first, last);
+		}
+	}
+
+	/*!
+	 *	\brief Invoke a function for each index of a range in parallel
+	 *	\param count Number of indices in the range [0, count)
+	 *	\param grain_size Number of indices processed as one chunk
+	 *	\param f Function with the signature (ptrdiff_t i)
+	 *
+	 *	See parallelForChunks. Runs serially without OpenMP.
+	 */
+	template<typename Func>
+	void parallelFor(size_t count, size_t grain_size, Func&& f)
+	{
+		parallelForChunks(count, grain_size, [&f](size_t first, size_t last)
+		{
+			for (size_t i = first; i < last; i++)
+				f(static_cast<ptrdiff_t>(i));
+		});
+	}
+}}
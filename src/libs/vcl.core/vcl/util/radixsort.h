@@ -0,0 +1,174 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// GSL
+#include <gsl/span>
+
+// OpenMP
+#ifdef _OPENMP
+#	include <omp.h>
+#endif // _OPENMP
+
+// VCL
+#include <vcl/core/contract.h>
+#include <vcl/util/parallelfor.h>
+
+namespace Vcl { namespace Util
+{
+	/*!
+	 *	\brief Sort key/value pairs by their unsigned integer keys
+	 *	\param keys Keys to sort
+	 *	\param values Values permuted along with the keys
+	 *	\param key_bits Number of low bits used by the keys
+	 *
+	 *	Stable least significant digit radix sort processing 11 bits per pass,
+	 *	such that the digit counters of a block fit into the L1 cache.
+	 *	The input is split into one block per thread. Each pass counts the
+	 *	digits of every block, from which the output offsets of each block
+	 *	are computed, such that all blocks are scattered concurrently.
+	 *	Passes over digits shared by all keys are skipped.
+	 */
+	template<typename KeyT, typename ValueT>
+	void radixSort(gsl::span<KeyT> keys, gsl::span<ValueT> values, unsigned int key_bits = sizeof(KeyT) * CHAR_BIT)
+	{
+		static_assert(std::is_integral<KeyT>::value && std::is_unsigned<KeyT>::value, "Keys are unsigned integers.");
+		Require(keys.size() == values.size(), "Each key has a value.");
+		Require(key_bits <= sizeof(KeyT) * CHAR_BIT, "Keys are large enough.");
+
+		const int RadixBits = 11;
+		const int NrBuckets = 1 << RadixBits;
+
+		// Size of the input from which it is distributed across threads
+		const ptrdiff_t ParallelThreshold = 1 << 16;
+
+		const ptrdiff_t n = static_cast<ptrdiff_t>(keys.size());
+		if (n < 2)
+			return;
+
+		ptrdiff_t nr_blocks = 1;
+#ifdef _OPENMP
+		if (n >= ParallelThreshold)
+			nr_blocks = omp_get_max_threads();
+#endif // _OPENMP
+		const ptrdiff_t block_size = (n + nr_blocks - 1) / nr_blocks;
+
+		std::vector<KeyT> tmp_keys(n);
+		std::vector<ValueT> tmp_values(n);
+		KeyT* src_keys = keys.data();
+		ValueT* src_values = values.data();
+		KeyT* dst_keys = tmp_keys.data();
+		ValueT* dst_values = tmp_values.data();
+
+		std::vector<std::array<ptrdiff_t, NrBuckets>> offsets(nr_blocks);
+
+		const unsigned int nr_passes = (key_bits + RadixBits - 1) / RadixBits;
+		for (unsigned int pass = 0; pass < nr_passes; pass++)
+		{
+			const unsigned int shift = pass * RadixBits;
+
+			// Count the digits of each block
+			parallelFor(nr_blocks, 1, [&](ptrdiff_t b)
+			{
+				auto& histogram = offsets[b];
+				histogram.fill(0);
+
+				const ptrdiff_t end = std::min(n, (b + 1) * block_size);
+				for (ptrdiff_t i = b * block_size; i < end; i++)
+					histogram[(src_keys[i] >> shift) & (NrBuckets - 1)]++;
+			});
+
+			// Skip the pass if all keys share the digit
+			bool trivial = false;
+			for (int d = 0; d < NrBuckets && !trivial; d++)
+			{
+				ptrdiff_t count = 0;
+				for (ptrdiff_t b = 0; b < nr_blocks; b++)
+					count += offsets[b][d];
+
+				if (count == n)
+					trivial = true;
+				else if (count > 0)
+					break;
+			}
+			if (trivial)
+				continue;
+
+			// Convert the counts to output offsets, ordered by digit and block
+			ptrdiff_t sum = 0;
+			for (int d = 0; d < NrBuckets; d++)
+			{
+				for (ptrdiff_t b = 0; b < nr_blocks; b++)
+				{
+					const ptrdiff_t count = offsets[b][d];
+					offsets[b][d] = sum;
+					sum += count;
+				}
+			}
+
+			// Scatter the blocks
+			parallelFor(nr_blocks, 1, [&](ptrdiff_t b)
+			{
+				auto& offset = offsets[b];
+
+				const ptrdiff_t end = std::min(n, (b + 1) * block_size);
+				for (ptrdiff_t i = b * block_size; i < end; i++)
+				{
+					const ptrdiff_t pos = offset[(src_keys[i] >> shift) & (NrBuckets - 1)]++;
+					dst_keys[pos] = src_keys[i];
+					dst_values[pos] = std::move(src_values[i]);
+				}
+			});
+
+			std::swap(src_keys, dst_keys);
+			std::swap(src_values, dst_values);
+		}
+
+		// Move the result back to the input
+		if (src_keys != keys.data())
+		{
+			parallelForChunks(n, ParallelThreshold, [&](size_t first, size_t last)
+			{
+				for (size_t i = first; i < last; i++)
+				{
+					keys[i] = src_keys[i];
+					values[i] = std::move(src_values[i]);
+				}
+			});
+		}
+	}
+}}
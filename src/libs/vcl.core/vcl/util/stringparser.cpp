@@ -187,6 +187,7 @@ namespace Vcl { namespace Util
 			((*_bufferReadPtr) >= '0' && (*_bufferReadPtr) <= '9') ||
 			 (*_bufferReadPtr) == '.' ||
 			 (*_bufferReadPtr) == '-' ||
+			 (*_bufferReadPtr) == '+' ||
 			 (*_bufferReadPtr) == 'E' ||
 			 (*_bufferReadPtr) == 'e'
 		)
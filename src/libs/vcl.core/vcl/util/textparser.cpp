@@ -0,0 +1,239 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/util/textparser.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace Vcl { namespace Util
+{
+	namespace
+	{
+		bool isDigit(char c)
+		{
+			return static_cast<unsigned char>(c - '0') < 10;
+		}
+
+		//! Check if the next eight characters are digits
+		bool isEightDigits(uint64_t chars)
+		{
+			return ((chars & 0xF0F0F0F0F0F0F0F0ull) | (((chars + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+		}
+
+		//! Convert eight digits loaded into a little-endian word
+		uint32_t convertEightDigits(uint64_t chars)
+		{
+			chars = (chars & 0x0F0F0F0F0F0F0F0Full) * 2561 >> 8;
+			chars = (chars & 0x00FF00FF00FF00FFull) * 6553601 >> 16;
+			return static_cast<uint32_t>((chars & 0x0000FFFF0000FFFFull) * 42949672960001ull >> 32);
+		}
+
+		/*!
+		 *	Accumulate the digits starting at \a ptr to \a mantissa. Digits not
+		 *	fitting into the mantissa are counted in \a dropped.
+		 */
+		const char* readDigits(const char* ptr, const char* end, uint64_t& mantissa, int& nr_digits, int& dropped)
+		{
+			// Convert blocks of eight digits as long as the mantissa cannot overflow
+			while (end - ptr >= 8 && nr_digits <= 11)
+			{
+				uint64_t chars;
+				memcpy(&chars, ptr, sizeof(chars));
+				if (!isEightDigits(chars))
+					break;
+
+				const uint32_t block = convertEightDigits(chars);
+				if (mantissa > 0)
+				{
+					nr_digits += 8;
+				}
+				else
+				{
+					// Leading zeros are not significant
+					for (uint32_t v = block; v > 0; v /= 10)
+						nr_digits++;
+				}
+
+				mantissa = mantissa * 100000000 + block;
+				ptr += 8;
+			}
+
+			for (; ptr < end && isDigit(*ptr); ++ptr)
+			{
+				if (nr_digits < 19)
+				{
+					mantissa = mantissa * 10 + (*ptr - '0');
+					nr_digits += mantissa > 0 ? 1 : 0;
+				}
+				else
+				{
+					dropped++;
+				}
+			}
+
+			return ptr;
+		}
+
+		const double Powers[] =
+		{
+			1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+	}
+
+	const char* parseInt(const char* begin, const char* end, int& value)
+	{
+		const char* ptr = begin;
+		bool negative = false;
+		if (ptr < end && (*ptr == '-' || *ptr == '+'))
+		{
+			negative = *ptr == '-';
+			++ptr;
+		}
+
+		const char* digits = ptr;
+		uint64_t mantissa = 0;
+		int nr_digits = 0;
+		int dropped = 0;
+		ptr = readDigits(ptr, end, mantissa, nr_digits, dropped);
+		if (ptr == digits)
+			return nullptr;
+
+		// Clamp values outside of the range of int
+		const uint64_t limit = negative ? uint64_t(std::numeric_limits<int>::max()) + 1 : uint64_t(std::numeric_limits<int>::max());
+		if (dropped > 0 || mantissa > limit)
+			mantissa = limit;
+
+		value = negative ? static_cast<int>(-static_cast<int64_t>(mantissa)) : static_cast<int>(mantissa);
+		return ptr;
+	}
+
+	const char* parseFloat(const char* begin, const char* end, float& value)
+	{
+		const char* ptr = begin;
+		bool negative = false;
+		if (ptr < end && (*ptr == '-' || *ptr == '+'))
+		{
+			negative = *ptr == '-';
+			++ptr;
+		}
+
+		uint64_t mantissa = 0;
+		int nr_digits = 0;
+		int dropped = 0;
+
+		// Integer part, dropped digits increase the exponent
+		const char* int_begin = ptr;
+		ptr = readDigits(ptr, end, mantissa, nr_digits, dropped);
+		bool has_digits = ptr != int_begin;
+		int exponent = dropped;
+
+		// Fractional part, accepted digits decrease the exponent
+		if (ptr < end && *ptr == '.')
+		{
+			++ptr;
+			const char* frac_begin = ptr;
+			int frac_dropped = 0;
+			ptr = readDigits(ptr, end, mantissa, nr_digits, frac_dropped);
+			exponent -= static_cast<int>(ptr - frac_begin) - frac_dropped;
+			has_digits = has_digits || ptr != frac_begin;
+		}
+
+		if (!has_digits)
+			return nullptr;
+
+		// Exponent, only consumed if it is complete
+		if (ptr < end && (*ptr == 'e' || *ptr == 'E'))
+		{
+			const char* exp_ptr = ptr + 1;
+			bool exp_negative = false;
+			if (exp_ptr < end && (*exp_ptr == '-' || *exp_ptr == '+'))
+			{
+				exp_negative = *exp_ptr == '-';
+				++exp_ptr;
+			}
+
+			if (exp_ptr < end && isDigit(*exp_ptr))
+			{
+				int exp = 0;
+				for (; exp_ptr < end && isDigit(*exp_ptr); ++exp_ptr)
+					exp = std::min(exp * 10 + (*exp_ptr - '0'), 100000);
+
+				exponent += exp_negative ? -exp : exp;
+				ptr = exp_ptr;
+			}
+		}
+
+		double result;
+		if (mantissa == 0)
+		{
+			result = 0;
+		}
+		else if (mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22)
+		{
+			// Both operands are exact, the operation rounds once
+			result = static_cast<double>(mantissa);
+			result = exponent < 0 ? result / Powers[-exponent] : result * Powers[exponent];
+		}
+		else
+		{
+			// Rare case, use the slow path on a copy of the number
+			std::string number(begin, ptr);
+			value = std::strtof(number.c_str(), nullptr);
+			return ptr;
+		}
+
+		value = static_cast<float>(negative ? -result : result);
+		return ptr;
+	}
+
+	std::vector<gsl::span<const char>> splitLines(gsl::span<const char> text, size_t nr_chunks)
+	{
+		std::vector<gsl::span<const char>> chunks;
+
+		const char* begin = text.data();
+		const char* end = text.data() + text.size();
+		const size_t chunk_size = (static_cast<size_t>(text.size()) + std::max<size_t>(nr_chunks, 1) - 1) / std::max<size_t>(nr_chunks, 1);
+		while (begin < end)
+		{
+			// Extend the chunk to the end of the line
+			const char* split = begin + std::min<size_t>(chunk_size, end - begin);
+			if (split < end)
+			{
+				const void* eol = memchr(split, '\n', end - split);
+				split = eol ? static_cast<const char*>(eol) + 1 : end;
+			}
+
+			chunks.emplace_back(begin, split - begin);
+			begin = split;
+		}
+
+		return chunks;
+	}
+}}
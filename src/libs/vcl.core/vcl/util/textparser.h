@@ -0,0 +1,194 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstring>
+#include <vector>
+
+// GSL
+#include <gsl/span>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Util
+{
+	/*!
+	 *	\brief Parse a decimal integer
+	 *	\param begin Start of the text. Leading white space is not skipped.
+	 *	\param end End of the text
+	 *	\param value Parsed value
+	 *	\returns the position after the number, nullptr if no number was found
+	 *
+	 *	The conversion does not depend on the locale. Runs of eight digits are
+	 *	converted at once.
+	 */
+	const char* parseInt(const char* begin, const char* end, int& value);
+
+	/*!
+	 *	\brief Parse a decimal floating point number
+	 *	\param begin Start of the text. Leading white space is not skipped.
+	 *	\param end End of the text
+	 *	\param value Parsed value
+	 *	\returns the position after the number, nullptr if no number was found
+	 *
+	 *	Accepts numbers of the form [+-]digits[.digits][(e|E)[+-]digits]. The
+	 *	decimal separator is always '.'. Numbers with up to 15 significant digits
+	 *	and decimal exponents up to 22 are converted with a single rounding in
+	 *	double precision. Other numbers fall back to strtof.
+	 */
+	const char* parseFloat(const char* begin, const char* end, float& value);
+
+	/*!
+	 *	\brief Split a text into chunks of complete lines
+	 *	\param text Text to split
+	 *	\param nr_chunks Number of requested chunks
+	 *	\returns at most \a nr_chunks non-empty chunks of roughly equal size
+	 *
+	 *	Each chunk ends after a line break or at the end of the text.
+	 */
+	std::vector<gsl::span<const char>> splitLines(gsl::span<const char> text, size_t nr_chunks);
+
+	/*!
+	 *	\brief Line-wise reader on a memory buffer
+	 *
+	 *	The reader does not copy or modify the text, such that multiple readers
+	 *	can process chunks of the same buffer concurrently.
+	 */
+	class TextReader
+	{
+	public:
+		TextReader(gsl::span<const char> text)
+		: _ptr(text.data())
+		, _lineEnd(text.data())
+		, _end(text.data() + text.size())
+		{
+		}
+
+	public:
+		//! Advance to the next line. Returns false at the end of the text.
+		bool nextLine()
+		{
+			// Skip the line break of the current line
+			if (_started && _lineEnd < _end)
+				_ptr = _lineEnd + 1;
+			else
+				_ptr = _lineEnd;
+			_started = true;
+
+			if (_ptr >= _end)
+				return false;
+
+			const void* eol = memchr(_ptr, '\n', _end - _ptr);
+			_lineEnd = eol ? static_cast<const char*>(eol) : _end;
+			return true;
+		}
+
+		//! Start of the line following the current line
+		const char* nextLineBegin() const
+		{
+			return _lineEnd < _end ? _lineEnd + 1 : _end;
+		}
+
+		//! Check if the remainder of the line is empty
+		bool atLineEnd()
+		{
+			skipWhiteSpace();
+			return _ptr == _lineEnd;
+		}
+
+		//! Check if the next token starts with \a c
+		bool startsWith(char c)
+		{
+			skipWhiteSpace();
+			return _ptr < _lineEnd && *_ptr == c;
+		}
+
+		//! Read \a keyword, if it is the next token of the line
+		bool readKeyword(const char* keyword)
+		{
+			skipWhiteSpace();
+
+			const size_t length = strlen(keyword);
+			if (static_cast<size_t>(_lineEnd - _ptr) < length || memcmp(_ptr, keyword, length) != 0)
+				return false;
+			if (_ptr + length < _lineEnd && !isWhiteSpace(_ptr[length]))
+				return false;
+
+			_ptr += length;
+			return true;
+		}
+
+		bool readInt(int& value)
+		{
+			skipWhiteSpace();
+			return advance(parseInt(_ptr, _lineEnd, value));
+		}
+
+		bool readFloat(float& value)
+		{
+			skipWhiteSpace();
+			return advance(parseFloat(_ptr, _lineEnd, value));
+		}
+
+	private:
+		static bool isWhiteSpace(char c)
+		{
+			return c == ' ' || c == '\t' || c == '\r';
+		}
+
+		void skipWhiteSpace()
+		{
+			while (_ptr < _lineEnd && isWhiteSpace(*_ptr))
+				++_ptr;
+		}
+
+		bool advance(const char* ptr)
+		{
+			if (!ptr)
+				return false;
+
+			_ptr = ptr;
+			return true;
+		}
+
+	private:
+		//! Current read position
+		const char* _ptr;
+
+		//! End of the current line
+		const char* _lineEnd;
+
+		//! End of the text
+		const char* _end;
+
+		//! Was the first line loaded
+		bool _started{ false };
+	};
+}}
@@ -32,6 +32,10 @@
 // GSL
 #include <gsl/gsl>
 
+// VCL
+#include <vcl/core/simd/instructionset.h>
+#include <vcl/util/waveletnoise_kernels.h>
+
 namespace Vcl { namespace Util
 {
 	template<int N> WaveletNoise<N>::WaveletNoise()
@@ -164,6 +168,42 @@ namespace Vcl { namespace Util
 		return result;
 	}
 
+	template<int N> void WaveletNoise<N>::evaluate
+	(
+		const Core::InterleavedArray<float, 3, 1, Core::DynamicStride>& p,
+		Core::InterleavedArray<float, 1, 1, Core::DynamicStride>& result
+	) const
+	{
+		Require(result.size() >= p.size(), "Result array is large enough.");
+
+		const size_t count = p.size();
+		if (count == 0)
+			return;
+
+		// The components of the points are stored consecutively
+		const float* x = &p.at<float>(0)(0);
+		const float* y = &p.at<float>(0)(1);
+		const float* z = &p.at<float>(0)(2);
+		float* out = &result.at<float>(0)(0);
+
+		// Select the widest kernel supported by the processor
+		Detail::WaveletNoiseKernel kernel = nullptr;
+		const InstructionSet isa = activeInstructionSet();
+		if (isa >= InstructionSet::AVX512)
+			kernel = Detail::waveletNoiseKernelAVX512();
+		if (!kernel && isa >= InstructionSet::AVX2)
+			kernel = Detail::waveletNoiseKernelAVX2();
+
+		size_t i = kernel ? kernel(_noiseTileData.data(), N, x, y, z, out, count) : 0;
+
+		// Evaluate the remaining points
+		for (; i < count; i++)
+		{
+			const float q[3] = { x[i], y[i], z[i] };
+			out[i] = evaluate(q);
+		}
+	}
+
 	template<int N> float WaveletNoise<N>::evaluate(const float p[3], float normal[3]) const
 	{
 		int c[3], minimum[3], maximum[3];
@@ -33,6 +33,7 @@
 
 // VCL
 #include <vcl/core/contract.h>
+#include <vcl/core/interleavedarray.h>
 
 namespace Vcl { namespace Util
 {
@@ -45,7 +46,7 @@ namespace Vcl { namespace Util
 	
 	template<> VCL_CONSTEXPR_CPP11 inline int fast_modulo<128>(int x) { return x & 127; }
 	template<> VCL_CONSTEXPR_CPP11 inline int fast_modulo< 64>(int x) { return x &  63; }
-	template<> VCL_CONSTEXPR_CPP11 inline int fast_modulo< 32>(int x) { return x &  32; }
+	template<> VCL_CONSTEXPR_CPP11 inline int fast_modulo< 32>(int x) { return x &  31; }
 	template<> VCL_CONSTEXPR_CPP11 inline int fast_modulo< 16>(int x) { return x &  15; }
 
 	/*!
@@ -63,6 +64,20 @@ namespace Vcl { namespace Util
 		float evaluate(const float p[3], float normal[3]) const;
 		float evaluate(const float p[3], float s, float normal[3], int first_band, int nr_bands, float *w) const;
 
+		/*!
+		 *	\brief Evaluate the noise for a batch of points
+		 *
+		 *	Uses the widest SIMD kernel supported by the processor.
+		 *
+		 *	\param p      Points at which the noise is evaluated
+		 *	\param result Noise value for each of the points
+		 */
+		void evaluate
+		(
+			const Core::InterleavedArray<float, 3, 1, Core::DynamicStride>& p,
+			Core::InterleavedArray<float, 1, 1, Core::DynamicStride>& result
+		) const;
+
 		float dx(const float p[3]) const;
 		float dy(const float p[3]) const;
 		float dz(const float p[3]) const;
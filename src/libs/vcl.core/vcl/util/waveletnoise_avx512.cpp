@@ -0,0 +1,106 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/util/waveletnoise_kernels.h>
+
+#ifdef VCL_VECTORIZE_AVX512
+
+// C++ standard library
+#include <immintrin.h>
+
+namespace Vcl { namespace Util { namespace Detail
+{
+	namespace
+	{
+		// Quadratic B-spline basis functions along a single axis
+		VCL_STRONG_INLINE void computeWeights(__m512 p, __m512i& mid, __m512 w[3])
+		{
+			const __m512 half = _mm512_set1_ps(0.5f);
+			const __m512 one  = _mm512_set1_ps(1.0f);
+
+			const __m512 q = _mm512_sub_ps(p, half);
+			const __m512 c = _mm512_roundscale_ps(q, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+			mid = _mm512_cvtps_epi32(c);
+
+			const __m512 t = _mm512_sub_ps(c, q);
+			const __m512 s = _mm512_sub_ps(one, t);
+			w[0] = _mm512_mul_ps(_mm512_mul_ps(t, t), half);
+			w[2] = _mm512_mul_ps(_mm512_mul_ps(s, s), half);
+			w[1] = _mm512_sub_ps(_mm512_sub_ps(one, w[0]), w[2]);
+		}
+
+		size_t evaluate(const float* tile, int n, const float* x, const float* y, const float* z, float* result, size_t count)
+		{
+			const __m512i mask = _mm512_set1_epi32(n - 1);
+			const __m512i row = _mm512_set1_epi32(n);
+			const __m512i slice = _mm512_set1_epi32(n*n);
+
+			size_t i = 0;
+			for (; i + 16 <= count; i += 16)
+			{
+				__m512i mid[3];
+				__m512 w[3][3];
+				computeWeights(_mm512_loadu_ps(x + i), mid[0], w[0]);
+				computeWeights(_mm512_loadu_ps(y + i), mid[1], w[1]);
+				computeWeights(_mm512_loadu_ps(z + i), mid[2], w[2]);
+
+				// Loop over the noise coefficients within the bound
+				__m512 acc = _mm512_setzero_ps();
+				for (int fz = -1; fz <= 1; fz++)
+				{
+					const __m512i cz = _mm512_and_si512(_mm512_add_epi32(mid[2], _mm512_set1_epi32(fz)), mask);
+					for (int fy = -1; fy <= 1; fy++)
+					{
+						const __m512i cy = _mm512_and_si512(_mm512_add_epi32(mid[1], _mm512_set1_epi32(fy)), mask);
+						const __m512i cyz = _mm512_add_epi32(_mm512_mullo_epi32(cz, slice), _mm512_mullo_epi32(cy, row));
+						for (int fx = -1; fx <= 1; fx++)
+						{
+							const __m512i cx = _mm512_and_si512(_mm512_add_epi32(mid[0], _mm512_set1_epi32(fx)), mask);
+							const __m512 weight = _mm512_mul_ps(_mm512_mul_ps(w[0][fx + 1], w[1][fy + 1]), w[2][fz + 1]);
+							const __m512 coeff = _mm512_i32gather_ps(_mm512_add_epi32(cyz, cx), tile, 4);
+							acc = _mm512_add_ps(acc, _mm512_mul_ps(weight, coeff));
+						}
+					}
+				}
+				_mm512_storeu_ps(result + i, acc);
+			}
+
+			return i;
+		}
+	}
+
+	WaveletNoiseKernel waveletNoiseKernelAVX512()
+	{
+		return &evaluate;
+	}
+}}}
+#else
+namespace Vcl { namespace Util { namespace Detail
+{
+	WaveletNoiseKernel waveletNoiseKernelAVX512()
+	{
+		return nullptr;
+	}
+}}}
+#endif // VCL_VECTORIZE_AVX512
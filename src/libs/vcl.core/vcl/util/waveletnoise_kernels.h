@@ -0,0 +1,50 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstddef>
+
+namespace Vcl { namespace Util { namespace Detail
+{
+	/*!
+	 *	Evaluate the wavelet noise for a batch of points.
+	 *	\param tile   Noise coefficients of an n^3 tile, n being a power of two
+	 *	\param n      Size of the tile
+	 *	\param x,y,z  Coordinates of the points
+	 *	\param result Noise value for each point
+	 *	\param count  Number of points
+	 *	\returns the number of points processed. The remaining points are
+	 *			 left to the caller.
+	 */
+	using WaveletNoiseKernel = size_t (*)(const float* tile, int n, const float* x, const float* y, const float* z, float* result, size_t count);
+
+	//! \returns the kernel using the given instruction set, nullptr if it was not built
+	WaveletNoiseKernel waveletNoiseKernelAVX2();
+	WaveletNoiseKernel waveletNoiseKernelAVX512();
+}}}
@@ -0,0 +1,648 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/geometry/bvh.h>
+
+// C++ standard library
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+// VCL
+#include <vcl/util/mortoncodes.h>
+#include <vcl/util/parallelfor.h>
+#include <vcl/util/radixsort.h>
+
+#ifdef VCL_COMPILER_MSVC
+#	include <intrin.h>
+#endif
+
+namespace Vcl { namespace Geometry
+{
+	namespace
+	{
+		//! Number of primitives or nodes processed as one parallel chunk
+		const size_t GrainSize = 1024;
+
+		//! Number of bins used to evaluate the surface area heuristic
+		const int NrBins = 16;
+
+		//! Depth from which nodes are split at the object median
+		const int MedianSplitDepth = 48;
+
+		//! Number of primitives from which subtrees are built in separate tasks
+		const uint32_t TaskThreshold = 4096;
+
+		//! Cost of traversing a node relative to testing a primitive
+		const float TraversalCost = 1.0f;
+
+		//! Number of primitives from which 63-bit Morton codes are used
+		const uint32_t LongMortonCodeThreshold = 1 << 20;
+
+		float halfArea(const Eigen::AlignedBox3f& box)
+		{
+			if (box.isEmpty())
+				return 0.0f;
+
+			const Eigen::Vector3f d = box.sizes();
+			return d.x() * d.y() + d.y() * d.z() + d.z() * d.x();
+		}
+
+		int countLeadingZeros(uint64_t x)
+		{
+			if (x == 0)
+				return 64;
+
+#ifdef VCL_COMPILER_MSVC
+			unsigned long idx;
+			_BitScanReverse64(&idx, x);
+			return 63 - static_cast<int>(idx);
+#else
+			return __builtin_clzll(x);
+#endif
+		}
+
+		uint32_t mortonCode(uint32_t x, uint32_t y, uint32_t z, uint32_t)
+		{
+			return Vcl::Util::MortonCode::encode30(x, y, z);
+		}
+
+		uint64_t mortonCode(uint32_t x, uint32_t y, uint32_t z, uint64_t)
+		{
+			return Vcl::Util::MortonCode::encode(x, y, z);
+		}
+	}
+
+	template<int Width>
+	struct Bvh<Width>::BuildContext
+	{
+		//! Node of the intermediate binary tree
+		struct BuildNode
+		{
+			Eigen::AlignedBox3f bounds;
+			uint32_t children[2];
+			uint32_t first;
+			uint32_t count;
+		};
+
+		gsl::span<const Eigen::AlignedBox3f> boxes;
+		std::vector<Eigen::Vector3f> centroids;
+		std::vector<BuildNode> nodes;
+		std::atomic<uint32_t> nrNodes{ 0 };
+
+		//! Subtrees up to this size are stored as single leaf
+		uint32_t leafSize{ 0 };
+	};
+
+	template<int Width>
+	Bvh<Width>::Bvh(gsl::span<const Eigen::AlignedBox3f> boxes, BvhBuilder builder)
+	{
+		build(boxes, builder);
+	}
+
+	template<int Width>
+	void Bvh<Width>::build(gsl::span<const Eigen::AlignedBox3f> boxes, BvhBuilder builder)
+	{
+		_nodes.clear();
+		_indices.clear();
+		if (boxes.empty())
+			return;
+
+		const uint32_t nr_primitives = static_cast<uint32_t>(boxes.size());
+
+		BuildContext ctx;
+		ctx.boxes = boxes;
+		ctx.centroids.resize(nr_primitives);
+		ctx.nodes.resize(2 * nr_primitives - 1);
+		ctx.nrNodes = 1;
+
+		_indices.resize(nr_primitives);
+
+		const ptrdiff_t n = static_cast<ptrdiff_t>(nr_primitives);
+		Util::parallelFor(n, GrainSize, [&](ptrdiff_t i)
+		{
+			ctx.centroids[i] = boxes[i].center();
+			_indices[i] = static_cast<uint32_t>(i);
+		});
+
+		if (builder == BvhBuilder::Morton)
+		{
+			// The linear builder creates a leaf per primitive
+			ctx.leafSize = MaxLeafSize;
+			if (nr_primitives < LongMortonCodeThreshold)
+				buildMorton<uint32_t>(ctx, 30);
+			else
+				buildMorton<uint64_t>(ctx, 63);
+		}
+		else
+		{
+			BuildContext* ctx_ptr = &ctx;
+#ifdef _OPENMP
+#	pragma omp parallel
+#	pragma omp single
+#endif // _OPENMP
+			build(*ctx_ptr, 0, 0, nr_primitives, 0);
+		}
+
+		// Convert the binary tree to the wide representation
+		collapse(ctx);
+	}
+
+	template<int Width>
+	void Bvh<Width>::build(BuildContext& ctx, uint32_t node_idx, uint32_t first, uint32_t count, int depth)
+	{
+		auto& node = ctx.nodes[node_idx];
+		node.first = first;
+		node.count = count;
+		node.children[0] = node.children[1] = InvalidNode;
+
+		Eigen::AlignedBox3f centroid_bounds;
+		node.bounds.setEmpty();
+		for (uint32_t i = first; i < first + count; i++)
+		{
+			node.bounds.extend(ctx.boxes[_indices[i]]);
+			centroid_bounds.extend(ctx.centroids[_indices[i]]);
+		}
+
+		if (count == 1 || depth >= MaxDepth)
+			return;
+
+		// Evaluate the binned surface area heuristic along all axes
+		const Eigen::Vector3f extent = centroid_bounds.sizes();
+		int best_axis = -1;
+		int best_split = 0;
+		float best_cost = std::numeric_limits<float>::max();
+		if (depth < MedianSplitDepth)
+		{
+			for (int axis = 0; axis < 3; axis++)
+			{
+				if (!(extent[axis] > 0))
+					continue;
+
+				const float scale = NrBins / extent[axis];
+				std::array<Eigen::AlignedBox3f, NrBins> bin_bounds;
+				std::array<uint32_t, NrBins> bin_count;
+				bin_count.fill(0);
+				for (uint32_t i = first; i < first + count; i++)
+				{
+					const uint32_t p = _indices[i];
+					const int b = std::min(NrBins - 1, static_cast<int>((ctx.centroids[p][axis] - centroid_bounds.min()[axis]) * scale));
+					bin_count[b]++;
+					bin_bounds[b].extend(ctx.boxes[p]);
+				}
+
+				// Sweep from the right to accumulate the costs of the right partitions
+				std::array<float, NrBins> right_cost;
+				Eigen::AlignedBox3f acc;
+				uint32_t acc_count = 0;
+				for (int b = NrBins - 1; b > 0; b--)
+				{
+					acc.extend(bin_bounds[b]);
+					acc_count += bin_count[b];
+					right_cost[b] = halfArea(acc) * acc_count;
+				}
+
+				acc.setEmpty();
+				acc_count = 0;
+				for (int b = 0; b < NrBins - 1; b++)
+				{
+					acc.extend(bin_bounds[b]);
+					acc_count += bin_count[b];
+					if (acc_count == 0 || acc_count == count)
+						continue;
+
+					const float cost = halfArea(acc) * acc_count + right_cost[b + 1];
+					if (cost < best_cost)
+					{
+						best_cost = cost;
+						best_axis = axis;
+						best_split = b + 1;
+					}
+				}
+			}
+		}
+
+		uint32_t mid = first;
+		if (best_axis >= 0)
+		{
+			const float area = halfArea(node.bounds);
+			const float split_cost = TraversalCost + (area > 0 ? best_cost / area : static_cast<float>(count));
+			if (count <= MaxLeafSize && static_cast<float>(count) <= split_cost)
+				return;
+
+			const float scale = NrBins / extent[best_axis];
+			const float offset = centroid_bounds.min()[best_axis];
+			auto begin = _indices.begin() + first;
+			auto pivot = std::partition(begin, begin + count, [&ctx, best_axis, best_split, scale, offset](uint32_t p)
+			{
+				const int b = std::min(NrBins - 1, static_cast<int>((ctx.centroids[p][best_axis] - offset) * scale));
+				return b < best_split;
+			});
+			mid = static_cast<uint32_t>(pivot - _indices.begin());
+		}
+		else if (count <= MaxLeafSize)
+		{
+			return;
+		}
+
+		if (mid == first || mid == first + count)
+		{
+			// Fall back to the object median along the largest centroid extent
+			int axis = 0;
+			extent.maxCoeff(&axis);
+
+			mid = first + count / 2;
+			auto begin = _indices.begin() + first;
+			std::nth_element(begin, _indices.begin() + mid, begin + count, [&ctx, axis](uint32_t a, uint32_t b)
+			{
+				return ctx.centroids[a][axis] < ctx.centroids[b][axis];
+			});
+		}
+
+		const uint32_t left = ctx.nrNodes.fetch_add(2);
+		node.children[0] = left;
+		node.children[1] = left + 1;
+
+		BuildContext* ctx_ptr = &ctx;
+#ifdef _OPENMP
+#	pragma omp task if(count > TaskThreshold)
+#endif // _OPENMP
+		build(*ctx_ptr, left, first, mid - first, depth + 1);
+		build(ctx, left + 1, mid, first + count - mid, depth + 1);
+#ifdef _OPENMP
+#	pragma omp taskwait
+#endif // _OPENMP
+	}
+
+	template<int Width>
+	template<typename KeyT>
+	void Bvh<Width>::buildMorton(BuildContext& ctx, unsigned int key_bits)
+	{
+		const uint32_t n = static_cast<uint32_t>(ctx.boxes.size());
+		const ptrdiff_t nr_primitives = static_cast<ptrdiff_t>(n);
+
+		// Bounds of the box centres, which are quantised to the key resolution
+		Eigen::AlignedBox3f centroid_bounds;
+#ifdef _OPENMP
+#	pragma omp parallel
+#endif // _OPENMP
+		{
+			Eigen::AlignedBox3f local_bounds;
+#ifdef _OPENMP
+#	pragma omp for nowait
+#endif // _OPENMP
+			for (ptrdiff_t i = 0; i < nr_primitives; i++)
+				local_bounds.extend(ctx.centroids[i]);
+
+#ifdef _OPENMP
+#	pragma omp critical
+#endif // _OPENMP
+			centroid_bounds.extend(local_bounds);
+		}
+
+		const uint32_t max_coord = (1u << (key_bits / 3)) - 1;
+		const Eigen::Vector3f extent = centroid_bounds.sizes();
+		const Eigen::Vector3f scale
+		{
+			extent.x() > 0 ? max_coord / extent.x() : 0.0f,
+			extent.y() > 0 ? max_coord / extent.y() : 0.0f,
+			extent.z() > 0 ? max_coord / extent.z() : 0.0f
+		};
+
+		std::vector<KeyT> keys(n);
+		Util::parallelFor(nr_primitives, GrainSize, [&](ptrdiff_t i)
+		{
+			const Eigen::Vector3f q = (ctx.centroids[i] - centroid_bounds.min()).cwiseProduct(scale);
+			const uint32_t x = std::min(max_coord, static_cast<uint32_t>(q.x()));
+			const uint32_t y = std::min(max_coord, static_cast<uint32_t>(q.y()));
+			const uint32_t z = std::min(max_coord, static_cast<uint32_t>(q.z()));
+			keys[i] = mortonCode(x, y, z, KeyT{});
+		});
+
+		Vcl::Util::radixSort(gsl::span<KeyT>{ keys }, gsl::span<uint32_t>{ _indices }, key_bits);
+
+		// Length of the common prefix of two sorted keys. Duplicated keys are
+		// distinguished by their position.
+		auto delta = [&keys, nr_primitives](ptrdiff_t i, ptrdiff_t j) -> int
+		{
+			if (j < 0 || j >= nr_primitives)
+				return -1;
+
+			if (keys[i] == keys[j])
+				return 64 + countLeadingZeros(static_cast<uint64_t>(i ^ j));
+
+			return countLeadingZeros(static_cast<uint64_t>(keys[i] ^ keys[j]));
+		};
+
+		// Inner nodes are stored first, followed by one leaf per primitive
+		// (Karras, "Maximizing parallelism in the construction of BVHs,
+		// octrees, and k-d trees", HPG 2012)
+		const uint32_t first_leaf = n - 1;
+		std::vector<uint32_t> parents(2 * n - 1, InvalidNode);
+		Util::parallelFor(nr_primitives, GrainSize, [&](ptrdiff_t i)
+		{
+			auto& leaf = ctx.nodes[first_leaf + i];
+			leaf.first = static_cast<uint32_t>(i);
+			leaf.count = 1;
+			leaf.children[0] = leaf.children[1] = InvalidNode;
+			leaf.bounds = ctx.boxes[_indices[i]];
+		});
+
+		Util::parallelFor(nr_primitives - 1, 1024, [&](ptrdiff_t i)
+		{
+			// Direction of the range covered by the node
+			const int d = delta(i, i + 1) > delta(i, i - 1) ? 1 : -1;
+
+			// Upper bound of the range length
+			const int delta_min = delta(i, i - d);
+			ptrdiff_t l_max = 2;
+			while (delta(i, i + l_max * d) > delta_min)
+				l_max *= 2;
+
+			// Other end of the range
+			ptrdiff_t l = 0;
+			for (ptrdiff_t t = l_max / 2; t >= 1; t /= 2)
+			{
+				if (delta(i, i + (l + t) * d) > delta_min)
+					l += t;
+			}
+			const ptrdiff_t j = i + l * d;
+
+			// Split position
+			const int delta_node = delta(i, j);
+			ptrdiff_t s = 0;
+			for (ptrdiff_t t = (l + 1) / 2; ; t = (t + 1) / 2)
+			{
+				if (delta(i, i + (s + t) * d) > delta_node)
+					s += t;
+				if (t == 1)
+					break;
+			}
+			const ptrdiff_t gamma = i + s * d + std::min(d, 0);
+
+			const ptrdiff_t first = std::min(i, j);
+			const ptrdiff_t last = std::max(i, j);
+
+			auto& node = ctx.nodes[i];
+			node.first = static_cast<uint32_t>(first);
+			node.count = static_cast<uint32_t>(last - first + 1);
+			node.children[0] = static_cast<uint32_t>(first == gamma ? first_leaf + gamma : gamma);
+			node.children[1] = static_cast<uint32_t>(last == gamma + 1 ? first_leaf + gamma + 1 : gamma + 1);
+			parents[node.children[0]] = static_cast<uint32_t>(i);
+			parents[node.children[1]] = static_cast<uint32_t>(i);
+		});
+
+		// Compute the bounds bottom-up. The second thread arriving at an
+		// inner node merges the bounds of its children.
+		std::vector<std::atomic<uint32_t>> visits(n - 1);
+		Util::parallelFor(nr_primitives - 1, GrainSize, [&](ptrdiff_t i)
+		{
+			visits[i].store(0, std::memory_order_relaxed);
+		});
+
+		Util::parallelFor(nr_primitives, GrainSize, [&](ptrdiff_t i)
+		{
+			uint32_t node = parents[first_leaf + i];
+			while (node != InvalidNode)
+			{
+				if (visits[node].fetch_add(1, std::memory_order_acq_rel) == 0)
+					break;
+
+				auto& inner = ctx.nodes[node];
+				inner.bounds = ctx.nodes[inner.children[0]].bounds;
+				inner.bounds.extend(ctx.nodes[inner.children[1]].bounds);
+				node = parents[node];
+			}
+		});
+
+		ctx.nrNodes = 2 * n - 1;
+	}
+
+	template<int Width>
+	void Bvh<Width>::collapse(const BuildContext& ctx)
+	{
+		auto is_leaf = [&ctx](uint32_t idx)
+		{
+			const auto& node = ctx.nodes[idx];
+			return node.children[0] == InvalidNode || node.count <= ctx.leafSize;
+		};
+
+		// Wide nodes are emitted level by level, thus children are stored
+		// after their parents. The slots of all nodes are selected before
+		// the nodes are written.
+		std::vector<std::array<uint32_t, Width>> slots;
+		std::vector<uint32_t> first_child;
+		std::vector<uint32_t> level(1, 0);
+		std::vector<uint32_t> next_level;
+		while (!level.empty())
+		{
+			const ptrdiff_t level_size = static_cast<ptrdiff_t>(level.size());
+			const size_t level_offset = slots.size();
+			slots.resize(level_offset + level_size);
+			first_child.resize(level_offset + level_size);
+
+			// Open the inner child with the largest surface until all slots are used
+			Util::parallelFor(level_size, 256, [&](ptrdiff_t n)
+			{
+				auto& node_slots = slots[level_offset + n];
+				float areas[Width];
+				int nr_slots = 0;
+				auto add = [&ctx, &is_leaf, &node_slots, &areas, &nr_slots](uint32_t idx)
+				{
+					node_slots[nr_slots] = idx;
+					areas[nr_slots] = is_leaf(idx) ? -1.0f : halfArea(ctx.nodes[idx].bounds);
+					nr_slots++;
+				};
+
+				const auto& root = ctx.nodes[level[n]];
+				if (is_leaf(level[n]))
+				{
+					add(level[n]);
+				}
+				else
+				{
+					add(root.children[0]);
+					add(root.children[1]);
+				}
+
+				while (nr_slots < Width)
+				{
+					int largest = -1;
+					float largest_area = -1;
+					for (int i = 0; i < nr_slots; i++)
+					{
+						if (areas[i] > largest_area)
+						{
+							largest = i;
+							largest_area = areas[i];
+						}
+					}
+					if (largest < 0)
+						break;
+
+					const auto& child = ctx.nodes[node_slots[largest]];
+					nr_slots--;
+					std::swap(node_slots[largest], node_slots[nr_slots]);
+					std::swap(areas[largest], areas[nr_slots]);
+					add(child.children[0]);
+					add(child.children[1]);
+				}
+
+				for (int i = nr_slots; i < Width; i++)
+					node_slots[i] = InvalidNode;
+			});
+
+			// Children of the level are stored consecutively after the level
+			next_level.clear();
+			for (ptrdiff_t n = 0; n < level_size; n++)
+			{
+				first_child[level_offset + n] = static_cast<uint32_t>(level_offset + level_size + next_level.size());
+				for (uint32_t idx : slots[level_offset + n])
+				{
+					if (idx != InvalidNode && !is_leaf(idx))
+						next_level.push_back(idx);
+				}
+			}
+
+			level.swap(next_level);
+		}
+
+		const ptrdiff_t nr_nodes = static_cast<ptrdiff_t>(slots.size());
+		_nodes.resize(nr_nodes);
+		Util::parallelFor(nr_nodes, GrainSize, [&](ptrdiff_t n)
+		{
+			Node& node = _nodes[n];
+			uint32_t next = first_child[n];
+			for (int i = 0; i < Width; i++)
+			{
+				const uint32_t idx = slots[n][i];
+
+				Eigen::AlignedBox3f box;
+				uint32_t child = InvalidNode;
+				uint32_t count = 0;
+				if (idx != InvalidNode)
+				{
+					const auto& slot = ctx.nodes[idx];
+					box = slot.bounds;
+					if (is_leaf(idx))
+					{
+						child = slot.first;
+						count = slot.count;
+					}
+					else
+					{
+						child = next++;
+					}
+				}
+
+				node.minX[i] = box.min().x();
+				node.minY[i] = box.min().y();
+				node.minZ[i] = box.min().z();
+				node.maxX[i] = box.max().x();
+				node.maxY[i] = box.max().y();
+				node.maxZ[i] = box.max().z();
+				node.child[i] = child;
+				node.count[i] = count;
+			}
+		});
+	}
+
+	template<int Width>
+	void Bvh<Width>::refit(gsl::span<const Eigen::AlignedBox3f> boxes)
+	{
+		Require(static_cast<size_t>(boxes.size()) == _indices.size(), "Number of primitives matches.");
+
+		auto assign = [](Node& node, int i, const Eigen::AlignedBox3f& box)
+		{
+			node.minX[i] = box.min().x();
+			node.minY[i] = box.min().y();
+			node.minZ[i] = box.min().z();
+			node.maxX[i] = box.max().x();
+			node.maxY[i] = box.max().y();
+			node.maxZ[i] = box.max().z();
+		};
+
+		// Update the leaves
+		const ptrdiff_t nr_nodes = static_cast<ptrdiff_t>(_nodes.size());
+		Util::parallelFor(nr_nodes, 64, [&](ptrdiff_t n)
+		{
+			Node& node = _nodes[n];
+			for (int i = 0; i < Width; i++)
+			{
+				if (node.count[i] == 0)
+					continue;
+
+				Eigen::AlignedBox3f box;
+				for (uint32_t p = node.child[i]; p < node.child[i] + node.count[i]; p++)
+					box.extend(boxes[_indices[p]]);
+				assign(node, i, box);
+			}
+		});
+
+		// Children are stored after their parents, thus a backward pass
+		// visits all children before their parent
+		for (ptrdiff_t n = nr_nodes - 1; n >= 0; n--)
+		{
+			Node& node = _nodes[n];
+			for (int i = 0; i < Width; i++)
+			{
+				if (node.count[i] == 0 && node.child[i] != InvalidNode)
+					assign(node, i, bounds(node.child[i]));
+			}
+		}
+	}
+
+	template<int Width>
+	Eigen::AlignedBox3f Bvh<Width>::bounds() const
+	{
+		if (_nodes.empty())
+			return {};
+
+		return bounds(0);
+	}
+
+	template<int Width>
+	Eigen::AlignedBox3f Bvh<Width>::bounds(uint32_t node_idx) const
+	{
+		Require(node_idx < _nodes.size(), "Node index is valid.");
+
+		const Node& node = _nodes[node_idx];
+		Eigen::AlignedBox3f box;
+		for (int i = 0; i < Width; i++)
+		{
+			if (node.child[i] == InvalidNode)
+				continue;
+
+			box.extend(Eigen::AlignedBox3f
+			{
+				Eigen::Vector3f{ node.minX[i], node.minY[i], node.minZ[i] },
+				Eigen::Vector3f{ node.maxX[i], node.maxY[i], node.maxZ[i] }
+			});
+		}
+		return box;
+	}
+
+	template class Bvh<4>;
+	template class Bvh<8>;
+}}
@@ -0,0 +1,669 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// GSL
+#include <gsl/span>
+
+// VCL
+#include <vcl/core/simd/memory.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/contract.h>
+#include <vcl/geometry/intersect.h>
+#include <vcl/geometry/ray.h>
+
+namespace Vcl { namespace Geometry
+{
+	/*!
+	 *	\brief Result of a ray query against a bounding volume hierarchy
+	 */
+	struct RayHit
+	{
+		static const uint32_t InvalidPrimitive = 0xffffffff;
+
+		bool isValid() const { return primitive != InvalidPrimitive; }
+
+		//! Index of the closest primitive hit by the ray
+		uint32_t primitive{ InvalidPrimitive };
+
+		//! Ray parameter of the hit
+		float t{ std::numeric_limits<float>::infinity() };
+	};
+
+	/*!
+	 *	\brief Algorithms constructing the binary hierarchy
+	 */
+	enum class BvhBuilder
+	{
+		//! Top-down construction using a binned surface area heuristic
+		Sah,
+
+		//! Linear construction from the Morton codes of the box centres
+		Morton
+	};
+
+	/*!
+	 *	\brief Bounding volume hierarchy with 'Width' children per node
+	 *
+	 *	The hierarchy is built over a set of axis aligned boxes, one per
+	 *	primitive. It is first constructed as a binary tree and then collapsed
+	 *	into nodes storing the boxes of all their children in
+	 *	structure-of-arrays layout. A single ray is thus tested against all
+	 *	children of a node with one packet of 'Width' lanes.
+	 *
+	 *	The hierarchy does not know the primitives themselves. Queries take a
+	 *	function testing a ray against a primitive.
+	 */
+	template<int Width = 8>
+	class Bvh
+	{
+	public:
+		using real_t = VectorScalar<float, Width>;
+
+		//! Marks an unused child slot
+		static const uint32_t InvalidNode = 0xffffffff;
+
+		//! Maximum number of primitives stored in a leaf by the SAH
+		static const uint32_t MaxLeafSize = 4;
+
+		//! Maximum depth of the hierarchy
+		static const int MaxDepth = 128;
+
+		/*!
+		 *	\brief Node storing the boxes of its children
+		 *
+		 *	A slot with a non-zero count is a leaf referencing 'count'
+		 *	consecutive entries of the primitive index list starting at
+		 *	'child'. Otherwise 'child' is the index of the child node.
+		 *	Unused slots hold an empty box and 'InvalidNode'.
+		 */
+		struct Node
+		{
+			float minX[Width];
+			float minY[Width];
+			float minZ[Width];
+			float maxX[Width];
+			float maxY[Width];
+			float maxZ[Width];
+			uint32_t child[Width];
+			uint32_t count[Width];
+		};
+
+	public:
+		Bvh() = default;
+		explicit Bvh(gsl::span<const Eigen::AlignedBox3f> boxes, BvhBuilder builder = BvhBuilder::Sah);
+
+	public:
+		/*!
+		 *	\brief Build the hierarchy
+		 *	\param boxes Bounding box of each primitive
+		 *	\param builder Construction algorithm
+		 *
+		 *	The SAH builder yields hierarchies answering queries faster. The
+		 *	Morton builder is considerably faster to construct and is suited
+		 *	for hierarchies rebuilt frequently.
+		 */
+		void build(gsl::span<const Eigen::AlignedBox3f> boxes, BvhBuilder builder = BvhBuilder::Sah);
+
+		/*!
+		 *	\brief Update the node boxes without changing the topology
+		 *	\param boxes Updated bounding box of each primitive
+		 *
+		 *	The quality of the hierarchy degrades if the primitives move
+		 *	considerably. In this case the hierarchy should be rebuilt.
+		 */
+		void refit(gsl::span<const Eigen::AlignedBox3f> boxes);
+
+	public:
+		bool empty() const { return _nodes.empty(); }
+		size_t nrNodes() const { return _nodes.size(); }
+		size_t nrPrimitives() const { return _indices.size(); }
+
+		const std::vector<Node>& nodes() const { return _nodes; }
+		const std::vector<uint32_t>& indices() const { return _indices; }
+
+		//! \returns the bounding box of all primitives
+		Eigen::AlignedBox3f bounds() const;
+
+		//! \returns the bounding box of the children of a node
+		Eigen::AlignedBox3f bounds(uint32_t node) const;
+
+	public:
+		/*!
+		 *	\brief Find the closest primitive hit by a ray
+		 *	\param ray Query ray
+		 *	\param t_max Upper limit of the ray parameter
+		 *	\param intersect Function with the signature bool(uint32_t primitive, float& t).
+		 *	       It returns true, if the primitive is hit before t and updates t.
+		 */
+		template<typename Func>
+		RayHit closestHit(const Ray<float, 3>& ray, float t_max, Func&& intersect) const;
+
+		/*!
+		 *	\brief Test if a ray hits any primitive
+		 *	\param ray Query ray
+		 *	\param t_max Upper limit of the ray parameter
+		 *	\param intersect Function with the signature bool(uint32_t primitive, float& t)
+		 */
+		template<typename Func>
+		bool anyHit(const Ray<float, 3>& ray, float t_max, Func&& intersect) const;
+
+		/*!
+		 *	\brief Visit all primitives whose leaf box overlaps a box
+		 *	\param box Query box
+		 *	\param visit Function with the signature void(uint32_t primitive)
+		 */
+		template<typename Func>
+		void overlapping(const Eigen::AlignedBox3f& box, Func&& visit) const;
+
+		/*!
+		 *	\brief Visit the leaves in the order of their distance to a point
+		 *	\param p Query point
+		 *	\param max_sq_dist Squared search radius
+		 *	\param visit Function with the signature void(uint32_t first, uint32_t count)
+		 *	       receiving the range of primitive indices of a leaf
+		 *
+		 *	Leaves further away than the search radius are skipped. The visitor
+		 *	may shrink the radius, which is read after each visited leaf.
+		 */
+		template<typename Func>
+		void nearest(const Eigen::Vector3f& p, const float& max_sq_dist, Func&& visit) const;
+
+		/*!
+		 *	\brief Visit all pairs of leaves of two hierarchies lying close to each other
+		 *	\param other Second hierarchy
+		 *	\param margin Largest gap between two leaf boxes considered close
+		 *	\param visit Function with the signature void(uint32_t first, uint32_t count, uint32_t other_first, uint32_t other_count)
+		 *	       receiving the ranges of primitive indices of a leaf of this and of the other hierarchy
+		 */
+		template<typename Func>
+		void overlapping(const Bvh& other, float margin, Func&& visit) const;
+
+		/*!
+		 *	\brief Visit all pairs of leaves of the hierarchy lying close to each other
+		 *	\param margin Largest gap between two leaf boxes considered close
+		 *	\param visit Function with the signature void(uint32_t first, uint32_t count, uint32_t other_first, uint32_t other_count)
+		 *
+		 *	Each pair of distinct leaves is visited once. Every leaf is
+		 *	additionally visited paired with itself.
+		 */
+		template<typename Func>
+		void selfOverlapping(float margin, Func&& visit) const;
+
+	private:
+		//! Child slot of a node together with its box
+		struct Slot
+		{
+			uint32_t child;
+			uint32_t count;
+			Eigen::AlignedBox3f box;
+
+			bool isLeaf() const { return count > 0; }
+		};
+
+		//! \returns the slot 's' of a node
+		Slot slot(const Node& node, int s) const;
+
+		//! \returns a bit mask of the children of a node lying within 'margin' of a box
+		uint32_t closeChildren(const Node& node, const Eigen::AlignedBox3f& box, float margin) const;
+
+		template<typename Func>
+		void traversePairs(const Bvh& other, float margin, std::vector<std::pair<Slot, Slot>>& stack, Func& visit) const;
+
+		template<typename Func>
+		void traverse(const Ray<float, 3>& ray, float& t_max, Func&& visitLeaf) const;
+
+		struct BuildContext;
+		void build(BuildContext& ctx, uint32_t node, uint32_t first, uint32_t count, int depth);
+		template<typename KeyT>
+		void buildMorton(BuildContext& ctx, unsigned int key_bits);
+		void collapse(const BuildContext& ctx);
+
+		//! Wide nodes, the root is stored first
+		std::vector<Node> _nodes;
+
+		//! Primitives referenced by the leaves
+		std::vector<uint32_t> _indices;
+	};
+
+	template<int Width>
+	template<typename Func>
+	void Bvh<Width>::traverse(const Ray<float, 3>& ray, float& t_max, Func&& visitLeaf) const
+	{
+		using vector3_t = Eigen::Matrix<real_t, 3, 1>;
+
+		if (_nodes.empty())
+			return;
+
+		const vector3_t o{ real_t(ray.origin().x()), real_t(ray.origin().y()), real_t(ray.origin().z()) };
+		const vector3_t d{ real_t(ray.direction().x()), real_t(ray.direction().y()), real_t(ray.direction().z()) };
+		const Ray<real_t, 3> wide_ray{ o, d };
+
+		struct StackEntry
+		{
+			uint32_t node;
+			float t;
+		};
+		StackEntry stack[MaxDepth * (Width - 1) + 1];
+		int top = 0;
+		stack[top++] = { 0, 0.0f };
+
+		Eigen::AlignedBox<real_t, 3> box;
+		while (top > 0)
+		{
+			const StackEntry entry = stack[--top];
+			if (entry.t > t_max)
+				continue;
+
+			const Node& node = _nodes[entry.node];
+			load(box.min().x(), node.minX);
+			load(box.min().y(), node.minY);
+			load(box.min().z(), node.minZ);
+			load(box.max().x(), node.maxX);
+			load(box.max().y(), node.maxY);
+			load(box.max().z(), node.maxZ);
+
+			real_t t_entry;
+			const auto mask = intersects_MaxMult(box, wide_ray, real_t(t_max), t_entry);
+			if (none(mask))
+				continue;
+
+			// Order the hit children by their entry distance
+			const real_t dist = select(mask, t_entry, real_t(std::numeric_limits<float>::infinity()));
+			int slots[Width];
+			float ts[Width];
+			int nr_hits = 0;
+			for (int i = 0; i < Width; i++)
+			{
+				const float t = dist[i];
+				if (!(t < std::numeric_limits<float>::infinity()))
+					continue;
+
+				int j = nr_hits++;
+				for (; j > 0 && ts[j - 1] > t; j--)
+				{
+					slots[j] = slots[j - 1];
+					ts[j] = ts[j - 1];
+				}
+				slots[j] = i;
+				ts[j] = t;
+			}
+
+			// Visit the leaves front to back, as they can shorten the ray
+			for (int i = 0; i < nr_hits; i++)
+			{
+				const int s = slots[i];
+				if (node.count[s] > 0 && ts[i] <= t_max)
+				{
+					if (!visitLeaf(node.child[s], node.count[s]))
+						return;
+				}
+			}
+
+			// Push the inner children back to front, such that the closest is popped first
+			for (int i = nr_hits - 1; i >= 0; i--)
+			{
+				const int s = slots[i];
+				if (node.count[s] == 0 && ts[i] <= t_max)
+				{
+					Check(top < MaxDepth * (Width - 1) + 1, "Traversal stack is large enough.");
+					stack[top++] = { node.child[s], ts[i] };
+				}
+			}
+		}
+	}
+
+	template<int Width>
+	template<typename Func>
+	RayHit Bvh<Width>::closestHit(const Ray<float, 3>& ray, float t_max, Func&& intersect) const
+	{
+		RayHit hit;
+		hit.t = t_max;
+		traverse(ray, hit.t, [this, &hit, &intersect](uint32_t first, uint32_t count)
+		{
+			for (uint32_t p = first; p < first + count; p++)
+			{
+				if (intersect(_indices[p], hit.t))
+					hit.primitive = _indices[p];
+			}
+			return true;
+		});
+
+		if (!hit.isValid())
+			hit.t = std::numeric_limits<float>::infinity();
+
+		return hit;
+	}
+
+	template<int Width>
+	template<typename Func>
+	bool Bvh<Width>::anyHit(const Ray<float, 3>& ray, float t_max, Func&& intersect) const
+	{
+		bool found = false;
+		traverse(ray, t_max, [this, t_max, &found, &intersect](uint32_t first, uint32_t count)
+		{
+			for (uint32_t p = first; p < first + count; p++)
+			{
+				float t = t_max;
+				if (intersect(_indices[p], t))
+				{
+					found = true;
+					return false;
+				}
+			}
+			return true;
+		});
+
+		return found;
+	}
+
+	template<int Width>
+	template<typename Func>
+	void Bvh<Width>::overlapping(const Eigen::AlignedBox3f& box, Func&& visit) const
+	{
+		if (_nodes.empty())
+			return;
+
+		const real_t q_min_x{ box.min().x() }, q_min_y{ box.min().y() }, q_min_z{ box.min().z() };
+		const real_t q_max_x{ box.max().x() }, q_max_y{ box.max().y() }, q_max_z{ box.max().z() };
+
+		uint32_t stack[MaxDepth * (Width - 1) + 1];
+		int top = 0;
+		stack[top++] = 0;
+		while (top > 0)
+		{
+			const Node& node = _nodes[stack[--top]];
+
+			real_t min_x, min_y, min_z, max_x, max_y, max_z;
+			load(min_x, node.minX);
+			load(min_y, node.minY);
+			load(min_z, node.minZ);
+			load(max_x, node.maxX);
+			load(max_y, node.maxY);
+			load(max_z, node.maxZ);
+
+			const auto mask =
+				(min_x <= q_max_x) && (max_x >= q_min_x) &&
+				(min_y <= q_max_y) && (max_y >= q_min_y) &&
+				(min_z <= q_max_z) && (max_z >= q_min_z);
+			if (none(mask))
+				continue;
+
+			const real_t hits = select(mask, real_t(1), real_t(0));
+			for (int s = 0; s < Width; s++)
+			{
+				if (hits[s] == 0)
+					continue;
+
+				if (node.count[s] > 0)
+				{
+					for (uint32_t p = node.child[s]; p < node.child[s] + node.count[s]; p++)
+						visit(_indices[p]);
+				}
+				else
+				{
+					Check(top < MaxDepth * (Width - 1) + 1, "Traversal stack is large enough.");
+					stack[top++] = node.child[s];
+				}
+			}
+		}
+	}
+
+	template<int Width>
+	template<typename Func>
+	void Bvh<Width>::nearest(const Eigen::Vector3f& p, const float& max_sq_dist, Func&& visit) const
+	{
+		using namespace Vcl::Mathematics;
+
+		if (_nodes.empty())
+			return;
+
+		const real_t px{ p.x() }, py{ p.y() }, pz{ p.z() };
+
+		struct StackEntry
+		{
+			uint32_t node;
+			float sq_dist;
+		};
+		StackEntry stack[MaxDepth * (Width - 1) + 1];
+		int top = 0;
+		stack[top++] = { 0, 0.0f };
+
+		while (top > 0)
+		{
+			const StackEntry entry = stack[--top];
+			if (entry.sq_dist > max_sq_dist)
+				continue;
+
+			const Node& node = _nodes[entry.node];
+			real_t min_x, min_y, min_z, max_x, max_y, max_z;
+			load(min_x, node.minX);
+			load(min_y, node.minY);
+			load(min_z, node.minZ);
+			load(max_x, node.maxX);
+			load(max_y, node.maxY);
+			load(max_z, node.maxZ);
+
+			// Squared distance between the point and the child boxes
+			const real_t dx = max(max(min_x - px, px - max_x), real_t(0));
+			const real_t dy = max(max(min_y - py, py - max_y), real_t(0));
+			const real_t dz = max(max(min_z - pz, pz - max_z), real_t(0));
+			const real_t dist = dx * dx + dy * dy + dz * dz;
+
+			// Order the children within the search radius by their distance
+			int slots[Width];
+			float ds[Width];
+			int nr_hits = 0;
+			for (int i = 0; i < Width; i++)
+			{
+				const float d = dist[i];
+				if (node.child[i] == InvalidNode || d > max_sq_dist)
+					continue;
+
+				int j = nr_hits++;
+				for (; j > 0 && ds[j - 1] > d; j--)
+				{
+					slots[j] = slots[j - 1];
+					ds[j] = ds[j - 1];
+				}
+				slots[j] = i;
+				ds[j] = d;
+			}
+
+			for (int i = 0; i < nr_hits; i++)
+			{
+				const int s = slots[i];
+				if (node.count[s] > 0 && ds[i] <= max_sq_dist)
+					visit(node.child[s], node.count[s]);
+			}
+
+			for (int i = nr_hits - 1; i >= 0; i--)
+			{
+				const int s = slots[i];
+				if (node.count[s] == 0 && ds[i] <= max_sq_dist)
+				{
+					Check(top < MaxDepth * (Width - 1) + 1, "Traversal stack is large enough.");
+					stack[top++] = { node.child[s], ds[i] };
+				}
+			}
+		}
+	}
+
+	template<int Width>
+	typename Bvh<Width>::Slot Bvh<Width>::slot(const Node& node, int s) const
+	{
+		Slot result;
+		result.child = node.child[s];
+		result.count = node.count[s];
+		result.box.min() = Eigen::Vector3f{ node.minX[s], node.minY[s], node.minZ[s] };
+		result.box.max() = Eigen::Vector3f{ node.maxX[s], node.maxY[s], node.maxZ[s] };
+		return result;
+	}
+
+	template<int Width>
+	uint32_t Bvh<Width>::closeChildren(const Node& node, const Eigen::AlignedBox3f& box, float margin) const
+	{
+		const real_t q_min_x{ box.min().x() - margin }, q_min_y{ box.min().y() - margin }, q_min_z{ box.min().z() - margin };
+		const real_t q_max_x{ box.max().x() + margin }, q_max_y{ box.max().y() + margin }, q_max_z{ box.max().z() + margin };
+
+		real_t min_x, min_y, min_z, max_x, max_y, max_z;
+		load(min_x, node.minX);
+		load(min_y, node.minY);
+		load(min_z, node.minZ);
+		load(max_x, node.maxX);
+		load(max_y, node.maxY);
+		load(max_z, node.maxZ);
+
+		const auto mask =
+			(min_x <= q_max_x) && (max_x >= q_min_x) &&
+			(min_y <= q_max_y) && (max_y >= q_min_y) &&
+			(min_z <= q_max_z) && (max_z >= q_min_z);
+		if (none(mask))
+			return 0;
+
+		const real_t hits = select(mask, real_t(1), real_t(0));
+		uint32_t bits = 0;
+		for (int s = 0; s < Width; s++)
+		{
+			if (hits[s] != 0)
+				bits |= 1u << s;
+		}
+		return bits;
+	}
+
+	template<int Width>
+	template<typename Func>
+	void Bvh<Width>::traversePairs(const Bvh& other, float margin, std::vector<std::pair<Slot, Slot>>& stack, Func& visit) const
+	{
+		while (!stack.empty())
+		{
+			const Slot a = stack.back().first;
+			const Slot b = stack.back().second;
+			stack.pop_back();
+
+			if (a.isLeaf() && b.isLeaf())
+			{
+				visit(a.child, a.count, b.child, b.count);
+				continue;
+			}
+
+			// Descend into the larger of the two boxes, unless it is a leaf
+			const bool descend_a = !a.isLeaf() && (b.isLeaf() || a.box.volume() >= b.box.volume());
+			if (descend_a)
+			{
+				const Node& node = _nodes[a.child];
+				const uint32_t hits = closeChildren(node, b.box, margin);
+				for (int s = 0; s < Width; s++)
+				{
+					if (hits & (1u << s))
+						stack.emplace_back(slot(node, s), b);
+				}
+			}
+			else
+			{
+				const Node& node = other._nodes[b.child];
+				const uint32_t hits = closeChildren(node, a.box, margin);
+				for (int s = 0; s < Width; s++)
+				{
+					if (hits & (1u << s))
+						stack.emplace_back(a, other.slot(node, s));
+				}
+			}
+		}
+	}
+
+	template<int Width>
+	template<typename Func>
+	void Bvh<Width>::overlapping(const Bvh& other, float margin, Func&& visit) const
+	{
+		if (_nodes.empty() || other._nodes.empty())
+			return;
+
+		const Slot root_a{ 0, 0, bounds() };
+		const Slot root_b{ 0, 0, other.bounds() };
+		if (root_a.box.exteriorDistance(root_b.box) > margin)
+			return;
+
+		std::vector<std::pair<Slot, Slot>> stack;
+		stack.reserve(4 * MaxDepth);
+		stack.emplace_back(root_a, root_b);
+		traversePairs(other, margin, stack, visit);
+	}
+
+	template<int Width>
+	template<typename Func>
+	void Bvh<Width>::selfOverlapping(float margin, Func&& visit) const
+	{
+		if (_nodes.empty())
+			return;
+
+		std::vector<std::pair<Slot, Slot>> stack;
+		stack.reserve(4 * MaxDepth);
+
+		std::vector<uint32_t> nodes;
+		nodes.reserve(MaxDepth * (Width - 1) + 1);
+		nodes.push_back(0);
+		while (!nodes.empty())
+		{
+			const Node& node = _nodes[nodes.back()];
+			nodes.pop_back();
+
+			for (int s = 0; s < Width; s++)
+			{
+				if (node.child[s] == InvalidNode)
+					continue;
+
+				// Pairs within the sub-tree of the child
+				const Slot child = slot(node, s);
+				if (child.isLeaf())
+					visit(child.child, child.count, child.child, child.count);
+				else
+					nodes.push_back(child.child);
+
+				// Pairs between the sub-trees of two children
+				const uint32_t hits = closeChildren(node, child.box, margin) & ~((2u << s) - 1);
+				for (int t = s + 1; t < Width; t++)
+				{
+					if (hits & (1u << t))
+						stack.emplace_back(child, slot(node, t));
+				}
+				traversePairs(*this, margin, stack, visit);
+			}
+		}
+	}
+
+	extern template class Bvh<4>;
+	extern template class Bvh<8>;
+}}
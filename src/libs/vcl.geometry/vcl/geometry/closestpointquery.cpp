@@ -0,0 +1,167 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/geometry/closestpointquery.h>
+
+// C++ standard library
+#include <algorithm>
+#include <array>
+
+// VCL
+#include <vcl/core/simd/memory.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/geometry/distancePoint3Triangle3.h>
+#include <vcl/util/parallelfor.h>
+
+namespace Vcl { namespace Geometry
+{
+	namespace
+	{
+		// Widest vector type natively supported by the build
+#if defined(VCL_VECTORIZE_AVX512)
+		using packet_t = float16;
+#else
+		using packet_t = float8;
+#endif
+		const int PacketWidth = sizeof(packet_t) / sizeof(float);
+
+		//! Candidate faces of a single query, evaluated once a packet is full
+		class CandidatePacket
+		{
+		public:
+			CandidatePacket(const TriMesh& mesh, const Eigen::Vector3f& p, ClosestPoint& result, float& max_sq_dist)
+			: _mesh(mesh)
+			, _p(packet_t(p.x()), packet_t(p.y()), packet_t(p.z()))
+			, _result(result)
+			, _maxSqDist(max_sq_dist)
+			{
+			}
+
+			void add(uint32_t face)
+			{
+				_faces[_size++] = face;
+				if (_size == PacketWidth)
+					flush();
+			}
+
+			void flush()
+			{
+				if (_size == 0)
+					return;
+
+				// Gather the vertices of the faces. Unused lanes repeat the last face.
+				float coords[9][PacketWidth];
+				for (int l = 0; l < PacketWidth; l++)
+				{
+					const auto& face = _mesh.faces()[_faces[std::min(l, _size - 1)]];
+					for (int v = 0; v < 3; v++)
+					{
+						const Eigen::Vector3f& x = _mesh.vertices()[face[v]];
+						coords[3 * v + 0][l] = x.x();
+						coords[3 * v + 1][l] = x.y();
+						coords[3 * v + 2][l] = x.z();
+					}
+				}
+
+				Eigen::Matrix<packet_t, 3, 1> x[3];
+				for (int v = 0; v < 3; v++)
+				{
+					load(x[v].x(), coords[3 * v + 0]);
+					load(x[v].y(), coords[3 * v + 1]);
+					load(x[v].z(), coords[3 * v + 2]);
+				}
+
+				std::array<packet_t, 3> st;
+				const packet_t dist = distance(Triangle<packet_t, 3>{ x[0], x[1], x[2] }, _p, &st);
+				for (int l = 0; l < _size; l++)
+				{
+					const float d = dist[l];
+					if (d < _result.distance && d * d <= _maxSqDist)
+					{
+						_result.distance = d;
+						_result.face = ClosestPoint::FaceId{ _faces[l] };
+						_result.barycentric = Eigen::Vector3f(st[0][l], st[1][l], st[2][l]);
+					}
+				}
+
+				if (_result.isValid())
+					_maxSqDist = std::min(_maxSqDist, _result.distance * _result.distance);
+
+				_size = 0;
+			}
+
+		private:
+			const TriMesh& _mesh;
+			const Eigen::Matrix<packet_t, 3, 1> _p;
+			ClosestPoint& _result;
+			float& _maxSqDist;
+
+			uint32_t _faces[PacketWidth];
+			int _size{ 0 };
+		};
+	}
+
+	ClosestPointQuery::ClosestPointQuery(const TriMesh& mesh, BvhBuilder builder)
+	: _bvh(mesh, builder)
+	{
+	}
+
+	ClosestPoint ClosestPointQuery::query(const Eigen::Vector3f& p, float max_distance) const
+	{
+		ClosestPoint result;
+		float max_sq_dist = max_distance * max_distance;
+
+		const auto& hierarchy = _bvh.hierarchy();
+		CandidatePacket candidates{ mesh(), p, result, max_sq_dist };
+		hierarchy.nearest(p, max_sq_dist, [&hierarchy, &candidates](uint32_t first, uint32_t count)
+		{
+			for (uint32_t i = first; i < first + count; i++)
+				candidates.add(hierarchy.indices()[i]);
+		});
+		candidates.flush();
+
+		return result;
+	}
+
+	void ClosestPointQuery::query(gsl::span<const Eigen::Vector3f> points, gsl::span<ClosestPoint> results, float max_distance) const
+	{
+		Require(results.size() >= points.size(), "Result array is large enough.");
+
+		const ptrdiff_t nr_points = static_cast<ptrdiff_t>(points.size());
+		Util::parallelFor(nr_points, 64, [&](ptrdiff_t i)
+		{
+			results[i] = query(points[i], max_distance);
+		});
+	}
+
+	void ClosestPointQuery::refit()
+	{
+		_bvh.refit();
+	}
+
+	void ClosestPointQuery::rebuild()
+	{
+		_bvh.rebuild();
+	}
+}}
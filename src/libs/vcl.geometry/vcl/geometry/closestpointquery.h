@@ -0,0 +1,109 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <limits>
+
+// GSL
+#include <gsl/span>
+
+// VCL
+#include <vcl/geometry/meshbvh.h>
+#include <vcl/geometry/trimesh.h>
+
+namespace Vcl { namespace Geometry
+{
+	/*!
+	 *	\brief Closest point on a mesh
+	 */
+	struct ClosestPoint
+	{
+		using FaceId = IndexDescriptionTrait<TriMesh>::FaceId;
+
+		bool isValid() const { return face.isValid(); }
+
+		//! Distance between the query point and the mesh
+		float distance{ std::numeric_limits<float>::infinity() };
+
+		//! Face containing the closest point
+		FaceId face;
+
+		//! Barycentric coordinates of the closest point with respect to the face vertices
+		Eigen::Vector3f barycentric{ Eigen::Vector3f::Zero() };
+	};
+
+	/*!
+	 *	\brief Closest point queries against the surface of a TriMesh
+	 *
+	 *	Candidate faces are found through a bounding volume hierarchy, which is
+	 *	visited in the order of the distance to the query point. The candidates
+	 *	are gathered into packets, which are evaluated with the SIMD
+	 *	point-triangle distance kernel. The closest distance found so far limits
+	 *	the remaining search.
+	 *
+	 *	The mesh is referenced and has to outlive the query object.
+	 */
+	class ClosestPointQuery
+	{
+	public:
+		explicit ClosestPointQuery(const TriMesh& mesh, BvhBuilder builder = BvhBuilder::Sah);
+
+	public:
+		/*!
+		 *	\brief Find the closest point on the mesh
+		 *	\param p Query point
+		 *	\param max_distance Points further away than this are not reported
+		 */
+		ClosestPoint query(const Eigen::Vector3f& p, float max_distance = std::numeric_limits<float>::infinity()) const;
+
+		/*!
+		 *	\brief Find the closest points of a batch of query points
+		 *	\param points Query points
+		 *	\param results Closest point of each query point
+		 *	\param max_distance Points further away than this are not reported
+		 *
+		 *	The queries are distributed across all threads.
+		 */
+		void query(gsl::span<const Eigen::Vector3f> points, gsl::span<ClosestPoint> results, float max_distance = std::numeric_limits<float>::infinity()) const;
+
+		//! Update the spatial index after the vertices of the mesh were moved
+		void refit();
+
+		//! Rebuild the spatial index after the faces of the mesh changed
+		void rebuild();
+
+	public:
+		const TriMesh& mesh() const { return _bvh.mesh(); }
+
+	private:
+		//! Spatial index over the faces
+		MeshBvh<TriMesh, 8> _bvh;
+	};
+}}
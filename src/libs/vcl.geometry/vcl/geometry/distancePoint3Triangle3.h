@@ -30,6 +30,7 @@
 
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/interleavedarray.h>
 #include <vcl/geometry/triangle.h>
 
 namespace Vcl { namespace Geometry
@@ -43,4 +44,22 @@ namespace Vcl { namespace Geometry
 	float4  distance(const Triangle<float4,  3>& tri, const Eigen::Matrix<float4,  3, 1>& p, std::array<float4,  3>* barycentric = nullptr, int* r = nullptr);
 	float8  distance(const Triangle<float8,  3>& tri, const Eigen::Matrix<float8,  3, 1>& p, std::array<float8,  3>* barycentric = nullptr, int* r = nullptr);
 	float16 distance(const Triangle<float16, 3>& tri, const Eigen::Matrix<float16, 3, 1>& p, std::array<float16, 3>* barycentric = nullptr, int* r = nullptr);
+
+	/*!
+	 *	\brief Point - Triangle distances of a batch of problems
+	 *
+	 *	Uses the widest SIMD kernel supported by the processor.
+	 *
+	 *	\param triangles   Triangles storing a vertex per column
+	 *	\param points      Points, one per triangle
+	 *	\param distances   Distance of each point to its triangle
+	 *	\param barycentric Optional barycentric coordinates of the closest points
+	 */
+	void distance
+	(
+		const Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& triangles,
+		const Core::InterleavedArray<float, 3, 1, Core::DynamicStride>& points,
+		Core::InterleavedArray<float, 1, 1, Core::DynamicStride>& distances,
+		Core::InterleavedArray<float, 3, 1, Core::DynamicStride>* barycentric = nullptr
+	);
 }}
@@ -0,0 +1,60 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Vector types of this translation unit are built for AVX-512
+#define VCL_SIMD_ISA_NAMESPACE avx512
+
+#include <vcl/geometry/distancePoint3Triangle3_impl.h>
+
+#ifdef VCL_VECTORIZE_AVX512
+
+// VCL
+#include <vcl/core/simd/vectorscalar.h>
+
+namespace Vcl { namespace Geometry { namespace detail
+{
+	namespace
+	{
+		const PointTriangleDistanceKernel Kernel =
+		{
+			16,
+			&distanceBatch<float16>
+		};
+	}
+
+	const PointTriangleDistanceKernel* pointTriangleDistanceKernelAVX512()
+	{
+		return &Kernel;
+	}
+}}}
+#else
+namespace Vcl { namespace Geometry { namespace detail
+{
+	const PointTriangleDistanceKernel* pointTriangleDistanceKernelAVX512()
+	{
+		return nullptr;
+	}
+}}}
+#endif // VCL_VECTORIZE_AVX512
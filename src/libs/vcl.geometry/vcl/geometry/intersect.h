@@ -48,7 +48,7 @@ namespace Vcl { namespace Geometry
 	 *
 	 *	\note Rays aligned with the border of the bounding box produce only very inconsistent intersections
 	 */
-	bool intersects_Barnes
+	inline bool intersects_Barnes
 	(
 		const Eigen::AlignedBox<float, 3>& box,
 		const Ray<float, 3>& ray
@@ -77,7 +77,7 @@ namespace Vcl { namespace Geometry
 	 *	Implementation from
 	 *	https://www.solidangle.com/research/jcgt2013_robust_BVH-revised.pdf
 	 */
-	bool intersects_MaxMult
+	inline bool intersects_MaxMult
 	(
 		const Eigen::AlignedBox<float, 3>& box,
 		const Ray<float, 3>& r
@@ -138,12 +138,54 @@ namespace Vcl { namespace Geometry
 		return tmin <= tmax;
 	}
 
+	/*!
+	 *	\brief Ray-AABB intersection returning the entry distances
+	 *	\param box Boxes tested against the rays
+	 *	\param r Rays
+	 *	\param t_max Upper limit of the ray intervals
+	 *	\param t_entry Distance at which a ray enters its box
+	 *	\returns the rays intersecting their box within [0, t_max]
+	 *
+	 *	Variant of intersects_MaxMult limiting the ray intervals, used to test
+	 *	the children of a node in a bounding volume hierarchy with a single ray.
+	 */
+	template<typename Real, int Width>
+	Vcl::VectorScalar<bool, Width> intersects_MaxMult
+	(
+		const Eigen::AlignedBox<Vcl::VectorScalar<Real, Width>, 3>& box,
+		const Ray<Vcl::VectorScalar<Real, Width>, 3>& r,
+		const Vcl::VectorScalar<Real, Width>& t_max,
+		Vcl::VectorScalar<Real, Width>& t_entry
+	)
+	{
+		using namespace Vcl::Mathematics;
+
+		using real_t = Vcl::VectorScalar<Real, Width>;
+
+		real_t txmin, txmax, tymin, tymax, tzmin, tzmax;
+
+		txmin = (select(r.signs().x() == 0, box.min().x(), box.max().x()) - r.origin().x()) * r.invDirection().x();
+		txmax = (select(r.signs().x() == 1, box.min().x(), box.max().x()) - r.origin().x()) * r.invDirection().x();
+		tymin = (select(r.signs().y() == 0, box.min().y(), box.max().y()) - r.origin().y()) * r.invDirection().y();
+		tymax = (select(r.signs().y() == 1, box.min().y(), box.max().y()) - r.origin().y()) * r.invDirection().y();
+		tzmin = (select(r.signs().z() == 0, box.min().z(), box.max().z()) - r.origin().z()) * r.invDirection().z();
+		tzmax = (select(r.signs().z() == 1, box.min().z(), box.max().z()) - r.origin().z()) * r.invDirection().z();
+
+		// Disallow any intersection that lies behind the start point of the ray
+		real_t tmin = max(tzmin, max(tymin, max(txmin, real_t(0))));
+		real_t tmax = min(tzmax, min(tymax, min(txmax, t_max)));
+		tmax *= 1.00000024f;
+
+		t_entry = tmin;
+		return tmin <= tmax;
+	}
+
 	/*!
 	*	\brief Ray-AABB intersection
 	*
 	*	Method from Pharr, Humphrey
 	*/
-	bool intersects_Pharr
+	inline bool intersects_Pharr
 	(
 		const Eigen::AlignedBox<float, 3>& box,
 		const Ray<float, 3>& ray
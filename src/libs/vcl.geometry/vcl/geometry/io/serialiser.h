@@ -29,13 +29,41 @@
 #include <vcl/config/eigen.h>
 
 // C++ standard library
+#include <algorithm>
 #include <string>
+#include <vector>
+
+// GSL
+#include <gsl/span>
 
 // VCL
 #include <vcl/core/contract.h>
 
 namespace Vcl { namespace Geometry { namespace IO
 {
+	//! Number of elements serialisers collect before handing them to a deserialiser
+	const unsigned int DeserialiserChunkSize = 4096;
+
+	//! Size of the blocks of text parsed by a single thread in ParseMode::Parallel
+	const size_t ParseChunkBytes = 1 << 20;
+
+	//! Number of elements serialisers fetch at once when writing files
+	const unsigned int SerialiserChunkSize = 4096;
+
+	//! Size of the formatted text collected before writing it to a file
+	const size_t WriteBufferBytes = 1 << 20;
+
+	//! Strategy used by the text based serialisers to read files
+	enum class ParseMode
+	{
+		//! Read the files through a stream on the calling thread
+		Sequential,
+
+		//! Map the files into memory and parse blocks of lines concurrently.
+		//! Falls back to sequential parsing if the files cannot be mapped.
+		Parallel
+	};
+
 	struct AbstractDeserialiser
 	{
 		// Inform the deserialiser of begin and end of the file loading process
@@ -56,8 +84,42 @@ namespace Vcl { namespace Geometry { namespace IO
 		virtual void addFace(const std::vector<unsigned int>& indices) =0;
 		virtual void addVolume(const std::vector<unsigned int>& indices) =0;
 
+		// Add blocks of elements in sequential order. Each element consists of 'stride'
+		// coordinates or 'arity' indices. The default implementations forward each
+		// element to the methods above.
+		virtual void addNodes(gsl::span<const float> coordinates, unsigned int stride)
+		{
+			addElements(coordinates, stride, [this](const std::vector<float>& c) { addNode(c); });
+		}
+		virtual void addEdges(gsl::span<const unsigned int> indices, unsigned int arity)
+		{
+			addElements(indices, arity, [this](const std::vector<unsigned int>& i) { addEdge(i); });
+		}
+		virtual void addFaces(gsl::span<const unsigned int> indices, unsigned int arity)
+		{
+			addElements(indices, arity, [this](const std::vector<unsigned int>& i) { addFace(i); });
+		}
+		virtual void addVolumes(gsl::span<const unsigned int> indices, unsigned int arity)
+		{
+			addElements(indices, arity, [this](const std::vector<unsigned int>& i) { addVolume(i); });
+		}
+
 		// Named properties
 		virtual void addNormal(const Vector3f& normal) =0;
+
+	private:
+		template<typename T, typename Func>
+		static void addElements(gsl::span<const T> data, unsigned int width, Func&& add)
+		{
+			Require(width > 0 && data.size() % width == 0, "Data consists of complete elements.");
+
+			std::vector<T> element(width);
+			for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(data.size()); i += width)
+			{
+				std::copy(data.data() + i, data.data() + i + width, element.begin());
+				add(element);
+			}
+		}
 	};
 
 	struct AbstractSerialiser
@@ -77,9 +139,46 @@ namespace Vcl { namespace Geometry { namespace IO
 		virtual void fetchFace(std::vector<unsigned int>& indices) =0;
 		virtual void fetchVolume(std::vector<unsigned int>& indices) =0;
 
+		// Fetch blocks of elements in sequential order. The span is filled with
+		// 'coordinates.size() / stride' or 'indices.size() / arity' elements, which
+		// must not exceed the number of remaining elements. The default
+		// implementations fetch each element through the methods above.
+		virtual void fetchNodes(gsl::span<float> coordinates, unsigned int stride)
+		{
+			fetchElements<float>(coordinates, stride, [this](std::vector<float>& c) { fetchNode(c); });
+		}
+		virtual void fetchEdges(gsl::span<unsigned int> indices, unsigned int arity)
+		{
+			fetchElements<unsigned int>(indices, arity, [this](std::vector<unsigned int>& i) { fetchEdge(i); });
+		}
+		virtual void fetchFaces(gsl::span<unsigned int> indices, unsigned int arity)
+		{
+			fetchElements<unsigned int>(indices, arity, [this](std::vector<unsigned int>& i) { fetchFace(i); });
+		}
+		virtual void fetchVolumes(gsl::span<unsigned int> indices, unsigned int arity)
+		{
+			fetchElements<unsigned int>(indices, arity, [this](std::vector<unsigned int>& i) { fetchVolume(i); });
+		}
+
 		// Named properties
 		virtual bool hasNormals() const { return false; }
 		virtual void fetchNormal(Vector3f& normal) { normal.setZero(); }
+
+	private:
+		template<typename T, typename Func>
+		static void fetchElements(gsl::span<T> data, unsigned int width, Func&& fetch)
+		{
+			Require(width > 0 && data.size() % width == 0, "Data consists of complete elements.");
+
+			std::vector<T> element;
+			for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(data.size()); i += width)
+			{
+				fetch(element);
+				Check(element.size() == width, "Element has the requested size.");
+
+				std::copy(element.begin(), element.begin() + std::min<size_t>(width, element.size()), data.data() + i);
+			}
+		}
 	};
 
 	class Serialiser
@@ -0,0 +1,361 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/geometry/io/serialiser_binary_mesh.h>
+
+// Standard C++ library
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// VCL
+#include <vcl/core/memory/mappedfile.h>
+
+namespace Vcl { namespace Geometry { namespace IO
+{
+	namespace
+	{
+		//! Identification of the file format
+		const char Magic[8] = { 'V', 'C', 'L', 'M', 'E', 'S', 'H', '\0' };
+
+		//! Written as native integer to detect files of a different byte order
+		const uint32_t ByteOrderMark = 0x01020304;
+
+		//! Alignment of the property data in the file
+		const uint64_t DataAlignment = 4096;
+
+		enum class MeshType : uint32_t
+		{
+			TriMesh = 1,
+			MultiIndexTriMesh = 2,
+			TetraMesh = 3
+		};
+
+		struct FileHeader
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t byteOrder;
+			uint32_t meshType;
+			uint32_t nrProperties;
+
+			//! Size of the property directory following the header
+			uint64_t directorySize;
+		};
+		static_assert(sizeof(FileHeader) == 32, "Header is packed.");
+
+		//! Directory entry, followed by the group name, the property name and the element type
+		struct PropertyRecord
+		{
+			uint32_t groupNameLength;
+			uint32_t nameLength;
+			uint32_t typeNameLength;
+			uint32_t reserved;
+			uint64_t elementSize;
+			uint64_t count;
+			uint64_t offset;
+		};
+		static_assert(sizeof(PropertyRecord) == 40, "Record is packed.");
+
+		struct Entry
+		{
+			std::string group;
+			std::string name;
+			std::string type;
+			PropertyRecord record;
+
+			//! Property providing the data when writing
+			const PropertyBase* property;
+		};
+
+		uint64_t align(uint64_t offset)
+		{
+			return (offset + DataAlignment - 1) / DataAlignment * DataAlignment;
+		}
+
+		template<typename IndexT>
+		void collect(const PropertyGroup<IndexT>& group, std::vector<Entry>& entries)
+		{
+			const size_t first = entries.size();
+			for (const auto& prop : group)
+			{
+				if (!prop.isBitwiseSerialisable())
+					continue;
+
+				Entry entry;
+				entry.group = group.name();
+				entry.name = prop.name();
+				entry.type = prop.elementType();
+				entry.record.groupNameLength = static_cast<uint32_t>(entry.group.size());
+				entry.record.nameLength = static_cast<uint32_t>(entry.name.size());
+				entry.record.typeNameLength = static_cast<uint32_t>(entry.type.size());
+				entry.record.reserved = 0;
+				entry.record.elementSize = prop.elementSize();
+				entry.record.count = prop.size();
+				entry.record.offset = 0;
+				entry.property = &prop;
+				entries.emplace_back(std::move(entry));
+			}
+
+			// Write the properties in a stable order
+			std::sort(entries.begin() + first, entries.end(), [](const Entry& a, const Entry& b)
+			{
+				return a.name < b.name;
+			});
+		}
+
+		bool write(const std::string& path, MeshType type, std::vector<Entry>& entries)
+		{
+			uint64_t directory_size = 0;
+			for (const auto& entry : entries)
+				directory_size += sizeof(PropertyRecord) + entry.group.size() + entry.name.size() + entry.type.size();
+
+			// Place the data of each property on its own pages
+			uint64_t offset = align(sizeof(FileHeader) + directory_size);
+			for (auto& entry : entries)
+			{
+				entry.record.offset = offset;
+				offset = align(offset + entry.record.elementSize*entry.record.count);
+			}
+
+			std::ofstream file{ path, std::ios_base::binary | std::ios_base::trunc };
+			if (!file.is_open())
+				return false;
+
+			FileHeader header;
+			memcpy(header.magic, Magic, sizeof(Magic));
+			header.version = BinaryMeshSerialiser::Version;
+			header.byteOrder = ByteOrderMark;
+			header.meshType = static_cast<uint32_t>(type);
+			header.nrProperties = static_cast<uint32_t>(entries.size());
+			header.directorySize = directory_size;
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+			for (const auto& entry : entries)
+			{
+				file.write(reinterpret_cast<const char*>(&entry.record), sizeof(PropertyRecord));
+				file.write(entry.group.data(), entry.group.size());
+				file.write(entry.name.data(), entry.name.size());
+				file.write(entry.type.data(), entry.type.size());
+			}
+
+			const std::vector<char> padding(DataAlignment, 0);
+			uint64_t position = sizeof(FileHeader) + directory_size;
+			for (const auto& entry : entries)
+			{
+				file.write(padding.data(), entry.record.offset - position);
+
+				const uint64_t bytes = entry.record.elementSize*entry.record.count;
+				file.write(static_cast<const char*>(entry.property->rawData()), bytes);
+				position = entry.record.offset + bytes;
+			}
+
+			// Pad the file to the full size of the last region
+			file.write(padding.data(), align(position) - position);
+
+			return file.good();
+		}
+
+		bool read(const Core::MappedFile& file, MeshType type, std::vector<Entry>& entries)
+		{
+			if (file.size() < sizeof(FileHeader))
+				return false;
+
+			FileHeader header;
+			memcpy(&header, file.data(), sizeof(FileHeader));
+			if (memcmp(header.magic, Magic, sizeof(Magic)) != 0 ||
+				header.version != BinaryMeshSerialiser::Version ||
+				header.byteOrder != ByteOrderMark ||
+				header.meshType != static_cast<uint32_t>(type) ||
+				header.directorySize > file.size() - sizeof(FileHeader))
+			{
+				return false;
+			}
+
+			const char* cursor = file.data() + sizeof(FileHeader);
+			const char* directory_end = cursor + header.directorySize;
+			for (uint32_t i = 0; i < header.nrProperties; i++)
+			{
+				Entry entry;
+				if (directory_end - cursor < static_cast<ptrdiff_t>(sizeof(PropertyRecord)))
+					return false;
+				memcpy(&entry.record, cursor, sizeof(PropertyRecord));
+				cursor += sizeof(PropertyRecord);
+
+				const uint64_t name_length = uint64_t(entry.record.groupNameLength) + entry.record.nameLength + entry.record.typeNameLength;
+				if (static_cast<uint64_t>(directory_end - cursor) < name_length)
+					return false;
+				entry.group.assign(cursor, entry.record.groupNameLength);
+				cursor += entry.record.groupNameLength;
+				entry.name.assign(cursor, entry.record.nameLength);
+				cursor += entry.record.nameLength;
+				entry.type.assign(cursor, entry.record.typeNameLength);
+				cursor += entry.record.typeNameLength;
+
+				// The data has to lie within the file
+				const PropertyRecord& r = entry.record;
+				if (r.offset % DataAlignment != 0 || r.offset > file.size() ||
+					(r.elementSize > 0 && r.count > (file.size() - r.offset) / r.elementSize))
+				{
+					return false;
+				}
+
+				entry.property = nullptr;
+				entries.emplace_back(std::move(entry));
+			}
+
+			return true;
+		}
+
+		//! Number of elements stored for a group, if all properties agree
+		template<typename IndexT>
+		bool groupSize(const PropertyGroup<IndexT>& group, const std::vector<Entry>& entries, size_t& size)
+		{
+			bool found = false;
+			for (const auto& entry : entries)
+			{
+				if (entry.group != group.name())
+					continue;
+
+				if (found && entry.record.count != size)
+					return false;
+
+				size = static_cast<size_t>(entry.record.count);
+				found = true;
+			}
+
+			if (!found)
+				size = 0;
+
+			return true;
+		}
+
+		//! Check that the stored properties existing in the group have the same element type
+		template<typename IndexT>
+		bool matchingTypes(const PropertyGroup<IndexT>& group, const std::vector<Entry>& entries)
+		{
+			for (const auto& entry : entries)
+			{
+				if (entry.group != group.name())
+					continue;
+
+				const PropertyBase* prop = group.propertyBase(entry.name);
+				if (!prop)
+					continue;
+
+				if (!prop->isBitwiseSerialisable() ||
+					prop->elementSize() != entry.record.elementSize ||
+					prop->elementType() != entry.type)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		template<typename IndexT>
+		void adopt(PropertyGroup<IndexT>& group, size_t size, const std::shared_ptr<const Core::MappedFile>& file, const std::vector<Entry>& entries)
+		{
+			group.clear();
+			for (const auto& entry : entries)
+			{
+				if (size == 0 || entry.group != group.name())
+					continue;
+
+				PropertyBase* prop = group.propertyBase(entry.name);
+				if (prop)
+					prop->adopt(file, entry.record.offset, size);
+			}
+
+			// Initialise the properties not found in the file
+			group.resizeProperties(size);
+		}
+
+		template<typename IndexT0, typename IndexT1>
+		bool load(PropertyGroup<IndexT0>& group0, PropertyGroup<IndexT1>& group1, MeshType type, const std::string& path)
+		{
+			auto file = Core::MappedFile::open(path);
+			if (!file)
+				return false;
+
+			std::vector<Entry> entries;
+			if (!read(*file, type, entries))
+				return false;
+
+			// Validate the file before modifying the mesh
+			size_t size0 = 0, size1 = 0;
+			if (!groupSize(group0, entries, size0) || !groupSize(group1, entries, size1))
+				return false;
+			if (!matchingTypes(group0, entries) || !matchingTypes(group1, entries))
+				return false;
+
+			adopt(group0, size0, file, entries);
+			adopt(group1, size1, file, entries);
+
+			return true;
+		}
+
+		template<typename IndexT0, typename IndexT1>
+		bool store(const PropertyGroup<IndexT0>& group0, const PropertyGroup<IndexT1>& group1, MeshType type, const std::string& path)
+		{
+			std::vector<Entry> entries;
+			collect(group0, entries);
+			collect(group1, entries);
+
+			return write(path, type, entries);
+		}
+	}
+
+	bool BinaryMeshSerialiser::load(TriMesh& mesh, const std::string& path) const
+	{
+		return IO::load(mesh.vertexProperties(), mesh.faceProperties(), MeshType::TriMesh, path);
+	}
+
+	bool BinaryMeshSerialiser::load(MultiIndexTriMesh& mesh, const std::string& path) const
+	{
+		return IO::load(mesh.vertexProperties(), mesh.faceProperties(), MeshType::MultiIndexTriMesh, path);
+	}
+
+	bool BinaryMeshSerialiser::load(TetraMesh& mesh, const std::string& path) const
+	{
+		return IO::load(mesh.vertexProperties(), mesh.volumeProperties(), MeshType::TetraMesh, path);
+	}
+
+	bool BinaryMeshSerialiser::store(const TriMesh& mesh, const std::string& path) const
+	{
+		return IO::store(mesh.vertexProperties(), mesh.faceProperties(), MeshType::TriMesh, path);
+	}
+
+	bool BinaryMeshSerialiser::store(const MultiIndexTriMesh& mesh, const std::string& path) const
+	{
+		return IO::store(mesh.vertexProperties(), mesh.faceProperties(), MeshType::MultiIndexTriMesh, path);
+	}
+
+	bool BinaryMeshSerialiser::store(const TetraMesh& mesh, const std::string& path) const
+	{
+		return IO::store(mesh.vertexProperties(), mesh.volumeProperties(), MeshType::TetraMesh, path);
+	}
+}}}
@@ -0,0 +1,77 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// Standard C++ library
+#include <string>
+
+// VCL
+#include <vcl/geometry/multiindextrimesh.h>
+#include <vcl/geometry/tetramesh.h>
+#include <vcl/geometry/trimesh.h>
+
+namespace Vcl { namespace Geometry { namespace IO
+{
+	/*!
+	 *	\brief Versioned binary container for meshes and their properties
+	 *
+	 *	The file stores the raw memory of all properties of the element groups
+	 *	of a mesh. Each property is page aligned, such that loading maps the file
+	 *	and lets the properties point directly into the mapping. Modifications of
+	 *	a loaded mesh are private to the process (copy-on-write).
+	 *
+	 *	Properties are identified by their group and their name. Only properties
+	 *	with trivially copyable elements and fixed-size Eigen matrices are stored,
+	 *	together with the size and a description of their element type. Loading
+	 *	restores the properties which already exist in the target mesh; custom
+	 *	properties need to be added to the mesh before loading. All other
+	 *	properties stored in the file are ignored. Files storing a property with
+	 *	a different element type than the target mesh are rejected. The data is
+	 *	stored in the byte order of the writer.
+	 */
+	class BinaryMeshSerialiser
+	{
+	public:
+		//! Version of the file format written by this serialiser
+		static const uint32_t Version = 2;
+
+	public: // Read mesh file
+		/*!
+		 *	\brief Replace the content of a mesh by the content of a file
+		 *	\returns false if the file cannot be read or does not contain a mesh of the same type
+		 */
+		bool load(TriMesh& mesh, const std::string& path) const;
+		bool load(MultiIndexTriMesh& mesh, const std::string& path) const;
+		bool load(TetraMesh& mesh, const std::string& path) const;
+
+	public: // Write mesh file
+		bool store(const TriMesh& mesh, const std::string& path) const;
+		bool store(const MultiIndexTriMesh& mesh, const std::string& path) const;
+		bool store(const TetraMesh& mesh, const std::string& path) const;
+	};
+}}}
@@ -25,22 +25,74 @@
 #include <vcl/geometry/io/serialiser_nvidia_tet_file.h>
 
 // C++ standard library
+#include <algorithm>
 #include <array>
 #include <iostream>
+#include <iterator>
 #include <fstream>
 #include <vector>
 
+// Format library
+#include <fmt/format.h>
+
 // VCL
+#include <vcl/core/memory/mappedfile.h>
 #include <vcl/util/stringparser.h>
+#include <vcl/util/textparser.h>
 
 namespace Vcl { namespace Geometry { namespace IO
 {
-	void NvidiaTetSerialiser::load(AbstractDeserialiser* deserialiser, const std::string& path) const
+	namespace
 	{
-		using namespace std;
+		//! Block of lines of the file and the elements parsed from it
+		struct Chunk
+		{
+			gsl::span<const char> text;
+
+			std::vector<float> positions;
+			std::vector<unsigned int> indices;
+		};
+
+		void parse(Chunk& chunk)
+		{
+			Util::TextReader reader{ chunk.text };
+			while (reader.nextLine())
+			{
+				if (reader.readKeyword("v"))
+				{
+					float p[3] = { 0, 0, 0 };
+					reader.readFloat(p[0]);
+					reader.readFloat(p[1]);
+					reader.readFloat(p[2]);
+					chunk.positions.insert(chunk.positions.end(), p, p + 3);
+				}
+				else if (reader.readKeyword("t"))
+				{
+					int t[4] = { 0, 0, 0, 0 };
+					for (int& i : t)
+					{
+						reader.readInt(i);
+						chunk.indices.push_back(static_cast<unsigned int>(i));
+					}
+				}
+			}
+		}
+	}
 
+	void NvidiaTetSerialiser::load(AbstractDeserialiser* deserialiser, const std::string& path) const
+	{
 		Require(deserialiser != nullptr, "Deserialiser is given.");
 
+		if (_mode == ParseMode::Parallel && loadParallel(deserialiser, path))
+			return;
+
+		loadSequential(deserialiser, path);
+	}
+
+	void NvidiaTetSerialiser::loadSequential(AbstractDeserialiser* deserialiser, const std::string& path) const
+	{
+		using namespace std;
+
 		ifstream fin(path.c_str());
 		if (!fin.is_open() || fin.eof())
 		{
@@ -54,13 +106,19 @@ namespace Vcl { namespace Geometry { namespace IO
 		// Start importing the mesh
 		deserialiser->begin();
 
-		std::vector<float> position(3);
-		std::vector<unsigned int> volume(4);
+		// Elements are handed to the deserialiser in chunks
+		std::vector<float> positions;
+		std::vector<unsigned int> volumes;
+		positions.reserve(3 * DeserialiserChunkSize);
+		volumes.reserve(4 * DeserialiserChunkSize);
 
 		string buffer;
 		while (parser.loadLine())
 		{
-			parser.readString(&buffer);
+			// Skips all the empty lines
+			if (!parser.readString(&buffer))
+				continue;
+
 			if (buffer == "v")
 			{
 				float p0, p1, p2;
@@ -68,8 +126,12 @@ namespace Vcl { namespace Geometry { namespace IO
 				parser.readFloat(&p1);
 				parser.readFloat(&p2);
 
-				position = { p0, p1, p2 };
-				deserialiser->addNode(position);
+				positions.insert(positions.end(), { p0, p1, p2 });
+				if (positions.size() == 3 * DeserialiserChunkSize)
+				{
+					deserialiser->addNodes(positions, 3);
+					positions.clear();
+				}
 			}
 			else if (buffer == "t")
 			{
@@ -79,8 +141,12 @@ namespace Vcl { namespace Geometry { namespace IO
 				parser.readInt(&i2);
 				parser.readInt(&i3);
 
-				volume = { static_cast<unsigned>(i0), static_cast<unsigned>(i1), static_cast<unsigned>(i2), static_cast<unsigned>(i3) };
-				deserialiser->addVolume(volume);
+				volumes.insert(volumes.end(), { static_cast<unsigned>(i0), static_cast<unsigned>(i1), static_cast<unsigned>(i2), static_cast<unsigned>(i3) });
+				if (volumes.size() == 4 * DeserialiserChunkSize)
+				{
+					deserialiser->addVolumes(volumes, 4);
+					volumes.clear();
+				}
 			}
 			else if (buffer == "l")
 			{
@@ -88,17 +154,49 @@ namespace Vcl { namespace Geometry { namespace IO
 		}
 		fin.close();
 
+		deserialiser->addNodes(positions, 3);
+		deserialiser->addVolumes(volumes, 4);
+
 		// Finalise the mesh
 		deserialiser->end();
 	}
 
+	bool NvidiaTetSerialiser::loadParallel(AbstractDeserialiser* deserialiser, const std::string& path) const
+	{
+		auto file = Core::MappedFile::open(path);
+		if (!file)
+			return false;
+
+		// Split the file into blocks of lines, which are parsed concurrently
+		std::vector<Chunk> chunks;
+		for (const auto& text : Util::splitLines({ file->data(), static_cast<ptrdiff_t>(file->size()) }, file->size() / ParseChunkBytes + 1))
+			chunks.push_back({ text });
+
+		const ptrdiff_t nr_chunks = static_cast<ptrdiff_t>(chunks.size());
+#ifdef _OPENMP
+#	pragma omp parallel for schedule(dynamic, 1)
+#endif // _OPENMP
+		for (ptrdiff_t i = 0; i < nr_chunks; i++)
+			parse(chunks[i]);
+
+		// Hand the elements to the deserialiser in the order of the file
+		deserialiser->begin();
+		for (const auto& chunk : chunks)
+			deserialiser->addNodes(chunk.positions, 3);
+		for (const auto& chunk : chunks)
+			deserialiser->addVolumes(chunk.indices, 4);
+		deserialiser->end();
+
+		return true;
+	}
+
 	void NvidiaTetSerialiser::store(AbstractSerialiser* serialiser, const std::string& path) const
 	{
 		using namespace std;
 
 		Require(serialiser != nullptr, "Serialiser is given.");
 
-		ofstream fout(path.c_str());
+		ofstream fout(path.c_str(), ios_base::out | ios_base::binary);
 		if (!fout.is_open())
 			return;
 
@@ -109,25 +207,47 @@ namespace Vcl { namespace Geometry { namespace IO
 		unsigned int nr_nodes = serialiser->nrNodes();
 		unsigned int nr_cells = serialiser->nrVolumes();
 
+		// Text is collected in a buffer and written in large blocks
+		fmt::memory_buffer buffer;
+		auto flush = [&fout, &buffer](size_t threshold)
+		{
+			if (buffer.size() < threshold)
+				return;
+
+			fout.write(buffer.data(), buffer.size());
+			buffer.clear();
+		};
+
 		// Write vertices
-		for (unsigned int i = 0; i < nr_nodes; ++i)
+		vector<float> positions(3 * SerialiserChunkSize);
+		for (unsigned int i = 0; i < nr_nodes; i += SerialiserChunkSize)
 		{
-			std::vector<float> pos;
-			serialiser->fetchNode(pos);
-			fout << "v " << pos[0] << " " << pos[1] << " " << pos[2] << endl;
+			const unsigned int count = std::min(SerialiserChunkSize, nr_nodes - i);
+			serialiser->fetchNodes({ positions.data(), 3 * count }, 3);
+
+			for (unsigned int n = 0; n < count; n++)
+			{
+				const float* pos = positions.data() + 3 * n;
+				fmt::format_to(back_inserter(buffer), "v {} {} {}\n", pos[0], pos[1], pos[2]);
+			}
+			flush(WriteBufferBytes);
 		}
 
 		// Write tetrahedra
-		for (unsigned int i = 0; i < nr_cells; ++i)
+		vector<unsigned int> cells(4 * SerialiserChunkSize);
+		for (unsigned int i = 0; i < nr_cells; i += SerialiserChunkSize)
 		{
-			std::vector<unsigned int> cell;
-			serialiser->fetchVolume(cell);
-
-			if (cell.size() != 4)
-				continue;
+			const unsigned int count = std::min(SerialiserChunkSize, nr_cells - i);
+			serialiser->fetchVolumes({ cells.data(), 4 * count }, 4);
 
-			fout << "t " << cell[0] << " " << cell[1] << " " << cell[2] << " " << cell[3] << endl;
+			for (unsigned int c = 0; c < count; c++)
+			{
+				const unsigned int* cell = cells.data() + 4 * c;
+				fmt::format_to(back_inserter(buffer), "t {} {} {} {}\n", cell[0], cell[1], cell[2], cell[3]);
+			}
+			flush(WriteBufferBytes);
 		}
+		flush(0);
 
 		// Write footer
 		fout.close();
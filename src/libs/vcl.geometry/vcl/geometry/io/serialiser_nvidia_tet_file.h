@@ -38,10 +38,21 @@ namespace Vcl { namespace Geometry { namespace IO
 {
 	class NvidiaTetSerialiser : public Serialiser
 	{
+	public:
+		explicit NvidiaTetSerialiser(ParseMode mode = ParseMode::Parallel) : _mode(mode) {}
+
 	public: // Read mesh file
 		virtual void load(AbstractDeserialiser* deserialiser, const std::string& path) const override;
 
 	public: // Write mesh file
 		virtual void store(AbstractSerialiser* serialiser, const std::string& path) const override;
+
+	private:
+		void loadSequential(AbstractDeserialiser* deserialiser, const std::string& path) const;
+		bool loadParallel(AbstractDeserialiser* deserialiser, const std::string& path) const;
+
+	private:
+		//! Strategy used to read the files
+		ParseMode _mode;
 	};
 }}}
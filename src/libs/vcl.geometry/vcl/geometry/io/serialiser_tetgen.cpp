@@ -25,15 +25,112 @@
 #include <vcl/geometry/io/serialiser_tetgen.h>
 
 // Standard C++ library
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <fstream>
 #include <vector>
 
+// Format library
+#include <fmt/format.h>
+
 // VCL
+#include <vcl/core/memory/mappedfile.h>
 #include <vcl/util/stringparser.h>
+#include <vcl/util/textparser.h>
 
 namespace Vcl { namespace Geometry { namespace IO
 {
+	namespace
+	{
+		//! Derive the paths of the node and element files from either of them
+		void splitPath(const std::string& path, std::string& node_path, std::string& ele_path)
+		{
+			if (path.size() >= 5 && path.substr(path.length() - 5) == ".node")
+			{
+				node_path = path;
+				ele_path = path.substr(0, path.length() - 5) + ".ele";
+			}
+			else if (path.size() >= 4 && path.substr(path.length() - 4) == ".ele")
+			{
+				node_path = path.substr(0, path.length() - 4) + ".node";
+				ele_path = path;
+			}
+		}
+
+		//! Block of lines of one of the files and the elements parsed from it
+		struct Chunk
+		{
+			gsl::span<const char> text;
+			bool nodes;
+
+			std::vector<float> positions;
+			std::vector<unsigned int> indices;
+		};
+
+		//! Read the number of elements and return the text following the header
+		gsl::span<const char> skipHeader(const Core::MappedFile& file, int& count)
+		{
+			const char* end = file.data() + file.size();
+
+			Util::TextReader reader{ { file.data(), static_cast<ptrdiff_t>(file.size()) } };
+			while (reader.nextLine())
+			{
+				if (reader.atLineEnd() || reader.startsWith('#'))
+					continue;
+
+				reader.readInt(count);
+				return{ reader.nextLineBegin(), end - reader.nextLineBegin() };
+			}
+
+			return{ end, end };
+		}
+
+		void parseNodes(Chunk& chunk)
+		{
+			auto& positions = chunk.positions;
+
+			Util::TextReader reader{ chunk.text };
+			while (reader.nextLine())
+			{
+				// Skip empty lines and comments
+				if (reader.atLineEnd() || reader.startsWith('#'))
+					continue;
+
+				int index;
+				float p[3] = { 0, 0, 0 };
+				reader.readInt(index);
+				reader.readFloat(p[0]);
+				reader.readFloat(p[1]);
+				reader.readFloat(p[2]);
+				positions.insert(positions.end(), p, p + 3);
+			}
+		}
+
+		void parseVolumes(Chunk& chunk)
+		{
+			auto& indices = chunk.indices;
+
+			Util::TextReader reader{ chunk.text };
+			while (reader.nextLine())
+			{
+				// Skip empty lines and comments
+				if (reader.atLineEnd() || reader.startsWith('#'))
+					continue;
+
+				// Indices in the file are one-based
+				int index;
+				int t[4] = { 0, 0, 0, 0 };
+				reader.readInt(index);
+				for (int& i : t)
+				{
+					reader.readInt(i);
+					indices.push_back(static_cast<unsigned int>(i - 1));
+				}
+			}
+		}
+	}
+
 	void TetGenSerialiser::load(AbstractDeserialiser* deserialiser, const std::string& path) const
 	{
 		using namespace std;
@@ -43,17 +140,17 @@ namespace Vcl { namespace Geometry { namespace IO
 		// Check for the file endings
 		string node_path;
 		string ele_path;
+		splitPath(path, node_path, ele_path);
 
-		if (path.substr(path.length() - 5) == ".node")
-		{
-			node_path = path;
-			ele_path = path.substr(0, path.length() - 5) + ".ele";
-		}
-		else if (path.substr(path.length() - 4) == ".ele")
-		{
-			node_path = path.substr(0, path.length() - 4) + ".node";
-			ele_path = path;
-		}
+		if (_mode == ParseMode::Parallel && loadParallel(deserialiser, node_path, ele_path))
+			return;
+
+		loadSequential(deserialiser, node_path, ele_path);
+	}
+
+	void TetGenSerialiser::loadSequential(AbstractDeserialiser* deserialiser, const std::string& node_path, const std::string& ele_path) const
+	{
+		using namespace std;
 
 		ifstream fin_node(node_path.c_str());
 		ifstream fin_ele(ele_path.c_str());
@@ -75,8 +172,11 @@ namespace Vcl { namespace Geometry { namespace IO
 		// Start importing the mesh
 		deserialiser->begin();
 
-		std::vector<float> position(3);
-		std::vector<unsigned int> tetrahedron(4);
+		// Elements are handed to the deserialiser in chunks
+		std::vector<float> positions;
+		std::vector<unsigned int> volumes;
+		positions.reserve(3 * DeserialiserChunkSize);
+		volumes.reserve(4 * DeserialiserChunkSize);
 
 		// Read the node header
 		string token;
@@ -121,14 +221,21 @@ namespace Vcl { namespace Geometry { namespace IO
 				}
 				else
 				{
-					node_parser.readFloat(&position[0]);
-					node_parser.readFloat(&position[1]);
-					node_parser.readFloat(&position[2]);
+					float p0, p1, p2;
+					node_parser.readFloat(&p0);
+					node_parser.readFloat(&p1);
+					node_parser.readFloat(&p2);
 
-					deserialiser->addNode(position);
+					positions.insert(positions.end(), { p0, p1, p2 });
+					if (positions.size() == 3 * DeserialiserChunkSize)
+					{
+						deserialiser->addNodes(positions, 3);
+						positions.clear();
+					}
 				}
 			}
 		}
+		deserialiser->addNodes(positions, 3);
 		
 		// Read the element header
 		while (ele_parser.loadLine())
@@ -170,19 +277,148 @@ namespace Vcl { namespace Geometry { namespace IO
 				}
 				else
 				{
-					ele_parser.readInt(reinterpret_cast<int*>(&tetrahedron[0])); tetrahedron[0] -= 1;
-					ele_parser.readInt(reinterpret_cast<int*>(&tetrahedron[1])); tetrahedron[1] -= 1;
-					ele_parser.readInt(reinterpret_cast<int*>(&tetrahedron[2])); tetrahedron[2] -= 1;
-					ele_parser.readInt(reinterpret_cast<int*>(&tetrahedron[3])); tetrahedron[3] -= 1;
+					// Indices in the file are one-based
+					int i0, i1, i2, i3;
+					ele_parser.readInt(&i0);
+					ele_parser.readInt(&i1);
+					ele_parser.readInt(&i2);
+					ele_parser.readInt(&i3);
 
-					deserialiser->addVolume(tetrahedron);
+					volumes.insert(volumes.end(), { static_cast<unsigned>(i0 - 1), static_cast<unsigned>(i1 - 1), static_cast<unsigned>(i2 - 1), static_cast<unsigned>(i3 - 1) });
+					if (volumes.size() == 4 * DeserialiserChunkSize)
+					{
+						deserialiser->addVolumes(volumes, 4);
+						volumes.clear();
+					}
 				}
 			}
 		}
+		deserialiser->addVolumes(volumes, 4);
 		
 		deserialiser->end();
 
 		fin_node.close();
 		fin_ele.close();
 	}
+
+	bool TetGenSerialiser::loadParallel(AbstractDeserialiser* deserialiser, const std::string& node_path, const std::string& ele_path) const
+	{
+		auto node_file = Core::MappedFile::open(node_path);
+		auto ele_file = Core::MappedFile::open(ele_path);
+		if (!node_file || !ele_file)
+			return false;
+
+		int nr_nodes = 0;
+		int nr_volumes = 0;
+		const auto node_data = skipHeader(*node_file, nr_nodes);
+		const auto ele_data = skipHeader(*ele_file, nr_volumes);
+
+		// Split both files into blocks of lines, which are parsed concurrently
+		std::vector<Chunk> chunks;
+		for (const auto& text : Util::splitLines(node_data, node_data.size() / ParseChunkBytes + 1))
+			chunks.push_back({ text, true });
+		for (const auto& text : Util::splitLines(ele_data, ele_data.size() / ParseChunkBytes + 1))
+			chunks.push_back({ text, false });
+
+		const ptrdiff_t nr_chunks = static_cast<ptrdiff_t>(chunks.size());
+#ifdef _OPENMP
+#	pragma omp parallel for schedule(dynamic, 1)
+#endif // _OPENMP
+		for (ptrdiff_t i = 0; i < nr_chunks; i++)
+		{
+			if (chunks[i].nodes)
+				parseNodes(chunks[i]);
+			else
+				parseVolumes(chunks[i]);
+		}
+
+		// Hand the elements to the deserialiser in the order of the files
+		deserialiser->begin();
+		deserialiser->sizeHintNodes(static_cast<unsigned int>(std::max(nr_nodes, 0)));
+		deserialiser->sizeHintVolumes(static_cast<unsigned int>(std::max(nr_volumes, 0)));
+		for (const auto& chunk : chunks)
+		{
+			if (chunk.nodes)
+				deserialiser->addNodes(chunk.positions, 3);
+			else
+				deserialiser->addVolumes(chunk.indices, 4);
+		}
+		deserialiser->end();
+
+		return true;
+	}
+
+	void TetGenSerialiser::store(AbstractSerialiser* serialiser, const std::string& path) const
+	{
+		using namespace std;
+
+		Require(serialiser != nullptr, "Serialiser is given.");
+
+		string node_path;
+		string ele_path;
+		splitPath(path, node_path, ele_path);
+
+		ofstream node_file(node_path.c_str(), ios_base::out | ios_base::binary);
+		ofstream ele_file(ele_path.c_str(), ios_base::out | ios_base::binary);
+		if (!node_file.is_open() || !ele_file.is_open())
+			return;
+
+		// Start writing the mesh
+		serialiser->begin();
+
+		// Element counts
+		unsigned int nr_nodes = serialiser->nrNodes();
+		unsigned int nr_volumes = serialiser->nrVolumes();
+
+		// Text is collected in a buffer and written in large blocks
+		fmt::memory_buffer buffer;
+		auto flush = [&buffer](ofstream& fout, size_t threshold)
+		{
+			if (buffer.size() < threshold)
+				return;
+
+			fout.write(buffer.data(), buffer.size());
+			buffer.clear();
+		};
+
+		// Write the nodes: <#points> <dimension> <#attributes> <#boundary markers>
+		fmt::format_to(back_inserter(buffer), "{} 3 0 0\n", nr_nodes);
+
+		vector<float> positions(3 * SerialiserChunkSize);
+		for (unsigned int i = 0; i < nr_nodes; i += SerialiserChunkSize)
+		{
+			const unsigned int count = std::min(SerialiserChunkSize, nr_nodes - i);
+			serialiser->fetchNodes({ positions.data(), 3 * count }, 3);
+
+			for (unsigned int n = 0; n < count; n++)
+			{
+				const float* pos = positions.data() + 3 * n;
+				fmt::format_to(back_inserter(buffer), "{} {} {} {}\n", i + n + 1, pos[0], pos[1], pos[2]);
+			}
+			flush(node_file, WriteBufferBytes);
+		}
+		flush(node_file, 0);
+
+		// Write the tetrahedra: <#tetrahedra> <nodes per tetrahedron> <#attributes>
+		fmt::format_to(back_inserter(buffer), "{} 4 0\n", nr_volumes);
+
+		vector<unsigned int> volumes(4 * SerialiserChunkSize);
+		for (unsigned int i = 0; i < nr_volumes; i += SerialiserChunkSize)
+		{
+			const unsigned int count = std::min(SerialiserChunkSize, nr_volumes - i);
+			serialiser->fetchVolumes({ volumes.data(), 4 * count }, 4);
+
+			// Indices in the file are one-based
+			for (unsigned int v = 0; v < count; v++)
+			{
+				const unsigned int* vol = volumes.data() + 4 * v;
+				fmt::format_to(back_inserter(buffer), "{} {} {} {} {}\n", i + v + 1, vol[0] + 1, vol[1] + 1, vol[2] + 1, vol[3] + 1);
+			}
+			flush(ele_file, WriteBufferBytes);
+		}
+		flush(ele_file, 0);
+
+		// End writing the mesh
+		serialiser->end();
+	}
 }}}
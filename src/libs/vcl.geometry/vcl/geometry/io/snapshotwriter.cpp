@@ -0,0 +1,123 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/geometry/io/snapshotwriter.h>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Geometry { namespace IO
+{
+	SnapshotWriter::SnapshotWriter(size_t max_pending)
+	: _maxPending(max_pending)
+	{
+		Require(max_pending > 0, "At least one snapshot can be queued.");
+
+		_worker = std::thread([this]() { run(); });
+	}
+
+	SnapshotWriter::~SnapshotWriter()
+	{
+		{
+			std::unique_lock<std::mutex> guard(_lock);
+			_stop = true;
+		}
+		_changed.notify_all();
+		_worker.join();
+	}
+
+	void SnapshotWriter::store(const TetraMesh& mesh, std::shared_ptr<const Serialiser> format, const std::string& path)
+	{
+		Require(format, "Format is given.");
+
+		enqueue(mesh, [format, path](const TetraMesh& snapshot)
+		{
+			TetraMeshSerialiser serialiser(&snapshot);
+			format->store(&serialiser, path);
+		});
+	}
+
+	void SnapshotWriter::wait()
+	{
+		std::unique_lock<std::mutex> guard(_lock);
+		_changed.wait(guard, [this]() { return _jobs.empty() && !_busy; });
+	}
+
+	void SnapshotWriter::acquire()
+	{
+		std::unique_lock<std::mutex> guard(_lock);
+		_changed.wait(guard, [this]()
+		{
+			// The snapshot being written is still alive
+			const size_t alive = _jobs.size() + _reserved + (_busy ? 1 : 0);
+			return alive < _maxPending;
+		});
+		_reserved++;
+	}
+
+	void SnapshotWriter::release()
+	{
+		{
+			std::unique_lock<std::mutex> guard(_lock);
+			Check(_reserved > 0, "Slot was reserved.");
+			_reserved--;
+		}
+		_changed.notify_all();
+	}
+
+	void SnapshotWriter::schedule(std::function<void()> job)
+	{
+		{
+			std::unique_lock<std::mutex> guard(_lock);
+			Check(_reserved > 0, "Slot was reserved.");
+			_reserved--;
+			_jobs.emplace_back(std::move(job));
+		}
+		_changed.notify_all();
+	}
+
+	void SnapshotWriter::run()
+	{
+		std::unique_lock<std::mutex> guard(_lock);
+		for (;;)
+		{
+			// Pending snapshots are written before terminating
+			_changed.wait(guard, [this]() { return _stop || !_jobs.empty(); });
+			if (_jobs.empty())
+				return;
+
+			auto job = std::move(_jobs.front());
+			_jobs.pop_front();
+			_busy = true;
+			guard.unlock();
+			_changed.notify_all();
+
+			job();
+
+			guard.lock();
+			_busy = false;
+			_changed.notify_all();
+		}
+	}
+}}}
@@ -0,0 +1,153 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// VCL
+#include <vcl/geometry/io/serialiser.h>
+#include <vcl/geometry/io/serialiser_binary_mesh.h>
+#include <vcl/geometry/io/tetramesh_serialiser.h>
+
+namespace Vcl { namespace Geometry { namespace IO
+{
+	/*!
+	 *	\brief Writes mesh snapshots on a background thread
+	 *
+	 *	Each request copies the mesh on the calling thread and hands the copy
+	 *	to a worker thread, which writes it while the caller continues to modify
+	 *	the original. Snapshots are written in the order they are requested.
+	 *	At most 'max_pending' snapshots, including the one being written, are
+	 *	kept in memory; further requests block before copying the mesh until
+	 *	the worker has finished one of them.
+	 */
+	class SnapshotWriter
+	{
+	public:
+		explicit SnapshotWriter(size_t max_pending = 2);
+		SnapshotWriter(const SnapshotWriter&) = delete;
+		SnapshotWriter& operator= (const SnapshotWriter&) = delete;
+
+		//! Writes all pending snapshots before returning
+		~SnapshotWriter();
+
+	public:
+		/*!
+		 *	\brief Queue a snapshot written by a user provided function
+		 *	\param mesh Mesh to copy
+		 *	\param func Function with the signature (const MeshT&), called on the worker thread
+		 */
+		template<typename MeshT, typename Func>
+		void enqueue(const MeshT& mesh, Func&& func)
+		{
+			acquire();
+
+			std::shared_ptr<const MeshT> snapshot;
+			try
+			{
+				snapshot = std::make_shared<const MeshT>(mesh);
+			}
+			catch (...)
+			{
+				release();
+				throw;
+			}
+			schedule([snapshot, func]()
+			{
+				func(*snapshot);
+			});
+		}
+
+		//! Queue a snapshot written to a binary mesh file
+		template<typename MeshT>
+		void store(const MeshT& mesh, const std::string& path)
+		{
+			enqueue(mesh, [this, path](const MeshT& snapshot)
+			{
+				if (!BinaryMeshSerialiser{}.store(snapshot, path))
+					_nrFailures++;
+			});
+		}
+
+		//! Queue a snapshot written to a text file using 'format'
+		void store(const TetraMesh& mesh, std::shared_ptr<const Serialiser> format, const std::string& path);
+
+		//! Block until all queued snapshots are written
+		void wait();
+
+		//! Number of snapshots which could not be written to a binary mesh file
+		size_t nrFailures() const { return _nrFailures; }
+
+	private:
+		//! Block until a snapshot can be created and reserve its slot
+		void acquire();
+
+		//! Give back a slot reserved by 'acquire'
+		void release();
+
+		//! Queue a job for a slot reserved by 'acquire'
+		void schedule(std::function<void()> job);
+		void run();
+
+	private:
+		//! Maximum number of snapshots alive at the same time
+		size_t _maxPending;
+
+		//! Snapshots currently being copied by callers
+		size_t _reserved{ 0 };
+
+		//! Snapshots waiting to be written
+		std::deque<std::function<void()>> _jobs;
+
+		//! Snapshot currently being written
+		bool _busy{ false };
+
+		//! Request to terminate the worker
+		bool _stop{ false };
+
+		//! Failed binary writes; only modified by the worker
+		std::atomic<size_t> _nrFailures{ 0 };
+
+		//! Protects the queue and the state flags
+		std::mutex _lock;
+
+		//! Signals changes of the queue
+		std::condition_variable _changed;
+
+		//! Thread writing the snapshots
+		std::thread _worker;
+	};
+}}}
@@ -24,11 +24,106 @@
  */
 #include <vcl/geometry/io/tetramesh_serialiser.h>
 
+// C++ standard library
+#include <cstring>
+
 // VCL
 #include <vcl/core/contract.h>
 
 namespace Vcl { namespace Geometry { namespace IO
 {
+	TetraMeshSerialiser::TetraMeshSerialiser(const TetraMesh* mesh)
+	: _mesh(mesh)
+	{
+		Require(mesh != nullptr, "Mesh is given.");
+	}
+
+	void TetraMeshSerialiser::begin()
+	{
+		_currentNode = 0;
+		_currentVolume = 0;
+	}
+
+	void TetraMeshSerialiser::end()
+	{
+	}
+
+	unsigned int TetraMeshSerialiser::nrNodes()
+	{
+		return _mesh->nrVertices();
+	}
+
+	unsigned int TetraMeshSerialiser::nrEdges()
+	{
+		return 0;
+	}
+
+	unsigned int TetraMeshSerialiser::nrFaces()
+	{
+		return 0;
+	}
+
+	unsigned int TetraMeshSerialiser::nrVolumes()
+	{
+		return _mesh->nrVolumes();
+	}
+
+	void TetraMeshSerialiser::fetchNode(std::vector<float>& coordinates)
+	{
+		Require(_currentNode < _mesh->nrVertices(), "Node is in range.");
+
+		const auto& p = _mesh->vertices()[_currentNode++];
+		coordinates.assign(p.data(), p.data() + 3);
+	}
+
+	void TetraMeshSerialiser::fetchEdge(std::vector<unsigned int>& indices)
+	{
+		indices.clear();
+	}
+
+	void TetraMeshSerialiser::fetchFace(std::vector<unsigned int>& indices)
+	{
+		indices.clear();
+	}
+
+	void TetraMeshSerialiser::fetchVolume(std::vector<unsigned int>& indices)
+	{
+		Require(_currentVolume < _mesh->nrVolumes(), "Volume is in range.");
+
+		const auto& v = _mesh->volumes()[_currentVolume++];
+		indices = { v[0].id(), v[1].id(), v[2].id(), v[3].id() };
+	}
+
+	void TetraMeshSerialiser::fetchNodes(gsl::span<float> coordinates, unsigned int stride)
+	{
+		Require(stride == 3, "Positions in 3D space.");
+		Require(coordinates.size() % 3 == 0, "Data consists of complete positions.");
+
+		const unsigned int count = static_cast<unsigned int>(coordinates.size() / 3);
+		Require(_currentNode + count <= _mesh->nrVertices(), "Nodes are in range.");
+
+		const auto* positions = _mesh->vertices()->data() + _currentNode;
+		for (unsigned int i = 0; i < count; i++)
+			Eigen::Vector3f::Map(coordinates.data() + 3 * i) = positions[i];
+		_currentNode += count;
+	}
+
+	void TetraMeshSerialiser::fetchVolumes(gsl::span<unsigned int> indices, unsigned int arity)
+	{
+		Require(arity == 4, "Indices describe tetrahedra.");
+		Require(indices.size() % 4 == 0, "Data consists of complete tetrahedra.");
+
+		static_assert(sizeof(TetraMesh::Volume) == 4 * sizeof(unsigned int), "Volumes are stored as four packed indices.");
+
+		const unsigned int count = static_cast<unsigned int>(indices.size() / 4);
+		Require(_currentVolume + count <= _mesh->nrVolumes(), "Volumes are in range.");
+		Require(indices.size() >= static_cast<size_t>(arity) * count, "Output holds all requested volumes.");
+
+		if (count > 0)
+			memcpy(indices.data(), _mesh->volumes()->data() + _currentVolume, count * sizeof(TetraMesh::Volume));
+		_currentVolume += count;
+	}
+
 	void TetraMeshDeserialiser::begin()
 	{
 	}
@@ -79,6 +174,30 @@ namespace Vcl { namespace Geometry { namespace IO
 		_volumes.push_back(volume);
 	}
 
+	void TetraMeshDeserialiser::addNodes(gsl::span<const float> coordinates, unsigned int stride)
+	{
+		Require(stride == 3, "Positions in 3D space.");
+		Require(coordinates.size() % 3 == 0, "Data consists of complete positions.");
+
+		const size_t count = static_cast<size_t>(coordinates.size()) / 3;
+		const size_t offset = _positions.size();
+		_positions.resize(offset + count);
+		for (size_t i = 0; i < count; i++)
+			_positions[offset + i] = Eigen::Vector3f::Map(coordinates.data() + 3 * i);
+	}
+
+	void TetraMeshDeserialiser::addVolumes(gsl::span<const unsigned int> indices, unsigned int arity)
+	{
+		Require(arity == 4, "Indices describe tetrahedra.");
+		Require(indices.size() % 4 == 0, "Data consists of complete tetrahedra.");
+
+		const size_t count = static_cast<size_t>(indices.size()) / 4;
+		const size_t offset = _volumes.size();
+		_volumes.resize(offset + count);
+		if (count > 0)
+			memcpy(_volumes.data() + offset, indices.data(), count * sizeof(std::array<unsigned int, 4>));
+	}
+
 	void TetraMeshDeserialiser::addNormal(const Vector3f& normal)
 	{
 	}
@@ -38,6 +38,41 @@
 
 namespace Vcl { namespace Geometry { namespace IO
 {
+	class TetraMeshSerialiser : public AbstractSerialiser
+	{
+	public:
+		TetraMeshSerialiser(const TetraMesh* mesh);
+
+	public:
+		virtual void begin();
+		virtual void end();
+
+	public:
+		virtual unsigned int nrNodes();
+		virtual unsigned int nrEdges();
+		virtual unsigned int nrFaces();
+		virtual unsigned int nrVolumes();
+
+	public:
+		virtual void fetchNode(std::vector<float>& coordinates);
+		virtual void fetchEdge(std::vector<unsigned int>& indices);
+		virtual void fetchFace(std::vector<unsigned int>& indices);
+		virtual void fetchVolume(std::vector<unsigned int>& indices);
+
+		virtual void fetchNodes(gsl::span<float> coordinates, unsigned int stride);
+		virtual void fetchVolumes(gsl::span<unsigned int> indices, unsigned int arity);
+
+	private:
+		//! Exported mesh
+		const TetraMesh* _mesh;
+
+		//! Next node to fetch
+		unsigned int _currentNode{ 0 };
+
+		//! Next volume to fetch
+		unsigned int _currentVolume{ 0 };
+	};
+
 	class TetraMeshDeserialiser : public AbstractDeserialiser
 	{
 	public:
@@ -59,6 +94,9 @@ namespace Vcl { namespace Geometry { namespace IO
 		virtual void addFace(const std::vector<unsigned int>& indices);
 		virtual void addVolume(const std::vector<unsigned int>& indices);
 
+		virtual void addNodes(gsl::span<const float> coordinates, unsigned int stride);
+		virtual void addVolumes(gsl::span<const unsigned int> indices, unsigned int arity);
+
 		virtual void addNormal(const Vector3f& normal);
 
 	private:
@@ -0,0 +1,303 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/geometry/marchingcubes.h>
+
+// C++ standard library
+#include <algorithm>
+
+// VCL
+#include <vcl/core/simd/memory.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/contract.h>
+#include <vcl/geometry/marchingcubestables.h>
+#include <vcl/util/parallelfor.h>
+
+namespace Vcl { namespace Geometry
+{
+	namespace
+	{
+		//! Marks grid edges not crossed by the surface
+		const uint32_t NoVertex = 0xffffffff;
+
+		//! Number of cells classified at once
+		const int PacketWidth = 8;
+
+		/*!
+		 *	Location of the twelve cell edges relative to the lower cell
+		 *	corner: axis, offsets along x, y and z. The cell corners 0 to 3
+		 *	lie in the lower plane at (0, 0), (1, 0), (1, 1), (0, 1), the
+		 *	corners 4 to 7 above them. The edges 0 to 3 connect the lower
+		 *	corners, the edges 4 to 7 the upper corners and the edges 8 to 11
+		 *	connect corner i with corner i + 4.
+		 */
+		const int CellEdges[12][4] =
+		{
+			{ 0, 0, 0, 0 }, { 1, 1, 0, 0 }, { 0, 0, 1, 0 }, { 1, 0, 0, 0 },
+			{ 0, 0, 0, 1 }, { 1, 1, 0, 1 }, { 0, 0, 1, 1 }, { 1, 0, 0, 1 },
+			{ 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 2, 1, 1, 0 }, { 2, 0, 1, 0 }
+		};
+
+		//! Offsets of the cell corners along x, y and z
+		const int CellCorners[8][3] =
+		{
+			{ 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 },
+			{ 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 }
+		};
+
+		//! Vertex indices of the crossed edges of a plane of grid points
+		struct EdgePlane
+		{
+			std::vector<uint32_t> edges[3];
+		};
+	}
+
+	MarchingCubes::MarchingCubes(const Eigen::Vector3ui& dim, const Eigen::Vector3f& origin, const Eigen::Vector3f& spacing)
+	: _dim(dim)
+	, _origin(origin)
+	, _spacing(spacing)
+	{
+	}
+
+	std::unique_ptr<TriMesh> MarchingCubes::extract(gsl::span<const float> values, float iso) const
+	{
+		std::vector<Eigen::Vector3f> vertices;
+		std::vector<std::array<unsigned int, 3>> faces;
+		extract(values, iso, 32, [&vertices, &faces](const IsoSurfaceSlab& slab)
+		{
+			vertices.insert(vertices.end(), slab.vertices.begin(), slab.vertices.end());
+			faces.insert(faces.end(), slab.triangles.begin(), slab.triangles.end());
+		});
+
+		return std::make_unique<TriMesh>(vertices, faces);
+	}
+
+	void MarchingCubes::extract(gsl::span<const float> values, float iso, unsigned int slab_size, const SlabCallback& emit) const
+	{
+		Require(static_cast<size_t>(values.size()) == static_cast<size_t>(_dim.x()) * _dim.y() * _dim.z(), "Values cover the grid.");
+		Require(slab_size > 0, "Slabs contain cells.");
+
+		if (_dim.x() < 2 || _dim.y() < 2 || _dim.z() < 2)
+			return;
+
+		const int X = static_cast<int>(_dim.x());
+		const int Y = static_cast<int>(_dim.y());
+		const int Z = static_cast<int>(_dim.z());
+		const size_t plane_size = static_cast<size_t>(X) * Y;
+		const float* data = values.data();
+
+		// Edge tables of the grid planes bounding the cells of a slab
+		std::vector<EdgePlane> planes(std::min<size_t>(slab_size, Z - 1) + 1);
+		for (auto& plane : planes)
+			for (auto& edges : plane.edges)
+				edges.assign(plane_size, NoVertex);
+
+		// Output of the rows of a slab
+		std::vector<std::vector<Eigen::Vector3f>> row_vertices;
+		std::vector<std::vector<std::array<uint32_t, 3>>> row_triangles;
+		std::vector<uint32_t> row_offsets;
+
+		IsoSurfaceSlab slab;
+		slab.firstVertex = 0;
+		for (int k0 = 0; k0 < Z - 1; k0 += static_cast<int>(slab_size))
+		{
+			const int k1 = std::min(k0 + static_cast<int>(slab_size), Z - 1);
+			const int nr_layers = k1 - k0;
+			const int nr_planes = nr_layers + 1;
+
+			// The edges within the lower plane were created by the previous slab
+			if (k0 > 0)
+				std::swap(planes.front(), planes.back());
+
+			// Create the vertices on the edges owned by the planes of the slab.
+			// A plane owns the edges within it and the z-edges towards the
+			// previous plane. This keeps the numbering of the vertices
+			// independent of the slab size.
+			const auto ownsAxis = [k0](int q, int a)
+			{
+				return q > 0 || (k0 == 0 && a < 2);
+			};
+			const auto edgeTable = [&planes](int q, int a) -> std::vector<uint32_t>&
+			{
+				return a < 2 ? planes[q].edges[a] : planes[q - 1].edges[2];
+			};
+
+			const int nr_vertex_rows = nr_planes * Y;
+			row_vertices.resize(std::max(row_vertices.size(), static_cast<size_t>(nr_vertex_rows)));
+			row_offsets.resize(nr_vertex_rows + 1);
+			Util::parallelFor(nr_vertex_rows, 4, [&](int r)
+			{
+				const int q = r / Y;
+				const int j = r % Y;
+				const int k = k0 + q;
+
+				auto& out = row_vertices[r];
+				out.clear();
+
+				const int strides[] = { 1, X, static_cast<int>(plane_size) };
+				for (int a = 0; a < 3; a++)
+				{
+					if (!ownsAxis(q, a))
+						continue;
+
+					uint32_t* edges = edgeTable(q, a).data() + static_cast<size_t>(j) * X;
+					std::fill(edges, edges + X, NoVertex);
+					if (a == 1 && j == Y - 1)
+						continue;
+
+					// Edges start at the lower grid point
+					const int k_lower = a < 2 ? k : k - 1;
+					const float* row = data + k_lower * plane_size + j * X;
+					for (int i = 0; i < (a == 0 ? X - 1 : X); i++)
+					{
+						const float v0 = row[i];
+						const float v1 = row[i + strides[a]];
+						if ((v0 < iso) == (v1 < iso))
+							continue;
+
+						Eigen::Vector3f p{ static_cast<float>(i), static_cast<float>(j), static_cast<float>(k_lower) };
+						p[a] += (iso - v0) / (v1 - v0);
+
+						edges[i] = static_cast<uint32_t>(out.size());
+						out.emplace_back(_origin + p.cwiseProduct(_spacing));
+					}
+				}
+			});
+
+			// Number the vertices consecutively
+			row_offsets[0] = slab.firstVertex;
+			for (int r = 0; r < nr_vertex_rows; r++)
+				row_offsets[r + 1] = row_offsets[r] + static_cast<uint32_t>(row_vertices[r].size());
+
+			Util::parallelFor(nr_vertex_rows, 4, [&](int r)
+			{
+				if (row_vertices[r].empty())
+					return;
+
+				const int q = r / Y;
+				const int j = r % Y;
+				for (int a = 0; a < 3; a++)
+				{
+					if (!ownsAxis(q, a))
+						continue;
+
+					uint32_t* edges = edgeTable(q, a).data() + static_cast<size_t>(j) * X;
+					for (int i = 0; i < X; i++)
+					{
+						if (edges[i] != NoVertex)
+							edges[i] += row_offsets[r];
+					}
+				}
+			});
+
+			// Triangulate the cells
+			const int nr_cell_rows = nr_layers * (Y - 1);
+			row_triangles.resize(std::max(row_triangles.size(), static_cast<size_t>(nr_cell_rows)));
+			Util::parallelFor(nr_cell_rows, 4, [&](int r)
+			{
+				const int q = r / (Y - 1);
+				const int j = r % (Y - 1);
+				const int k = k0 + q;
+
+				auto& out = row_triangles[r];
+				out.clear();
+
+				// Values at the cell corners
+				const float* rows[8];
+				for (int c = 0; c < 8; c++)
+					rows[c] = data + (k + CellCorners[c][2]) * plane_size + (j + CellCorners[c][1]) * X + CellCorners[c][0];
+
+				const auto triangulate = [&](int i, int cube_case)
+				{
+					const int nr_triangles = caseToNumPolys[cube_case];
+					const int32_t* list = edgeVertexList + 20 * cube_case;
+					for (int t = 0; t < nr_triangles; t++)
+					{
+						std::array<uint32_t, 3> tri;
+						for (int v = 0; v < 3; v++)
+						{
+							const int* edge = CellEdges[list[4 * t + v]];
+							const size_t idx = static_cast<size_t>(j + edge[2]) * X + i + edge[1];
+							tri[v] = planes[q + edge[3]].edges[edge[0]][idx];
+							Check(tri[v] != NoVertex, "Surface crosses the edge.");
+						}
+
+						// The tables orient the triangles towards the smaller values
+						out.push_back({ tri[0], tri[2], tri[1] });
+					}
+				};
+
+				// Classify a packet of cells at once. The case index is
+				// accumulated from the corner weights in floating point.
+				int i = 0;
+				const float8 iso_v{ iso };
+				for (; i + PacketWidth <= X - 1; i += PacketWidth)
+				{
+					float8 cube_case{ 0.0f };
+					for (int c = 0; c < 8; c++)
+					{
+						float8 v;
+						load(v, rows[c] + i);
+						cube_case += select(v < iso_v, float8(static_cast<float>(1 << c)), float8(0.0f));
+					}
+
+					if (none((cube_case > float8(0.0f)) && (cube_case < float8(255.0f))))
+						continue;
+
+					for (int l = 0; l < PacketWidth; l++)
+					{
+						const int lane_case = static_cast<int>(cube_case[l]);
+						if (lane_case != 0 && lane_case != 255)
+							triangulate(i + l, lane_case);
+					}
+				}
+				for (; i < X - 1; i++)
+				{
+					int cube_case = 0;
+					for (int c = 0; c < 8; c++)
+					{
+						if (rows[c][i] < iso)
+							cube_case |= 1 << c;
+					}
+					if (cube_case != 0 && cube_case != 255)
+						triangulate(i, cube_case);
+				}
+			});
+
+			// Hand out the surface of the slab
+			slab.vertices.clear();
+			slab.vertices.reserve(row_offsets[nr_vertex_rows] - slab.firstVertex);
+			for (int r = 0; r < nr_vertex_rows; r++)
+				slab.vertices.insert(slab.vertices.end(), row_vertices[r].begin(), row_vertices[r].end());
+
+			slab.triangles.clear();
+			for (int r = 0; r < nr_cell_rows; r++)
+				slab.triangles.insert(slab.triangles.end(), row_triangles[r].begin(), row_triangles[r].end());
+
+			emit(slab);
+
+			slab.firstVertex = row_offsets[nr_vertex_rows];
+		}
+	}
+}}
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// GSL
+#include <gsl/span>
+
+// VCL
+#include <vcl/geometry/trimesh.h>
+
+namespace Vcl { namespace Geometry
+{
+	/*!
+	 *	\brief Part of an iso-surface extracted from a slab of grid cells
+	 */
+	struct IsoSurfaceSlab
+	{
+		//! Index of the first vertex of the slab within the whole surface
+		uint32_t firstVertex;
+
+		//! Vertices created by the slab
+		std::vector<Eigen::Vector3f> vertices;
+
+		//! Triangles of the slab, referencing the vertices of the whole surface
+		std::vector<std::array<uint32_t, 3>> triangles;
+	};
+
+	/*!
+	 *	\brief Iso-surface extraction from dense scalar grids
+	 *
+	 *	The grid stores one value per grid point with x varying fastest,
+	 *	the layout used by the Poisson solvers. Grid point (i, j, k) is
+	 *	located at origin + (i, j, k) * spacing. The triangles are oriented
+	 *	such that their normals point towards the larger values.
+	 *
+	 *	The cells are processed in slabs of layers along z. The rows of a
+	 *	slab are processed in parallel, classifying a packet of cells at once.
+	 *	Each surface vertex lies on a grid edge and is created once for its
+	 *	edge; the triangles of adjacent cells look up the vertices shared with
+	 *	them in per-plane tables indexed by the edges.
+	 */
+	class MarchingCubes
+	{
+	public:
+		//! Receives the slabs in the order of increasing z
+		using SlabCallback = std::function<void(const IsoSurfaceSlab&)>;
+
+	public:
+		MarchingCubes
+		(
+			const Eigen::Vector3ui& dim,
+			const Eigen::Vector3f& origin = Eigen::Vector3f::Zero(),
+			const Eigen::Vector3f& spacing = Eigen::Vector3f::Ones()
+		);
+
+	public:
+		/*!
+		 *	\brief Extract an iso-surface into a triangle mesh
+		 *	\param values Grid values
+		 *	\param iso Iso-value of the surface
+		 */
+		std::unique_ptr<TriMesh> extract(gsl::span<const float> values, float iso) const;
+
+		/*!
+		 *	\brief Extract an iso-surface slab by slab
+		 *	\param values Grid values
+		 *	\param iso Iso-value of the surface
+		 *	\param slab_size Number of cell layers per slab
+		 *	\param emit Function receiving the parts of the surface
+		 *
+		 *	Only the surface of a single slab is kept in memory. The vertices of
+		 *	a slab are numbered consecutively after the vertices of all
+		 *	previous slabs. Triangles may reference vertices of the previous
+		 *	slab, but never of later slabs. The concatenated slabs are equal to
+		 *	the mesh extracted at once, independent of the slab size.
+		 */
+		void extract(gsl::span<const float> values, float iso, unsigned int slab_size, const SlabCallback& emit) const;
+
+	public:
+		const Eigen::Vector3ui& dimensions() const { return _dim; }
+
+	private:
+		//! Number of grid points
+		Eigen::Vector3ui _dim;
+
+		//! Position of the first grid point
+		Eigen::Vector3f _origin;
+
+		//! Distance between grid points
+		Eigen::Vector3f _spacing;
+	};
+}}
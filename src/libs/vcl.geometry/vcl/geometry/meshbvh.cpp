@@ -0,0 +1,218 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/geometry/meshbvh.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+
+// VCL
+#include <vcl/util/parallelfor.h>
+
+namespace Vcl { namespace Geometry
+{
+	namespace
+	{
+		unsigned int nrPrimitives(const TriMesh& mesh)
+		{
+			return mesh.nrFaces();
+		}
+
+		unsigned int nrPrimitives(const TetraMesh& mesh)
+		{
+			return mesh.nrVolumes();
+		}
+
+		template<typename MeshT, typename ElementT>
+		Eigen::AlignedBox3f elementBounds(const MeshT& mesh, const ElementT& element)
+		{
+			Eigen::AlignedBox3f box;
+			for (const auto& v : element)
+				box.extend(mesh.vertices()[v]);
+			return box;
+		}
+
+		Eigen::AlignedBox3f primitiveBounds(const TriMesh& mesh, unsigned int p)
+		{
+			return elementBounds(mesh, mesh.faces()[p]);
+		}
+
+		Eigen::AlignedBox3f primitiveBounds(const TetraMesh& mesh, unsigned int p)
+		{
+			return elementBounds(mesh, mesh.volumes()[p]);
+		}
+
+		// Moeller-Trumbore ray-triangle test
+		bool intersectPrimitive(const TriMesh& mesh, unsigned int p, const Ray<float, 3>& ray, float& t)
+		{
+			const auto& face = mesh.faces()[p];
+			const Eigen::Vector3f& v0 = mesh.vertices()[face[0]];
+			const Eigen::Vector3f e1 = mesh.vertices()[face[1]] - v0;
+			const Eigen::Vector3f e2 = mesh.vertices()[face[2]] - v0;
+
+			const Eigen::Vector3f pvec = ray.direction().cross(e2);
+			const float det = e1.dot(pvec);
+			if (std::abs(det) < std::numeric_limits<float>::min())
+				return false;
+
+			const float inv_det = 1.0f / det;
+			const Eigen::Vector3f tvec = ray.origin() - v0;
+			const float u = tvec.dot(pvec) * inv_det;
+			if (u < 0 || u > 1)
+				return false;
+
+			const Eigen::Vector3f qvec = tvec.cross(e1);
+			const float v = ray.direction().dot(qvec) * inv_det;
+			if (v < 0 || u + v > 1)
+				return false;
+
+			const float t_hit = e2.dot(qvec) * inv_det;
+			if (t_hit < 0 || t_hit >= t)
+				return false;
+
+			t = t_hit;
+			return true;
+		}
+
+		// Clip the ray against the four face planes of the tetrahedron
+		bool intersectPrimitive(const TetraMesh& mesh, unsigned int p, const Ray<float, 3>& ray, float& t)
+		{
+			const auto& volume = mesh.volumes()[p];
+			const Eigen::Vector3f* v[] =
+			{
+				&mesh.vertices()[volume[0]],
+				&mesh.vertices()[volume[1]],
+				&mesh.vertices()[volume[2]],
+				&mesh.vertices()[volume[3]]
+			};
+
+			float t_enter = 0;
+			float t_exit = t;
+			for (int i = 0; i < 4; i++)
+			{
+				// Face opposite of vertex i with its normal pointing outwards
+				const Eigen::Vector3f& a = *v[(i + 1) % 4];
+				const Eigen::Vector3f& b = *v[(i + 2) % 4];
+				const Eigen::Vector3f& c = *v[(i + 3) % 4];
+				Eigen::Vector3f n = (b - a).cross(c - a);
+				if (n.dot(*v[i] - a) > 0)
+					n = -n;
+
+				const float num = n.dot(a - ray.origin());
+				const float denom = n.dot(ray.direction());
+				if (denom == 0)
+				{
+					if (num < 0)
+						return false;
+				}
+				else if (denom > 0)
+				{
+					t_exit = std::min(t_exit, num / denom);
+				}
+				else
+				{
+					t_enter = std::max(t_enter, num / denom);
+				}
+
+				if (t_enter > t_exit)
+					return false;
+			}
+
+			if (t_enter >= t)
+				return false;
+
+			t = t_enter;
+			return true;
+		}
+	}
+
+	template<typename MeshT, int Width>
+	MeshBvh<MeshT, Width>::MeshBvh(const MeshT& mesh, BvhBuilder builder)
+	: _mesh(&mesh)
+	, _builder(builder)
+	{
+		rebuild();
+	}
+
+	template<typename MeshT, int Width>
+	std::vector<Eigen::AlignedBox3f> MeshBvh<MeshT, Width>::computeBounds() const
+	{
+		const ptrdiff_t nr_primitives = static_cast<ptrdiff_t>(nrPrimitives(*_mesh));
+		std::vector<Eigen::AlignedBox3f> boxes(nr_primitives);
+
+		Util::parallelFor(nr_primitives, 1024, [&](ptrdiff_t p)
+		{
+			boxes[p] = primitiveBounds(*_mesh, static_cast<unsigned int>(p));
+		});
+
+		return boxes;
+	}
+
+	template<typename MeshT, int Width>
+	void MeshBvh<MeshT, Width>::rebuild()
+	{
+		const auto boxes = computeBounds();
+		_bvh.build(boxes, _builder);
+	}
+
+	template<typename MeshT, int Width>
+	void MeshBvh<MeshT, Width>::rebuild(BvhBuilder builder)
+	{
+		_builder = builder;
+		rebuild();
+	}
+
+	template<typename MeshT, int Width>
+	void MeshBvh<MeshT, Width>::refit()
+	{
+		const auto boxes = computeBounds();
+		_bvh.refit(boxes);
+	}
+
+	template<typename MeshT, int Width>
+	RayHit MeshBvh<MeshT, Width>::closestHit(const Ray<float, 3>& ray, float t_max) const
+	{
+		const MeshT& mesh = *_mesh;
+		return _bvh.closestHit(ray, t_max, [&mesh, &ray](uint32_t p, float& t)
+		{
+			return intersectPrimitive(mesh, p, ray, t);
+		});
+	}
+
+	template<typename MeshT, int Width>
+	bool MeshBvh<MeshT, Width>::anyHit(const Ray<float, 3>& ray, float t_max) const
+	{
+		const MeshT& mesh = *_mesh;
+		return _bvh.anyHit(ray, t_max, [&mesh, &ray](uint32_t p, float& t)
+		{
+			return intersectPrimitive(mesh, p, ray, t);
+		});
+	}
+
+	template class MeshBvh<TriMesh, 4>;
+	template class MeshBvh<TriMesh, 8>;
+	template class MeshBvh<TetraMesh, 4>;
+	template class MeshBvh<TetraMesh, 8>;
+}}
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <limits>
+#include <vector>
+
+// VCL
+#include <vcl/geometry/bvh.h>
+#include <vcl/geometry/ray.h>
+#include <vcl/geometry/tetramesh.h>
+#include <vcl/geometry/trimesh.h>
+
+namespace Vcl { namespace Geometry
+{
+	/*!
+	 *	\brief Bounding volume hierarchy over the elements of a mesh
+	 *
+	 *	The primitives are the faces of a TriMesh and the volumes of a
+	 *	TetraMesh. Primitive indices reported by the queries are the ids
+	 *	of the respective elements. The mesh is referenced and has to
+	 *	outlive the hierarchy.
+	 */
+	template<typename MeshT, int Width = 8>
+	class MeshBvh
+	{
+	public:
+		explicit MeshBvh(const MeshT& mesh, BvhBuilder builder = BvhBuilder::Sah);
+
+	public:
+		/*!
+		 *	\brief Find the closest element hit by a ray
+		 *
+		 *	Rays starting inside a volume of a TetraMesh hit the volume at t = 0.
+		 */
+		RayHit closestHit(const Ray<float, 3>& ray, float t_max = std::numeric_limits<float>::infinity()) const;
+
+		//! \returns true, if the ray hits any element before t_max
+		bool anyHit(const Ray<float, 3>& ray, float t_max = std::numeric_limits<float>::infinity()) const;
+
+		//! Update the hierarchy after the vertices of the mesh were moved
+		void refit();
+
+		//! Rebuild the hierarchy after the elements of the mesh changed
+		void rebuild();
+
+		//! Rebuild the hierarchy using a different construction algorithm
+		void rebuild(BvhBuilder builder);
+
+	public:
+		const MeshT& mesh() const { return *_mesh; }
+		const Bvh<Width>& hierarchy() const { return _bvh; }
+
+	private:
+		std::vector<Eigen::AlignedBox3f> computeBounds() const;
+
+		//! Referenced mesh
+		const MeshT* _mesh;
+
+		//! Algorithm used to build the hierarchy
+		BvhBuilder _builder;
+
+		//! Hierarchy over the mesh elements
+		Bvh<Width> _bvh;
+	};
+
+	extern template class MeshBvh<TriMesh, 4>;
+	extern template class MeshBvh<TriMesh, 8>;
+	extern template class MeshBvh<TetraMesh, 4>;
+	extern template class MeshBvh<TetraMesh, 8>;
+}}
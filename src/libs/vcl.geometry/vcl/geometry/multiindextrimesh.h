@@ -44,6 +44,8 @@
 
 namespace Vcl { namespace Geometry
 {
+	namespace IO { class BinaryMeshSerialiser; }
+
 	class MultiIndexTriMesh;
 
 	template<>
@@ -83,6 +85,8 @@ namespace Vcl { namespace Geometry
 
 	class MultiIndexTriMesh : public SimplexLevel2<MultiIndexTriMesh>, SimplexLevel0<MultiIndexTriMesh>
 	{
+		friend class IO::BinaryMeshSerialiser;
+
 	public:
 		using DependentFace = IndexDescriptionTrait<MultiIndexTriMesh>::DependentFace;
 		using DependentVertedId = IndexDescriptionTrait<MultiIndexTriMesh>::IndexType;
@@ -112,7 +116,26 @@ namespace Vcl { namespace Geometry
 			typename Property<T, IndexDescriptionTrait<MultiIndexTriMesh>::FaceId>::reference init_value
 		)
 		{
-			faceProperties().add<T>(name, init_value);
+			return faceProperties().add<T>(name, init_value);
+		}
+
+		//! Resolve a property of the face level for repeated access
+		template<typename T>
+		PropertyHandle<T, IndexDescriptionTrait<MultiIndexTriMesh>::FaceId> facePropertyHandle(Util::HashedString name) const
+		{
+			return faceProperties().template handle<T>(name);
+		}
+
+		//! Access a property of the face level through its handle
+		template<typename T>
+		const Property<T, IndexDescriptionTrait<MultiIndexTriMesh>::FaceId>* faceProperty(PropertyHandle<T, IndexDescriptionTrait<MultiIndexTriMesh>::FaceId> handle) const
+		{
+			return faceProperties().property(handle);
+		}
+		template<typename T>
+		Property<T, IndexDescriptionTrait<MultiIndexTriMesh>::FaceId>* faceProperty(PropertyHandle<T, IndexDescriptionTrait<MultiIndexTriMesh>::FaceId> handle)
+		{
+			return faceProperties().property(handle);
 		}
 
 	private: // Additional layers
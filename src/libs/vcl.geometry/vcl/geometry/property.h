@@ -26,17 +26,69 @@
 
 // VCL configuration
 #include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
 
 // C++ standard library
+#include <array>
+#include <cstring>
 #include <memory>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
 
 // VCL
 #include <vcl/core/memory/allocator.h>
+#include <vcl/core/memory/mappedfile.h>
+#include <vcl/core/memory/tracking.h>
 #include <vcl/core/contract.h>
+#include <vcl/geometry/genericid.h>
 
 namespace Vcl { namespace Geometry
 {
+	/*!
+	 *	\brief Block of memory shared by the properties of a group
+	 *
+	 *	Properties are relocated into regions of the slab when their group
+	 *	reserves storage for all of them at once (see PropertyGroup).
+	 */
+	class PropertySlab
+	{
+	public:
+		//! Alignment of the slab and of the regions of the properties
+		static const size_t Alignment = 64;
+
+	public:
+		explicit PropertySlab(size_t size)
+		: _data(static_cast<char*>(_mm_malloc(size, Alignment)))
+		, _size(size)
+		{
+		}
+		PropertySlab(const PropertySlab&) = delete;
+		PropertySlab& operator= (const PropertySlab&) = delete;
+
+		~PropertySlab()
+		{
+			_mm_free(_data);
+		}
+
+	public:
+		char* data() const { return _data; }
+		size_t size() const { return _size; }
+
+		//! Check if a pointer points into the slab
+		bool owns(const void* p) const
+		{
+			return p >= _data && p < _data + _size;
+		}
+
+	private:
+		//! Memory of the slab
+		char* _data;
+
+		//! Size of the slab in bytes
+		size_t _size;
+	};
+
 	class PropertyBase
 	{
 	public:
@@ -72,6 +124,48 @@ namespace Vcl { namespace Geometry
 		virtual void resize(size_t size) = 0;
 		virtual void reserve(size_t size) = 0;
 
+		//! Record the memory allocated by the property under \a tag
+		virtual void trackAllocations(const std::string& tag) = 0;
+
+		//! \returns the tag under which allocations are tracked, empty if they are not tracked
+		virtual const std::string& allocationTag() const = 0;
+
+	public: // Raw storage access
+		//! Size of a single element in bytes
+		virtual size_t elementSize() const = 0;
+
+		//! Check if the elements can be stored and restored as plain memory
+		virtual bool isBitwiseSerialisable() const = 0;
+
+		//! Description of the element type identifying the memory layout of stored elements
+		virtual std::string elementType() const = 0;
+
+		//! Memory of the elements
+		virtual const void* rawData() const = 0;
+
+		/*!
+		 *	\brief Use a region of a mapped file as storage
+		 *	\param file Mapped file providing the storage
+		 *	\param offset Offset of the first element in the file
+		 *	\param count Number of elements
+		 *
+		 *	The current content is discarded. The elements are modified in place,
+		 *	without changing the file. Growing the property moves the elements
+		 *	to regular memory.
+		 */
+		virtual void adopt(std::shared_ptr<const Core::MappedFile> file, size_t offset, size_t count) = 0;
+
+		/*!
+		 *	\brief Move the elements to a region of a slab
+		 *	\param slab Memory shared by multiple properties
+		 *	\param offset Offset of the region in the slab
+		 *	\param capacity Number of elements fitting into the region
+		 *
+		 *	Growing the property beyond 'capacity' moves the elements to
+		 *	regular memory.
+		 */
+		virtual void relocate(std::shared_ptr<PropertySlab> slab, size_t offset, size_t capacity) = 0;
+
 	protected:
 		inline void setSize(size_t size) { _size = size; }
 
@@ -96,6 +190,118 @@ namespace Vcl { namespace Geometry
 		{
 			typedef unsigned int type;
 		};
+
+		//! Elements which can be moved to a new location by copying their bytes
+		template<typename T>
+		struct IsBitwiseMovable : std::is_trivially_copyable<T> {};
+
+		template<typename T, size_t N>
+		struct IsBitwiseMovable<std::array<T, N>> : IsBitwiseMovable<T> {};
+
+		template<typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		struct IsBitwiseMovable<Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>>
+		: std::integral_constant<bool, Rows != Eigen::Dynamic && Cols != Eigen::Dynamic && IsBitwiseMovable<Scalar>::value> {};
+
+		/*!
+		 *	\brief Description of an element type
+		 *
+		 *	Arithmetic types, ids, arrays and fixed-size matrices are described
+		 *	by their layout, e.g., 'f32[3x1]'. Other types fall back to the
+		 *	compiler specific type name.
+		 */
+		template<typename T, typename Enable = void>
+		struct ElementType
+		{
+			static std::string name() { return typeid(T).name(); }
+		};
+
+		template<typename T>
+		struct ElementType<T, typename std::enable_if<std::is_arithmetic<T>::value>::type>
+		{
+			static std::string name()
+			{
+				const char* kind = std::is_floating_point<T>::value ? "f" : (std::is_signed<T>::value ? "i" : "u");
+				return kind + std::to_string(8 * sizeof(T));
+			}
+		};
+
+		template<typename T>
+		struct ElementType<T, typename std::enable_if<std::is_base_of<GenericId<T, typename T::IdType>, T>::value>::type>
+		{
+			static std::string name() { return "id:" + ElementType<typename T::IdType>::name(); }
+		};
+
+		template<typename T, size_t N>
+		struct ElementType<std::array<T, N>>
+		{
+			static std::string name() { return ElementType<T>::name() + "[" + std::to_string(N) + "]"; }
+		};
+
+		template<typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		struct ElementType<Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>>
+		{
+			static std::string name()
+			{
+				return ElementType<Scalar>::name() + "[" + std::to_string(Rows) + "x" + std::to_string(Cols) + "]";
+			}
+		};
+
+		/*!
+		 *	\brief Allocation policy of properties stored in a slab
+		 *
+		 *	New memory is allocated on the heap; only memory outside of the
+		 *	slab is released.
+		 */
+		template<typename T, int Alignment = 32>
+		class SlabAllocPolicy
+		{
+		public: // Typedefs
+			typedef T value_type;
+			typedef value_type* pointer;
+			typedef const value_type* const_pointer;
+			typedef value_type& reference;
+			typedef const value_type& const_reference;
+			typedef std::size_t size_type;
+			typedef std::ptrdiff_t difference_type;
+
+		public: // Convert an SlabAllocPolicy<T> to SlabAllocPolicy<U>
+			template<typename U>
+			struct rebind
+			{
+				typedef SlabAllocPolicy<U, Alignment> other;
+			};
+
+		public:
+			inline explicit SlabAllocPolicy(std::shared_ptr<PropertySlab> slab) : _slab(std::move(slab)) {}
+			inline ~SlabAllocPolicy() {}
+			inline explicit SlabAllocPolicy(SlabAllocPolicy const& rhs) : _slab(rhs._slab) {}
+			template <typename U>
+			inline explicit SlabAllocPolicy(SlabAllocPolicy<U, Alignment> const& rhs) : _slab(rhs.slab()) {}
+
+		public: // Memory allocation
+			inline pointer allocate(size_type cnt, typename std::allocator<void>::const_pointer = 0)
+			{
+				return reinterpret_cast<pointer>(_mm_malloc(cnt * sizeof(T), Alignment));
+			}
+			inline void deallocate(pointer p, size_type)
+			{
+				if (p && !(_slab && _slab->owns(p)))
+					_mm_free(p);
+			}
+
+		public: // Size
+			inline size_type max_size() const
+			{
+				return std::numeric_limits<size_type>::max();
+			}
+
+		public:
+			inline const std::shared_ptr<PropertySlab>& slab() const { return _slab; }
+
+		private:
+			//! Slab providing the memory of the property
+			std::shared_ptr<PropertySlab> _slab;
+		};
 	}
 
 	template<typename T, typename IndexT>
@@ -108,6 +314,7 @@ namespace Vcl { namespace Geometry
 		typedef value_type&			reference;
 		typedef value_type&&		rvalue_reference;
 		typedef const value_type&	const_reference;
+		typedef const value_type*	const_pointer;
 		typedef IndexT				index_type;
 
 	public:
@@ -118,7 +325,7 @@ namespace Vcl { namespace Geometry
 		, _defaultValue(init_value)
 		, _allocPolicy(nullptr)
 		{
-			_allocPolicy = std::make_unique<Core::AlignedAllocPolicy<value_type, 32>>();
+			_allocPolicy = Core::makePolymorphicAllocPolicy<value_type>(Core::AlignedAllocPolicy<value_type, 32>());
 			
 			Require(size() <= _allocated, "Used size is smaller/equal to allocated size.");
 		}
@@ -126,12 +333,14 @@ namespace Vcl { namespace Geometry
 		//! Copy constructor
 		Property(const Property& rhs)
 		: PropertyBase(rhs)
+		, _defaultValue(rhs._defaultValue)
+		, _allocationTag(rhs._allocationTag)
 		{
 			_allocPolicy = rhs._allocPolicy->clone();
-			_data = _allocPolicy->allocate(rhs.size());
+			_data = rhs.size() > 0 ? _allocPolicy->allocate(rhs.size()) : nullptr;
+			_allocated = rhs.size();
 
-			for (size_t i = 0; i < size(); i++)
-				_data[i] = rhs._data[i];
+			copyElements(_data, rhs._data, size(), BitwiseMovable());
 			
 			Require(size() <= _allocated, "Used size is smaller/equal to allocated size.");
 		}
@@ -146,6 +355,7 @@ namespace Vcl { namespace Geometry
 			std::swap(_allocPolicy, rhs._allocPolicy);
 			std::swap(_data, rhs._data);
 			std::swap(_defaultValue, rhs._defaultValue);
+			std::swap(_allocationTag, rhs._allocationTag);
 
 			Ensure(size() <= _allocated, "Used size is smaller/equal to allocated size.");
 		}
@@ -165,24 +375,15 @@ namespace Vcl { namespace Geometry
 		//! Create a deep copy of the property
 		virtual std::unique_ptr<PropertyBase> clone() const override
 		{
-			auto prop = std::make_unique<Property<T, index_type>>(name());
-
-			prop->_allocPolicy = std::make_unique<Core::AlignedAllocPolicy<value_type, 32>>(*_allocPolicy);
-			prop->_data = prop->_allocPolicy->allocate(size());
-			prop->_allocated = size();
-			prop->setSize(size());
-			
-			for (size_t i = 0; i < size(); i++)
-				prop->_data[i] = _data[i];
-
-			return std::move(prop);
+			return std::make_unique<Property<T, index_type>>(*this);
 		}
 		
 		virtual std::unique_ptr<PropertyBase> create() const override
 		{
 			auto prop = std::make_unique<Property<T, index_type>>(name());
 
-			prop->_allocPolicy = std::make_unique<Core::AlignedAllocPolicy<value_type, 32>>(*_allocPolicy);
+			prop->_allocPolicy = _allocPolicy->clone();
+			prop->_allocationTag = _allocationTag;
 
 			return std::move(prop);
 		}
@@ -199,24 +400,33 @@ namespace Vcl { namespace Geometry
 				_data[i] = v;
 		}
 
+		/*!
+		 *	\brief Exchange the policy used to allocate the memory of the property
+		 *
+		 *	The content is moved to memory allocated by the new policy. Policies
+		 *	referring to a memory resource, such as Core::ArenaAllocPolicy, require
+		 *	the resource to outlive the property. Tracked properties keep being
+		 *	tracked.
+		 */
 		template<typename AllocPolicyT>
-		void setAllocator(AllocPolicyT& alloc_policy)
+		void setAllocator(const AllocPolicyT& alloc_policy)
 		{
-			std::unique_ptr<Core::AlignedAllocPolicy<value_type, 32>> old_alloc_policy = std::move(_allocPolicy);
-			_allocPolicy = std::make_unique<Core::AlignedAllocPolicy<value_type, 32>>(alloc_policy);
+			std::unique_ptr<Core::PolymorphicAllocPolicy<value_type>> old_alloc_policy = std::move(_allocPolicy);
+			_allocPolicy = track(Core::makePolymorphicAllocPolicy<value_type>(alloc_policy), 0);
 
+			// Create a new buffer and move the data
+			pointer data = nullptr;
 			if (size() > 0)
 			{
-				// Create a new buffer and copy the data
-				pointer data = _allocPolicy->allocate(size());
-				for (size_t i = 0; i < size(); i++)
-					new (data + i) value_type(std::move(_data[i]));
+				data = _allocPolicy->allocate(size());
+				moveElements(data, _data, size());
+			}
 
-				// Release the old buffer
+			// Release the old buffer
+			if (_data)
 				old_alloc_policy->deallocate(_data, _allocated);
-				_data = data;
-				_allocated = size();
-			}
+			_data = data;
+			_allocated = size();
 		}
 	
 	public:
@@ -309,34 +519,12 @@ namespace Vcl { namespace Geometry
 				return;
 			}
 
-			if (count <= _allocated)
-			{
-				// Initialise the additional data
-				for (size_t i = size(); i < count; i++)
-				{
-					//_data[i] = _defaultValue;
-					new (_data + i) value_type(_defaultValue);
-				}
-				
-				setSize(count);
-			}
-			else
-			{
-				// Create a new buffer and move the data
-				pointer data = _allocPolicy->allocate(count);
-				for (size_t i = 0; i < size(); i++)
-					new (data + i) value_type(std::move(_data[i]));
-				
-				// Initialise the additional data
-				for (size_t i = size(); i < count; i++)
-					new (data + i) value_type(_defaultValue);
-
-				// Release the old buffer
-				_allocPolicy->deallocate(_data, _allocated);
-				_data = data;
-				setSize(count);
-				_allocated = count;
-			}
+			if (count > _allocated)
+				reallocate(count);
+
+			// Initialise the additional data
+			std::uninitialized_fill_n(_data + size(), count - size(), _defaultValue);
+			setSize(count);
 		}
 		
 		// Reserve additional memory without resizing the property. 
@@ -346,18 +534,145 @@ namespace Vcl { namespace Geometry
 			Require(size() <= _allocated, "Used size is smaller/equal to allocated size.");
 
 			if (count > _allocated)
-			{
-				// Create a new buffer and move the data
-				pointer data = _allocPolicy->allocate(count);
-				for (size_t i = 0; i < size(); i++)
-					new (data + i) value_type(std::move(_data[i]));
+				reallocate(count);
+		}
+
+		virtual void trackAllocations(const std::string& tag) override
+		{
+			Require(_allocationTag.empty(), "Allocations are not tracked yet.");
+
+			// The current buffer is released through the tracking policy as well
+			_allocationTag = tag;
+			_allocPolicy = track(std::move(_allocPolicy), _data ? _allocated : 0);
+		}
+
+		virtual const std::string& allocationTag() const override { return _allocationTag; }
+
+	public: // Raw storage access
+		virtual size_t elementSize() const override
+		{
+			return sizeof(value_type);
+		}
+
+		virtual bool isBitwiseSerialisable() const override
+		{
+			return isBitwiseMovable();
+		}
+
+		virtual std::string elementType() const override
+		{
+			return Internal::ElementType<value_type>::name();
+		}
+
+		virtual const void* rawData() const override
+		{
+			return _data;
+		}
+
+		virtual void adopt(std::shared_ptr<const Core::MappedFile> file, size_t offset, size_t count) override
+		{
+			Require(isBitwiseSerialisable(), "Elements can be restored from plain memory.");
+			Require(file && offset + count*sizeof(value_type) <= file->size(), "Storage lies within the file.");
+			Require(reinterpret_cast<size_t>(file->data() + offset) % alignof(value_type) == 0, "Storage is aligned.");
+
+			// Release the current storage
+			clear();
+			if (_data)
+				_allocPolicy->deallocate(_data, _allocated);
+
+			_allocPolicy = track(Core::makePolymorphicAllocPolicy<value_type>(Core::MappedFileAllocPolicy<value_type>(file)), count);
+			_data = reinterpret_cast<pointer>(file->data() + offset);
+			_allocated = count;
+			setSize(count);
+		}
+
+		virtual void relocate(std::shared_ptr<PropertySlab> slab, size_t offset, size_t capacity) override
+		{
+			Require(slab && offset + capacity*sizeof(value_type) <= slab->size(), "Region lies within the slab.");
+			Require(reinterpret_cast<size_t>(slab->data() + offset) % alignof(value_type) == 0, "Region is aligned.");
+			Require(size() <= capacity, "Region holds all elements.");
+
+			pointer data = reinterpret_cast<pointer>(slab->data() + offset);
+			moveElements(data, _data, size());
 
-				// Release the old buffer
+			// Release the old buffer
+			if (_data)
 				_allocPolicy->deallocate(_data, _allocated);
-				_data = data;
-				_allocated = count;
+
+			_allocPolicy = track(Core::makePolymorphicAllocPolicy<value_type>(Internal::SlabAllocPolicy<value_type>(std::move(slab))), capacity);
+			_data = data;
+			_allocated = capacity;
+		}
+
+	private:
+		/*!
+		 *	\brief Wrap a policy into a tracking policy if allocations are tracked
+		 *	\param policy Policy providing the memory
+		 *	\param adopted Number of elements of a buffer already provided by 'policy',
+		 *	       which is released through the tracking policy later on
+		 */
+		std::unique_ptr<Core::PolymorphicAllocPolicy<value_type>> track(std::unique_ptr<Core::PolymorphicAllocPolicy<value_type>> policy, size_t adopted) const
+		{
+			if (_allocationTag.empty())
+				return policy;
+
+			auto& statistics = Core::AllocationTracker::instance().statistics(_allocationTag);
+			if (adopted > 0)
+				statistics.recordAllocation(adopted * sizeof(value_type));
+
+			return std::make_unique<Core::TrackingPolymorphicAllocPolicy<value_type>>(std::move(policy), statistics);
+		}
+
+		using BitwiseMovable = std::integral_constant<bool, Internal::IsBitwiseMovable<value_type>::value>;
+
+		static VCL_CONSTEXPR_CPP11 bool isBitwiseMovable()
+		{
+			return BitwiseMovable::value;
+		}
+
+		//! Copy 'count' elements to uninitialised memory
+		static void copyElements(pointer dst, const_pointer src, size_t count, std::true_type)
+		{
+			if (count > 0)
+				memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(value_type));
+		}
+		static void copyElements(pointer dst, const_pointer src, size_t count, std::false_type)
+		{
+			for (size_t i = 0; i < count; i++)
+				new (dst + i) value_type(src[i]);
+		}
+
+		//! Move 'count' elements to uninitialised memory and destroy the sources
+		static void moveElements(pointer dst, pointer src, size_t count, std::true_type)
+		{
+			if (count > 0)
+				memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(value_type));
+		}
+		static void moveElements(pointer dst, pointer src, size_t count, std::false_type)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				new (dst + i) value_type(std::move(src[i]));
+				src[i].~value_type();
 			}
 		}
+		static void moveElements(pointer dst, pointer src, size_t count)
+		{
+			moveElements(dst, src, count, BitwiseMovable());
+		}
+
+		//! Move the elements to a new buffer holding 'capacity' elements
+		void reallocate(size_t capacity)
+		{
+			pointer data = _allocPolicy->allocate(capacity);
+			moveElements(data, _data, size());
+
+			// Release the old buffer
+			if (_data)
+				_allocPolicy->deallocate(_data, _allocated);
+			_data = data;
+			_allocated = capacity;
+		}
 
 	private:
 		pointer _data;
@@ -367,7 +682,10 @@ namespace Vcl { namespace Geometry
 		value_type _defaultValue;
 
 	private:
-		std::unique_ptr<Core::AlignedAllocPolicy<value_type, 32>> _allocPolicy;
+		std::unique_ptr<Core::PolymorphicAllocPolicy<value_type>> _allocPolicy;
+
+		//! Tag under which allocations are tracked
+		std::string _allocationTag;
 	};
 	
 	template<typename ValueT, typename IndexT>
@@ -445,8 +763,8 @@ namespace Vcl { namespace Geometry
 		ConstPropertyPtr() : _property(nullptr) {}
 		ConstPropertyPtr(const PropertyPtr<value_type, index_type>& other) { _property = other.ptr(); }
 		ConstPropertyPtr(const ConstPropertyPtr<value_type, index_type>& other) { _property = other.ptr(); }
-		ConstPropertyPtr(const PropertyPtr<value_type, index_type>&& other) { _property = other.ptr(); other._property = nullptr; }
-		ConstPropertyPtr(const ConstPropertyPtr<value_type, index_type>&& other) { _property = other.ptr(); other._property = nullptr; }
+		ConstPropertyPtr(PropertyPtr<value_type, index_type>&& other) { _property = other.ptr(); other = nullptr; }
+		ConstPropertyPtr(ConstPropertyPtr<value_type, index_type>&& other) { _property = other._property; other._property = nullptr; }
 		ConstPropertyPtr(Property<value_type, index_type>* p) : _property(p) {}
 		ConstPropertyPtr(const Property<value_type, index_type>* p) : _property(p) {}
 
@@ -457,6 +775,8 @@ namespace Vcl { namespace Geometry
 	public:
 		operator const Property<value_type, index_type>* () const { return _property; }
 
+		const Property<value_type, index_type>* ptr() const { return _property; }
+
 	public:
 		typename Property<value_type, index_type>::const_reference operator[](int idx) const
 		{
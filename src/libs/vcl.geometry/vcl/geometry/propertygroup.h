@@ -28,21 +28,99 @@
 #include <vcl/config/global.h>
 
 // C++ standard libary
+#include <algorithm>
+#include <iterator>
 #include <memory>
-#include <unordered_map>
+#include <string>
+#include <vector>
 
 // VCL
+#include <vcl/core/contract.h>
 #include <vcl/geometry/property.h>
+#include <vcl/util/hashedstring.h>
 
 namespace Vcl { namespace Geometry
 {
 	template<typename IndexT>
-	class PropertyGroup
+	class PropertyGroup;
+
+	/*!
+	 *	\brief Typed reference to a property of a property group
+	 *
+	 *	A handle is resolved once by name and gives access to the property
+	 *	without any string operations. It stays valid until the property is
+	 *	removed and is valid for copies of the group it was obtained from.
+	 */
+	template<typename T, typename IndexT>
+	class PropertyHandle
 	{
 	public:
-		using map_type   = std::unordered_map<std::string, std::unique_ptr<PropertyBase>>;
+		using value_type = T;
 		using index_type = IndexT;
 
+	public:
+		PropertyHandle() = default;
+
+		bool isValid() const { return _slot != InvalidSlot; }
+
+	private:
+		friend class PropertyGroup<IndexT>;
+
+		static const uint32_t InvalidSlot = 0xffffffff;
+
+		explicit PropertyHandle(uint32_t slot) : _slot(slot) {}
+
+		//! Storage slot of the property
+		uint32_t _slot{ InvalidSlot };
+	};
+
+	template<typename IndexT>
+	class PropertyGroup
+	{
+	public:
+		using container_type = std::vector<std::unique_ptr<PropertyBase>>;
+		using index_type     = IndexT;
+
+		template<typename T>
+		using handle_type = PropertyHandle<T, IndexT>;
+
+		//! Iterates over the properties of a group
+		class const_iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = PropertyBase;
+			using difference_type = ptrdiff_t;
+			using pointer = const PropertyBase*;
+			using reference = const PropertyBase&;
+
+		public:
+			const_iterator(typename container_type::const_iterator curr, typename container_type::const_iterator end)
+			: _curr(curr), _end(end)
+			{
+				skipEmpty();
+			}
+
+			reference operator* () const { return **_curr; }
+			pointer operator-> () const { return _curr->get(); }
+
+			const_iterator& operator++ () { ++_curr; skipEmpty(); return *this; }
+			const_iterator operator++ (int) { auto tmp = *this; ++*this; return tmp; }
+
+			bool operator== (const const_iterator& other) const { return _curr == other._curr; }
+			bool operator!= (const const_iterator& other) const { return _curr != other._curr; }
+
+		private:
+			void skipEmpty()
+			{
+				while (_curr != _end && !*_curr)
+					++_curr;
+			}
+
+			typename container_type::const_iterator _curr;
+			typename container_type::const_iterator _end;
+		};
+
 	public:
 		PropertyGroup(const std::string& name)
 		: _name(name)
@@ -52,14 +130,15 @@ namespace Vcl { namespace Geometry
 		}
 		
 		PropertyGroup(const PropertyGroup<IndexT>& other)
-		: _name(other._name)
+		: _index(other._index)
+		, _nrProperties(other._nrProperties)
+		, _name(other._name)
+		, _allocationTag(other._allocationTag)
 		, _propertySize(other._propertySize)
-		, _propertyAllocation(other._propertyAllocation)
+		, _propertyAllocation(other._propertySize)
+		, _slabAllocation(other._slabAllocation)
 		{
-			for (const auto& entry : other._data)
-			{
-				_data[entry.first] = entry.second->clone();
-			}
+			cloneProperties(other);
 		}
 
 		~PropertyGroup()
@@ -72,167 +151,415 @@ namespace Vcl { namespace Geometry
 			if (this != &other) // Protect against invalid self-assignment
 			{
 				_name = other._name;
+				_allocationTag = other._allocationTag;
 				_propertySize = other._propertySize;
-	 
-				for (const auto& entry : other._data)
-				{
-					_data[entry.first] = entry.second->clone();
-				}
+				_propertyAllocation = other._propertySize;
+				_slabAllocation = other._slabAllocation;
+
+				cloneProperties(other);
+
+				_index = other._index;
+				_nrProperties = other._nrProperties;
 			}
 
 			// By convention, always return *this
 			return *this;
 		}
 
+	public:
+		const std::string& name() const
+		{
+			return _name;
+		}
+
+		const_iterator begin() const
+		{
+			return{ _data.cbegin(), _data.cend() };
+		}
+
+		const_iterator end() const
+		{
+			return{ _data.cend(), _data.cend() };
+		}
+
+		//! Number of properties in the group
+		size_t size() const
+		{
+			return _nrProperties;
+		}
+
 	public:
 		void clear()
 		{
-			for (const auto& entry : _data)
+			for (const auto& prop : _data)
 			{
-				entry.second->clear();
+				if (prop)
+					prop->clear();
 			}
+
+			_propertySize = 0;
 		}
 
 		void removeAll()
 		{
 			_data.clear();
+			_index.clear();
+			_nrProperties = 0;
 		}
 
 	public:
 		template<typename T>
-		Property<T, index_type>* add(const std::string& name, typename Property<T, index_type>::rvalue_reference init_value = typename Property<T, index_type>::value_type())
-		{		
-			if (_data.find(name) == _data.end())
-			{
-				auto data = std::make_unique<Property<T, index_type>>(name, std::forward<typename Property<T, index_type>::value_type>(init_value));
-
-				data->resize(_propertySize);
-				_data.emplace(name, std::move(data));
-			}
+		Property<T, index_type>* add(Util::HashedString name, typename Property<T, index_type>::rvalue_reference init_value = typename Property<T, index_type>::value_type())
+		{
+			const uint32_t slot = find(name);
+			if (slot != EmptySlot)
+				return static_cast<Property<T, index_type>*>(_data[slot].get());
 
-			return static_cast<Property<T, index_type>*>(_data[name].get());
+			auto data = std::make_unique<Property<T, index_type>>(name.str(), std::forward<typename Property<T, index_type>::value_type>(init_value));
+			return static_cast<Property<T, index_type>*>(insert(name.hash(), std::move(data)));
 		}
 
 		template<typename T>
-		Property<T, index_type>* add(const std::string& name, typename Property<T, index_type>::reference init_value)
+		Property<T, index_type>* add(Util::HashedString name, typename Property<T, index_type>::reference init_value)
 		{
-			if (_data.find(name) == _data.end())
-			{
-				auto data = std::make_unique<Property<T, index_type>>(name, init_value);
-
-				data->resize(_propertySize);
-				_data.emplace(name, std::move(data));
-			}
+			const uint32_t slot = find(name);
+			if (slot != EmptySlot)
+				return static_cast<Property<T, index_type>*>(_data[slot].get());
 
-			return static_cast<Property<T, index_type>*>(_data[name].get());
+			auto data = std::make_unique<Property<T, index_type>>(name.str(), init_value);
+			return static_cast<Property<T, index_type>*>(insert(name.hash(), std::move(data)));
 		}
 
 		void add(std::unique_ptr<PropertyBase> prop)
 		{
-			Require(_data.find(prop->name()) == _data.end(), "Property must not exist.");
+			const Util::HashedString name{ prop->name() };
+			const uint32_t slot = find(name);
+			Require(slot == EmptySlot, "Property must not exist.");
 
-			if (_data.find(prop->name()) == _data.end())
-			{
-				prop->resize(_propertySize);
-
-				const auto& name = prop->name();
-				_data.emplace(name, std::move(prop));
-			}
+			if (slot == EmptySlot)
+				insert(name.hash(), std::move(prop));
 		}
 
-		void remove(const std::string& name)
+		void remove(Util::HashedString name)
 		{
-			auto elem = _data.find(name);
-			if (elem != _data.end())
+			const uint32_t slot = find(name);
+			if (slot != EmptySlot)
 			{
-				elem->second->clear();
-				VCL_SAFE_DELETE(elem->second);
+				_data[slot]->clear();
+				_data[slot].reset();
+				_nrProperties--;
 
-				_data.erase(elem);
+				// The empty slot is reused by the next added property. Handles
+				// of other properties stay valid as their slots do not move.
+				rebuildIndex(_index.size());
 			}
 		}
 
 		template<typename T>
-		Property<T, index_type>* property(const std::string& name, bool create_if_not_found = false, typename Property<T, index_type>::rvalue_reference init_value = typename Property<T, index_type>::value_type())
+		Property<T, index_type>* property(Util::HashedString name, bool create_if_not_found = false, typename Property<T, index_type>::rvalue_reference init_value = typename Property<T, index_type>::value_type())
 		{
-			auto prop = _data.find(name);
-			if (prop != _data.end())
+			const uint32_t slot = find(name);
+			if (slot != EmptySlot)
 			{
-				return static_cast<Property<T, index_type>*>(prop->second.get());
+				return static_cast<Property<T, index_type>*>(_data[slot].get());
 			}
 			else if (create_if_not_found)
 			{
-				return add<T>(name, init_value);
+				return add<T>(name, std::forward<typename Property<T, index_type>::value_type>(init_value));
 			}
 
 			return nullptr;
 		}
 		
 		template<typename T>
-		const Property<T, index_type>* property(const std::string& name) const
+		const Property<T, index_type>* property(Util::HashedString name) const
 		{
-			auto prop = _data.find(name);
-			if (prop != _data.end())
+			const uint32_t slot = find(name);
+			if (slot != EmptySlot)
 			{
-				return static_cast<const Property<T, index_type>*>(prop->second);
+				return static_cast<const Property<T, index_type>*>(_data[slot].get());
 			}
 
 			return nullptr;
 		}
-		
-		const PropertyBase* propertyBase(const std::string& name) const
+
+		PropertyBase* propertyBase(Util::HashedString name)
 		{
-			auto prop = _data.find(name);
-			if (prop != _data.end())
-			{
-				return prop->second;
-			}
+			const uint32_t slot = find(name);
+			return slot != EmptySlot ? _data[slot].get() : nullptr;
+		}
 
-			return nullptr;
+		const PropertyBase* propertyBase(Util::HashedString name) const
+		{
+			const uint32_t slot = find(name);
+			return slot != EmptySlot ? _data[slot].get() : nullptr;
 		}
 
-		bool exists(const std::string& name)
+		bool exists(Util::HashedString name) const
 		{
-			auto prop = _data.find(name);
-			if (prop != _data.end())
-				return true;
-			else
-				return false;
+			return find(name) != EmptySlot;
 		}
 
+	public: // Access through handles
+		/*!
+		 *	\brief Resolve the handle of a property
+		 *	\returns an invalid handle if the group does not contain the property
+		 */
+		template<typename T>
+		handle_type<T> handle(Util::HashedString name) const
+		{
+			const uint32_t slot = find(name);
+			Check((slot == EmptySlot || dynamic_cast<const Property<T, index_type>*>(_data[slot].get())), "Property has the requested type.");
+
+			return slot != EmptySlot ? handle_type<T>{ slot } : handle_type<T>{};
+		}
+
+		template<typename T>
+		Property<T, index_type>* property(handle_type<T> h)
+		{
+			Require(h.isValid() && h._slot < _data.size() && _data[h._slot], "Handle refers to a property.");
+
+			return static_cast<Property<T, index_type>*>(_data[h._slot].get());
+		}
+
+		template<typename T>
+		const Property<T, index_type>* property(handle_type<T> h) const
+		{
+			Require(h.isValid() && h._slot < _data.size() && _data[h._slot], "Handle refers to a property.");
+
+			return static_cast<const Property<T, index_type>*>(_data[h._slot].get());
+		}
+
+	public:
 		size_t propertySize() const
 		{
 			return _propertySize;
 		}
 
+		/*!
+		 *	\brief Reserve storage for 'size' elements in all properties
+		 *
+		 *	With slab allocation enabled, growing the storage moves all
+		 *	properties into a single block of memory.
+		 */
 		void reserveProperties(size_t size)
 		{
-			for (const auto& entry : _data)
-				entry.second->reserve(size);
+			if (_slabAllocation && size > _propertyAllocation)
+			{
+				allocateSlab(size);
+			}
+			else
+			{
+				for (const auto& prop : _data)
+				{
+					if (prop)
+						prop->reserve(size);
+				}
+			}
 			
-			_propertyAllocation = size;
+			_propertyAllocation = std::max(_propertyAllocation, size);
 		}
 
 		void resizeProperties(size_t size)
 		{
-			for (const auto& entry : _data)
-				entry.second->resize(size);
+			// Grow the storage of all properties at once
+			if (size > _propertyAllocation)
+				reserveProperties(size);
+
+			for (const auto& prop : _data)
+			{
+				if (prop)
+					prop->resize(size);
+			}
 			
 			_propertySize = size;
-			_propertyAllocation = std::max(_propertyAllocation, _propertySize);
+		}
+
+		/*!
+		 *	\brief Append elements initialised to their default values to all properties
+		 *	\param count Number of elements to append
+		 *	\returns the index of the first appended element
+		 *
+		 *	The storage of all properties grows geometrically and together,
+		 *	such that appending in small batches reallocates rarely.
+		 */
+		size_t appendProperties(size_t count)
+		{
+			const size_t first = _propertySize;
+			const size_t required = first + count;
+			if (required > _propertyAllocation)
+				reserveProperties(std::max(required, _propertyAllocation + _propertyAllocation / 2));
+
+			resizeProperties(required);
+			return first;
+		}
+
+		//! Back all properties by a single block of memory when their storage grows
+		void setSlabAllocation(bool enable)
+		{
+			_slabAllocation = enable;
+		}
+
+		/*!
+		 *	\brief Record the memory allocated by the properties
+		 *
+		 *	Each property, including the ones added later, is tracked under
+		 *	the tag '<tag>.<property name>' (see Core::AllocationTracker).
+		 */
+		void trackAllocations(const std::string& tag)
+		{
+			Require(_allocationTag.empty(), "Allocations are not tracked yet.");
+
+			_allocationTag = tag;
+			for (const auto& prop : _data)
+			{
+				if (prop)
+					prop->trackAllocations(_allocationTag + "." + prop->name());
+			}
+		}
+
+	private:
+		//! Replace the properties by copies of the properties of 'other'
+		void cloneProperties(const PropertyGroup<IndexT>& other)
+		{
+			_data.clear();
+			_data.reserve(other._data.size());
+			for (const auto& prop : other._data)
+			{
+				_data.emplace_back(prop ? prop->clone() : nullptr);
+
+				// Copies are tracked the same way as added properties
+				if (_data.back() && !_allocationTag.empty() && _data.back()->allocationTag().empty())
+					_data.back()->trackAllocations(_allocationTag + "." + _data.back()->name());
+			}
+		}
+
+		//! Move all properties into a new slab holding 'capacity' elements each
+		void allocateSlab(size_t capacity)
+		{
+			const size_t alignment = PropertySlab::Alignment;
+
+			std::vector<size_t> offsets(_data.size(), 0);
+			size_t bytes = 0;
+			for (size_t slot = 0; slot < _data.size(); slot++)
+			{
+				if (!_data[slot])
+					continue;
+
+				offsets[slot] = bytes;
+				bytes += (_data[slot]->elementSize() * capacity + alignment - 1) / alignment * alignment;
+			}
+			if (bytes == 0)
+				return;
+
+			auto slab = std::make_shared<PropertySlab>(bytes);
+			for (size_t slot = 0; slot < _data.size(); slot++)
+			{
+				if (!_data[slot])
+					continue;
+
+				_data[slot]->relocate(slab, offsets[slot], capacity);
+			}
+		}
+
+		//! Entry of the open-addressing table mapping names to slots
+		struct IndexEntry
+		{
+			//! Hash of the property name
+			unsigned int hash;
+
+			//! Slot of the property in the storage
+			uint32_t slot;
+		};
+
+		//! Marks empty entries of the index
+		static const uint32_t EmptySlot = 0xffffffff;
+
+		uint32_t find(const Util::HashedString& name) const
+		{
+			if (_index.empty())
+				return EmptySlot;
+
+			// Linear probing; the table is at most half full
+			const size_t mask = _index.size() - 1;
+			for (size_t i = name.hash() & mask;; i = (i + 1) & mask)
+			{
+				const auto& entry = _index[i];
+				if (entry.slot == EmptySlot)
+					return EmptySlot;
+
+				if (entry.hash == name.hash() && name == _data[entry.slot]->name())
+					return entry.slot;
+			}
+		}
+
+		PropertyBase* insert(unsigned int hash, std::unique_ptr<PropertyBase> prop)
+		{
+			if (!_allocationTag.empty())
+				prop->trackAllocations(_allocationTag + "." + prop->name());
+
+			prop->resize(_propertySize);
+
+			// Reuse the slot of a removed property
+			auto empty = std::find(_data.begin(), _data.end(), nullptr);
+			const uint32_t slot = static_cast<uint32_t>(std::distance(_data.begin(), empty));
+			if (empty != _data.end())
+				*empty = std::move(prop);
+			else
+				_data.emplace_back(std::move(prop));
+			_nrProperties++;
+
+			if (2 * _nrProperties > _index.size())
+				rebuildIndex(std::max<size_t>(16, 2 * _index.size()));
+			else
+				insertIndex(hash, slot);
+
+			return _data[slot].get();
+		}
+
+		void insertIndex(unsigned int hash, uint32_t slot)
+		{
+			const size_t mask = _index.size() - 1;
+			size_t i = hash & mask;
+			while (_index[i].slot != EmptySlot)
+				i = (i + 1) & mask;
+
+			_index[i] = { hash, slot };
+		}
+
+		void rebuildIndex(size_t capacity)
+		{
+			_index.assign(capacity, { 0, EmptySlot });
+			for (uint32_t slot = 0; slot < _data.size(); slot++)
+			{
+				if (_data[slot])
+					insertIndex(Util::HashedString{ _data[slot]->name() }.hash(), slot);
+			}
 		}
 
 	private:
-		//! Data of the single properties
-		map_type _data;
+		//! Data of the single properties. Removed properties leave an empty slot until a property is added.
+		container_type _data;
+
+		//! Open-addressing table of the property names, sized to a power of two
+		std::vector<IndexEntry> _index;
+
+		//! Number of properties stored in the group
+		size_t _nrProperties{ 0 };
 
 		//! Name of the property group
 		std::string _name;
 
+		//! Tag under which allocations are tracked
+		std::string _allocationTag;
+
 		//! Size of the properties
 		size_t _propertySize;
 
 		//! Allocated storage for each property
 		size_t _propertyAllocation;
+
+		//! Back all properties by a single block of memory
+		bool _slabAllocation{ false };
 	};
 }}
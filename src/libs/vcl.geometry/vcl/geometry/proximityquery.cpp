@@ -0,0 +1,374 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/geometry/proximityquery.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <tuple>
+
+// VCL
+#include <vcl/core/simd/memory.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/contract.h>
+#include <vcl/geometry/distanceTriangle3Triangle3.h>
+#include <vcl/util/parallelfor.h>
+
+namespace Vcl { namespace Geometry
+{
+	namespace
+	{
+		// Widest vector type natively supported by the build
+#if defined(VCL_VECTORIZE_AVX512)
+		using packet_t = float16;
+#else
+		using packet_t = float8;
+#endif
+		const int PacketWidth = sizeof(packet_t) / sizeof(float);
+
+		using Triangles = std::vector<std::array<uint32_t, 3>>;
+
+		//! Pair of leaves of the hierarchies found by the broad phase
+		struct LeafPair
+		{
+			uint32_t first;
+			uint32_t count;
+			uint32_t otherFirst;
+			uint32_t otherCount;
+		};
+
+		bool closeBoxes(const Eigen::AlignedBox3f& a, const Eigen::AlignedBox3f& b, float margin)
+		{
+			return
+				(a.min().array() <= b.max().array() + margin).all() &&
+				(b.min().array() <= a.max().array() + margin).all();
+		}
+
+		bool shareVertex(const std::array<uint32_t, 3>& a, const std::array<uint32_t, 3>& b)
+		{
+			for (uint32_t v : a)
+			{
+				if (v == b[0] || v == b[1] || v == b[2])
+					return true;
+			}
+			return false;
+		}
+
+		//! Candidate triangle pairs, evaluated once a packet is full
+		class PairPacket
+		{
+		public:
+			PairPacket
+			(
+				gsl::span<const Eigen::Vector3f> vertices_a, const Triangles& triangles_a,
+				gsl::span<const Eigen::Vector3f> vertices_b, const Triangles& triangles_b,
+				float threshold, std::vector<ProximityPair>& pairs
+			)
+			: _verticesA(vertices_a)
+			, _trianglesA(triangles_a)
+			, _verticesB(vertices_b)
+			, _trianglesB(triangles_b)
+			, _threshold(threshold)
+			, _pairs(pairs)
+			{
+			}
+
+			void add(uint32_t a, uint32_t b)
+			{
+				_first[_size] = a;
+				_second[_size] = b;
+				if (++_size == PacketWidth)
+					flush();
+			}
+
+			void flush()
+			{
+				if (_size == 0)
+					return;
+
+				// Unused lanes repeat the last pair
+				Triangle<packet_t, 3> tri_a = gather(_verticesA, _trianglesA, _first);
+				Triangle<packet_t, 3> tri_b = gather(_verticesB, _trianglesB, _second);
+
+				// The kernel computes squared distances
+				Eigen::Matrix<packet_t, 3, 1> point_a, point_b;
+				const packet_t sq_dist = distance(tri_a, tri_b, point_a, point_b);
+				for (int l = 0; l < _size; l++)
+				{
+					if (sq_dist[l] > _threshold * _threshold)
+						continue;
+
+					ProximityPair pair;
+					pair.first = _first[l];
+					pair.second = _second[l];
+					pair.distance = std::sqrt(sq_dist[l]);
+					pair.firstPoint = { point_a.x()[l], point_a.y()[l], point_a.z()[l] };
+					pair.secondPoint = { point_b.x()[l], point_b.y()[l], point_b.z()[l] };
+					_pairs.push_back(pair);
+				}
+
+				_size = 0;
+			}
+
+		private:
+			Triangle<packet_t, 3> gather(gsl::span<const Eigen::Vector3f> vertices, const Triangles& triangles, const uint32_t* ids) const
+			{
+				float coords[9][PacketWidth];
+				for (int l = 0; l < PacketWidth; l++)
+				{
+					const auto& tri = triangles[ids[std::min(l, _size - 1)]];
+					for (int v = 0; v < 3; v++)
+					{
+						const Eigen::Vector3f& x = vertices[tri[v]];
+						coords[3 * v + 0][l] = x.x();
+						coords[3 * v + 1][l] = x.y();
+						coords[3 * v + 2][l] = x.z();
+					}
+				}
+
+				Eigen::Matrix<packet_t, 3, 1> x[3];
+				for (int v = 0; v < 3; v++)
+				{
+					load(x[v].x(), coords[3 * v + 0]);
+					load(x[v].y(), coords[3 * v + 1]);
+					load(x[v].z(), coords[3 * v + 2]);
+				}
+				return{ x[0], x[1], x[2] };
+			}
+
+			gsl::span<const Eigen::Vector3f> _verticesA;
+			const Triangles& _trianglesA;
+			gsl::span<const Eigen::Vector3f> _verticesB;
+			const Triangles& _trianglesB;
+			const float _threshold;
+			std::vector<ProximityPair>& _pairs;
+
+			uint32_t _first[PacketWidth];
+			uint32_t _second[PacketWidth];
+			int _size{ 0 };
+		};
+
+		/*!
+		 *	Evaluate the triangle pairs of all leaf pairs in parallel. Pairs of
+		 *	a leaf with itself are only tested once for self-proximity queries.
+		 *	'test' decides per pair of triangles whether it is a candidate and
+		 *	may swap the order in which it is reported.
+		 */
+		template<typename Func>
+		std::vector<ProximityPair> narrowPhase
+		(
+			const ProximitySurface& a, const ProximitySurface& b,
+			const std::vector<LeafPair>& leaf_pairs, bool self, float threshold, Func&& test
+		)
+		{
+			const auto vertices_a = a.vertices();
+			const auto vertices_b = b.vertices();
+			const auto& indices_a = a.hierarchy().indices();
+			const auto& indices_b = b.hierarchy().indices();
+
+			std::vector<ProximityPair> pairs;
+			std::mutex pairs_mutex;
+			Util::parallelForChunks(leaf_pairs.size(), 64, [&](size_t first, size_t last)
+			{
+				std::vector<ProximityPair> local_pairs;
+				PairPacket packet{ vertices_a, a.triangles(), vertices_b, b.triangles(), threshold, local_pairs };
+
+				for (size_t p = first; p < last; p++)
+				{
+					const LeafPair& leaves = leaf_pairs[p];
+					const bool same_leaf = self && leaves.first == leaves.otherFirst;
+					for (uint32_t i = leaves.first; i < leaves.first + leaves.count; i++)
+					{
+						const uint32_t begin = same_leaf ? i + 1 : leaves.otherFirst;
+						for (uint32_t j = begin; j < leaves.otherFirst + leaves.otherCount; j++)
+						{
+							uint32_t tri_a = indices_a[i];
+							uint32_t tri_b = indices_b[j];
+							if (test(tri_a, tri_b) && closeBoxes(a.bounds()[tri_a], b.bounds()[tri_b], threshold))
+								packet.add(tri_a, tri_b);
+						}
+					}
+				}
+				packet.flush();
+
+				std::lock_guard<std::mutex> guard{ pairs_mutex };
+				pairs.insert(pairs.end(), local_pairs.begin(), local_pairs.end());
+			});
+
+			// The order of the pairs found by the threads is arbitrary
+			std::sort(pairs.begin(), pairs.end(), [](const ProximityPair& x, const ProximityPair& y)
+			{
+				return std::tie(x.first, x.second) < std::tie(y.first, y.second);
+			});
+
+			return pairs;
+		}
+
+		template<typename MeshT>
+		gsl::span<const Eigen::Vector3f> meshVertices(const MeshT& mesh)
+		{
+			return{ mesh.vertices()->data(), static_cast<ptrdiff_t>(mesh.nrVertices()) };
+		}
+	}
+
+	ProximitySurface::ProximitySurface(const TriMesh& mesh, BvhBuilder builder)
+	: _builder(builder)
+	{
+		_vertices = [&mesh]() { return meshVertices(mesh); };
+
+		_triangles.reserve(mesh.nrFaces());
+		_elements.reserve(mesh.nrFaces());
+		for (unsigned int f = 0; f < mesh.nrFaces(); f++)
+		{
+			const auto& face = mesh.faces()[f];
+			_triangles.push_back({ face[0].id(), face[1].id(), face[2].id() });
+			_elements.push_back(f);
+		}
+
+		rebuild();
+	}
+
+	ProximitySurface::ProximitySurface(const TetraMesh& mesh, BvhBuilder builder)
+	: _builder(builder)
+	{
+		_vertices = [&mesh]() { return meshVertices(mesh); };
+		const auto vertices = meshVertices(mesh);
+
+		// Collect the faces of all volumes, identified by their sorted vertex indices
+		struct VolumeFace
+		{
+			std::array<uint32_t, 3> key;
+			std::array<uint32_t, 3> triangle;
+			uint32_t volume;
+		};
+		std::vector<VolumeFace> faces;
+		faces.reserve(4 * mesh.nrVolumes());
+		for (unsigned int t = 0; t < mesh.nrVolumes(); t++)
+		{
+			const auto& volume = mesh.volumes()[t];
+			for (int i = 0; i < 4; i++)
+			{
+				// Face opposite of vertex i, oriented outwards
+				std::array<uint32_t, 3> tri = { volume[(i + 1) % 4].id(), volume[(i + 2) % 4].id(), volume[(i + 3) % 4].id() };
+				const Eigen::Vector3f& x0 = vertices[tri[0]];
+				const Eigen::Vector3f n = (vertices[tri[1]] - x0).cross(vertices[tri[2]] - x0);
+				if (n.dot(vertices[volume[i].id()] - x0) > 0)
+					std::swap(tri[1], tri[2]);
+
+				std::array<uint32_t, 3> key = tri;
+				std::sort(key.begin(), key.end());
+				faces.push_back({ key, tri, t });
+			}
+		}
+		std::sort(faces.begin(), faces.end(), [](const VolumeFace& x, const VolumeFace& y)
+		{
+			return std::tie(x.key, x.volume) < std::tie(y.key, y.volume);
+		});
+
+		// Faces occuring only once lie on the surface
+		for (size_t f = 0; f < faces.size();)
+		{
+			size_t next = f + 1;
+			while (next < faces.size() && faces[next].key == faces[f].key)
+				next++;
+
+			if (next == f + 1)
+			{
+				_triangles.push_back(faces[f].triangle);
+				_elements.push_back(faces[f].volume);
+			}
+			f = next;
+		}
+
+		rebuild();
+	}
+
+	void ProximitySurface::computeBounds()
+	{
+		const auto vertices = _vertices();
+
+		_bounds.resize(_triangles.size());
+		const ptrdiff_t nr_triangles = static_cast<ptrdiff_t>(_triangles.size());
+		Util::parallelFor(nr_triangles, 4096, [&](ptrdiff_t t)
+		{
+			Eigen::AlignedBox3f box;
+			for (uint32_t v : _triangles[t])
+				box.extend(vertices[v]);
+			_bounds[t] = box;
+		});
+	}
+
+	void ProximitySurface::refit()
+	{
+		computeBounds();
+		_bvh.refit(_bounds);
+	}
+
+	void ProximitySurface::rebuild()
+	{
+		computeBounds();
+		_bvh.build(_bounds, _builder);
+	}
+
+	std::vector<ProximityPair> findProximityPairs(const ProximitySurface& a, const ProximitySurface& b, float threshold)
+	{
+		Require(threshold >= 0, "Threshold is not negative.");
+
+		std::vector<LeafPair> leaf_pairs;
+		a.hierarchy().overlapping(b.hierarchy(), threshold, [&leaf_pairs](uint32_t first, uint32_t count, uint32_t other_first, uint32_t other_count)
+		{
+			leaf_pairs.push_back({ first, count, other_first, other_count });
+		});
+
+		return narrowPhase(a, b, leaf_pairs, false, threshold, [](uint32_t&, uint32_t&)
+		{
+			return true;
+		});
+	}
+
+	std::vector<ProximityPair> findSelfProximityPairs(const ProximitySurface& surface, float threshold)
+	{
+		Require(threshold >= 0, "Threshold is not negative.");
+
+		std::vector<LeafPair> leaf_pairs;
+		surface.hierarchy().selfOverlapping(threshold, [&leaf_pairs](uint32_t first, uint32_t count, uint32_t other_first, uint32_t other_count)
+		{
+			leaf_pairs.push_back({ first, count, other_first, other_count });
+		});
+
+		const auto& triangles = surface.triangles();
+		return narrowPhase(surface, surface, leaf_pairs, true, threshold, [&triangles](uint32_t& tri_a, uint32_t& tri_b)
+		{
+			// Neighbouring triangles are always in contact
+			if (shareVertex(triangles[tri_a], triangles[tri_b]))
+				return false;
+
+			if (tri_a > tri_b)
+				std::swap(tri_a, tri_b);
+			return true;
+		});
+	}
+}}
@@ -0,0 +1,152 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// GSL
+#include <gsl/span>
+
+// VCL
+#include <vcl/geometry/bvh.h>
+#include <vcl/geometry/tetramesh.h>
+#include <vcl/geometry/trimesh.h>
+
+namespace Vcl { namespace Geometry
+{
+	/*!
+	 *	\brief Pair of triangles lying close to each other
+	 */
+	struct ProximityPair
+	{
+		//! Triangle of the first surface
+		uint32_t first;
+
+		//! Triangle of the second surface
+		uint32_t second;
+
+		//! Distance between the two triangles, zero if they intersect
+		float distance;
+
+		//! Closest point on the first triangle. Only meaningful if the triangles do not intersect.
+		Eigen::Vector3f firstPoint;
+
+		//! Closest point on the second triangle. Only meaningful if the triangles do not intersect.
+		Eigen::Vector3f secondPoint;
+	};
+
+	/*!
+	 *	\brief Triangulated surface of a mesh prepared for proximity queries
+	 *
+	 *	The surface of a TriMesh consists of its faces, the surface of a
+	 *	TetraMesh of the faces of its volumes not shared with another volume.
+	 *	The triangles reference the vertices of the mesh and are covered by a
+	 *	bounding volume hierarchy.
+	 *
+	 *	The mesh is referenced and has to outlive the surface.
+	 */
+	class ProximitySurface
+	{
+	public:
+		explicit ProximitySurface(const TriMesh& mesh, BvhBuilder builder = BvhBuilder::Morton);
+		explicit ProximitySurface(const TetraMesh& mesh, BvhBuilder builder = BvhBuilder::Morton);
+
+	public:
+		//! Update the hierarchy after the vertices of the mesh were moved
+		void refit();
+
+		//! Rebuild the hierarchy, e.g., after large deformations
+		void rebuild();
+
+	public:
+		size_t nrTriangles() const { return _triangles.size(); }
+
+		//! Vertex indices of the triangles
+		const std::vector<std::array<uint32_t, 3>>& triangles() const { return _triangles; }
+
+		//! Face or volume of the mesh each triangle originates from
+		const std::vector<uint32_t>& elements() const { return _elements; }
+
+		//! Bounding box of each triangle
+		const std::vector<Eigen::AlignedBox3f>& bounds() const { return _bounds; }
+
+		//! Current vertex positions of the mesh
+		gsl::span<const Eigen::Vector3f> vertices() const { return _vertices(); }
+
+		const Bvh<8>& hierarchy() const { return _bvh; }
+
+	private:
+		void computeBounds();
+
+		//! Access to the vertex positions of the referenced mesh
+		std::function<gsl::span<const Eigen::Vector3f>()> _vertices;
+
+		//! Vertex indices of the triangles
+		std::vector<std::array<uint32_t, 3>> _triangles;
+
+		//! Mesh element of each triangle
+		std::vector<uint32_t> _elements;
+
+		//! Bounding box of each triangle
+		std::vector<Eigen::AlignedBox3f> _bounds;
+
+		//! Algorithm used to build the hierarchy
+		BvhBuilder _builder;
+
+		//! Hierarchy over the triangles
+		Bvh<8> _bvh;
+	};
+
+	/*!
+	 *	\brief Find the pairs of triangles of two surfaces closer than a threshold
+	 *	\param a First surface
+	 *	\param b Second surface
+	 *	\param threshold Largest distance of reported pairs
+	 *	\returns the pairs sorted by their triangle indices
+	 *
+	 *	Candidate pairs are found by traversing both hierarchies
+	 *	simultaneously. Their distance is evaluated in packets with the
+	 *	SIMD triangle-triangle distance kernel, distributed across all threads.
+	 */
+	std::vector<ProximityPair> findProximityPairs(const ProximitySurface& a, const ProximitySurface& b, float threshold);
+
+	/*!
+	 *	\brief Find the pairs of triangles of a surface closer than a threshold
+	 *	\param surface Tested surface
+	 *	\param threshold Largest distance of reported pairs
+	 *	\returns the pairs sorted by their triangle indices, with first < second
+	 *
+	 *	Triangles sharing a vertex are not reported.
+	 */
+	std::vector<ProximityPair> findSelfProximityPairs(const ProximitySurface& surface, float threshold);
+}}
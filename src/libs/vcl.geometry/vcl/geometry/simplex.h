@@ -141,6 +141,18 @@ namespace Vcl { namespace Geometry
 		      VertexMetaData& metaData(VertexId id)       { return static_cast<      Derived*>(this)->access(_verticesMetaData, id); }
 			  
 		ConstPropertyPtr<Vertex, VertexId> vertices() const { return _vertices; }
+		PropertyPtr<Vertex, VertexId> vertices() { return _vertices; }
+
+		/*!
+		 *	\brief Append default initialised vertices
+		 *	\returns the id of the first appended element
+		 *
+		 *	All vertex properties grow together (see PropertyGroup::appendProperties).
+		 */
+		VertexId appendVertices(size_t count)
+		{
+			return VertexId(static_cast<typename VertexId::IdType>(_vertexData.appendProperties(count)));
+		}
 
 	protected:
 		const PropertyGroup<VertexId>& vertexProperties() const { return _vertexData; }
@@ -228,6 +240,17 @@ namespace Vcl { namespace Geometry
 			  
 		ConstPropertyPtr<Edge, EdgeId> edges() const { return _edges; }
 
+		/*!
+		 *	\brief Append default initialised edges
+		 *	\returns the id of the first appended element
+		 *
+		 *	All edge properties grow together (see PropertyGroup::appendProperties).
+		 */
+		EdgeId appendEdges(size_t count)
+		{
+			return EdgeId(static_cast<typename EdgeId::IdType>(_edgeData.appendProperties(count)));
+		}
+
 	protected:
 		const PropertyGroup<EdgeId>& edgeProperties() const { return _edgeData; }
 		      PropertyGroup<EdgeId>& edgeProperties()       { return _edgeData; }
@@ -298,6 +321,17 @@ namespace Vcl { namespace Geometry
 			  
 		ConstPropertyPtr<Face, FaceId> faces() const { return _faces; }
 
+		/*!
+		 *	\brief Append default initialised faces
+		 *	\returns the id of the first appended element
+		 *
+		 *	All face properties grow together (see PropertyGroup::appendProperties).
+		 */
+		FaceId appendFaces(size_t count)
+		{
+			return FaceId(static_cast<typename FaceId::IdType>(_faceData.appendProperties(count)));
+		}
+
 	protected:
 		const PropertyGroup<FaceId>& faceProperties() const { return _faceData; }
 		      PropertyGroup<FaceId>& faceProperties()       { return _faceData; }
@@ -368,6 +402,17 @@ namespace Vcl { namespace Geometry
 			  
 		ConstPropertyPtr<Volume, VolumeId> volumes() const { return _volumes; }
 
+		/*!
+		 *	\brief Append default initialised volumes
+		 *	\returns the id of the first appended element
+		 *
+		 *	All volume properties grow together (see PropertyGroup::appendProperties).
+		 */
+		VolumeId appendVolumes(size_t count)
+		{
+			return VolumeId(static_cast<typename VolumeId::IdType>(_volumeData.appendProperties(count)));
+		}
+
 	protected:
 		const PropertyGroup<VolumeId>& volumeProperties() const { return _volumeData; }
 		      PropertyGroup<VolumeId>& volumeProperties()       { return _volumeData; }
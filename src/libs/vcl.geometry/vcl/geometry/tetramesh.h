@@ -44,6 +44,8 @@
 
 namespace Vcl { namespace Geometry
 {
+	namespace IO { class BinaryMeshSerialiser; }
+
 	class TetraMesh;
 
 	template<>
@@ -80,6 +82,8 @@ namespace Vcl { namespace Geometry
 
 	class TetraMesh : public SimplexLevel3<TetraMesh>, public SimplexLevel0<TetraMesh>
 	{
+		friend class IO::BinaryMeshSerialiser;
+
 	public: // Default constructors
 		TetraMesh() = default;
 		TetraMesh(const TetraMesh& rhs) = default;
@@ -108,6 +112,25 @@ namespace Vcl { namespace Geometry
 			return volumeProperties().add<T>(name, init_value);
 		}
 
+		//! Resolve a property of the volume level for repeated access
+		template<typename T>
+		PropertyHandle<T, IndexDescriptionTrait<TetraMesh>::VolumeId> volumePropertyHandle(Util::HashedString name) const
+		{
+			return volumeProperties().template handle<T>(name);
+		}
+
+		//! Access a property of the volume level through its handle
+		template<typename T>
+		const Property<T, IndexDescriptionTrait<TetraMesh>::VolumeId>* volumeProperty(PropertyHandle<T, IndexDescriptionTrait<TetraMesh>::VolumeId> handle) const
+		{
+			return volumeProperties().property(handle);
+		}
+		template<typename T>
+		Property<T, IndexDescriptionTrait<TetraMesh>::VolumeId>* volumeProperty(PropertyHandle<T, IndexDescriptionTrait<TetraMesh>::VolumeId> handle)
+		{
+			return volumeProperties().property(handle);
+		}
+
 	private: // Embedders
 	};
 }}
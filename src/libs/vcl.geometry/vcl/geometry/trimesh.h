@@ -44,6 +44,8 @@
 
 namespace Vcl { namespace Geometry
 {
+	namespace IO { class BinaryMeshSerialiser; }
+
 	class TriMesh;
 
 	template<>
@@ -80,6 +82,8 @@ namespace Vcl { namespace Geometry
 
 	class TriMesh : public SimplexLevel2<TriMesh>, public SimplexLevel0<TriMesh>
 	{
+		friend class IO::BinaryMeshSerialiser;
+
 	public: // Default constructors
 		TriMesh() = default;
 		TriMesh(const TriMesh& rhs) = default;
@@ -107,5 +111,24 @@ namespace Vcl { namespace Geometry
 		{
 			return faceProperties().add<T>(name, init_value);
 		}
+
+		//! Resolve a property of the face level for repeated access
+		template<typename T>
+		PropertyHandle<T, IndexDescriptionTrait<TriMesh>::FaceId> facePropertyHandle(Util::HashedString name) const
+		{
+			return faceProperties().template handle<T>(name);
+		}
+
+		//! Access a property of the face level through its handle
+		template<typename T>
+		const Property<T, IndexDescriptionTrait<TriMesh>::FaceId>* faceProperty(PropertyHandle<T, IndexDescriptionTrait<TriMesh>::FaceId> handle) const
+		{
+			return faceProperties().property(handle);
+		}
+		template<typename T>
+		Property<T, IndexDescriptionTrait<TriMesh>::FaceId>* faceProperty(PropertyHandle<T, IndexDescriptionTrait<TriMesh>::FaceId> handle)
+		{
+			return faceProperties().property(handle);
+		}
 	};
 }}
@@ -0,0 +1,153 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/math/batch33.h>
+
+// VCL
+#include <vcl/core/simd/instructionset.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/contract.h>
+#include <vcl/math/batch33_kernels.h>
+#include <vcl/math/batch33_kernels_impl.h>
+#include <vcl/math/jacobisvd33_mcadams.h>
+
+namespace Vcl { namespace Mathematics
+{
+	namespace
+	{
+		using Detail::Batch33Kernels;
+		using Detail::Matrix33Array;
+
+		// Kernels built for the configured instruction set
+#ifdef VCL_VECTORIZE_SSE
+		using Baseline = Detail::Batch33<float4>;
+#else
+		using Baseline = Detail::Batch33<float>;
+#endif // VCL_VECTORIZE_SSE
+
+		/*!
+		 *	Select the widest kernel set implementing an operation
+		 *	which is supported by the processor.
+		 */
+		template<typename Kernel>
+		const Batch33Kernels* selectKernels(Kernel Batch33Kernels::* op)
+		{
+			const InstructionSet isa = activeInstructionSet();
+			if (isa >= InstructionSet::AVX512)
+			{
+				const auto* kernels = Detail::batch33KernelsAVX512();
+				if (kernels && kernels->*op)
+					return kernels;
+			}
+			if (isa >= InstructionSet::AVX)
+			{
+				const auto* kernels = Detail::batch33KernelsAVX();
+				if (kernels && kernels->*op)
+					return kernels;
+			}
+
+			return nullptr;
+		}
+	}
+
+	int McAdamsJacobiSVD(Matrix33Array& A, Matrix33Array& U, Matrix33Array& V, size_t count, unsigned int sweeps)
+	{
+		Require(A.size() >= count, "A is large enough.");
+		Require(U.size() >= count, "U is large enough.");
+		Require(V.size() >= count, "V is large enough.");
+
+		if (const auto* kernels = selectKernels(&Batch33Kernels::mcAdamsJacobiSVD))
+			return kernels->mcAdamsJacobiSVD(A, U, V, 0, count, sweeps);
+
+		return Baseline::forEachBlock(0, count, [&A, &U, &V, sweeps](size_t b, const Baseline::Mask& mask)
+		{
+			Baseline::Matrix a = Baseline::loadBlock(A, b, mask);
+			Baseline::Matrix u, v;
+			const int rotations = McAdamsJacobiSVD(a, u, v, sweeps);
+
+			Baseline::storeBlock(A, b, mask, a);
+			Baseline::storeBlock(U, b, mask, u);
+			Baseline::storeBlock(V, b, mask, v);
+			return rotations;
+		});
+	}
+
+	int QRJacobiSVD(Matrix33Array& A, Matrix33Array& U, Matrix33Array& V, size_t count)
+	{
+		Require(A.size() >= count, "A is large enough.");
+		Require(U.size() >= count, "U is large enough.");
+		Require(V.size() >= count, "V is large enough.");
+
+		if (const auto* kernels = selectKernels(&Batch33Kernels::qrJacobiSVD))
+			return kernels->qrJacobiSVD(A, U, V, 0, count);
+
+		return Baseline::qrJacobiSVD(A, U, V, 0, count);
+	}
+
+	int TwoSidedJacobiSVD(Matrix33Array& A, Matrix33Array& U, Matrix33Array& V, size_t count, bool warm_start)
+	{
+		Require(A.size() >= count, "A is large enough.");
+		Require(U.size() >= count, "U is large enough.");
+		Require(V.size() >= count, "V is large enough.");
+
+		if (const auto* kernels = selectKernels(&Batch33Kernels::twoSidedJacobiSVD))
+			return kernels->twoSidedJacobiSVD(A, U, V, 0, count, warm_start);
+
+		return Baseline::twoSidedJacobiSVD(A, U, V, 0, count, warm_start);
+	}
+
+	int SelfAdjointJacobiEigen(Matrix33Array& A, Matrix33Array& U, size_t count)
+	{
+		Require(A.size() >= count, "A is large enough.");
+		Require(U.size() >= count, "U is large enough.");
+
+		if (const auto* kernels = selectKernels(&Batch33Kernels::selfAdjointJacobiEigen))
+			return kernels->selfAdjointJacobiEigen(A, U, 0, count);
+
+		return Baseline::selfAdjointJacobiEigen(A, U, 0, count);
+	}
+
+	int Rotation(const Matrix33Array& A, Matrix33Array& R, size_t count)
+	{
+		Require(A.size() >= count, "A is large enough.");
+		Require(R.size() >= count, "R is large enough.");
+
+		if (const auto* kernels = selectKernels(&Batch33Kernels::rotation))
+			return kernels->rotation(A, R, 0, count);
+
+		return Baseline::rotation(A, R, 0, count);
+	}
+
+	void PolarDecomposition(Matrix33Array& A, Matrix33Array& R, Matrix33Array* S, size_t count)
+	{
+		Require(A.size() >= count, "A is large enough.");
+		Require(R.size() >= count, "R is large enough.");
+		Require(!S || S->size() >= count, "S is large enough.");
+
+		if (const auto* kernels = selectKernels(&Batch33Kernels::polarDecomposition))
+			kernels->polarDecomposition(A, R, S, 0, count);
+		else
+			Baseline::polarDecomposition(A, R, S, 0, count);
+	}
+}}
@@ -0,0 +1,101 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// VCL
+#include <vcl/core/interleavedarray.h>
+
+namespace Vcl { namespace Mathematics
+{
+	/*!
+	 *	\name Batch decompositions of 3x3 matrices
+	 *
+	 *	The functions process the first \a count matrices stored in the input
+	 *	array. The output arrays need to provide at least as many entries,
+	 *	entries past \a count are not modified. The widest SIMD kernel
+	 *	supported by the processor is selected at runtime (see
+	 *	Vcl::activeInstructionSet). Tails which do not fill an entire vector
+	 *	are processed by the same kernel with the unused lanes masked. The
+	 *	work is distributed among the available threads.
+	 *
+	 *	\returns the accumulated number of iterations reported by the
+	 *			 individual kernels.
+	 */
+	//! \{
+	int McAdamsJacobiSVD
+	(
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& A,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& U,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& V,
+		size_t count,
+		unsigned int sweeps = 4
+	);
+
+	int QRJacobiSVD
+	(
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& A,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& U,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& V,
+		size_t count
+	);
+
+	//! \note U and V contain the initial guess on input if \a warm_start is set
+	int TwoSidedJacobiSVD
+	(
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& A,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& U,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& V,
+		size_t count,
+		bool warm_start = false
+	);
+
+	int SelfAdjointJacobiEigen
+	(
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& A,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& U,
+		size_t count
+	);
+
+	//! \note R contains the initial guess of the rotations on input
+	int Rotation
+	(
+		const Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& A,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& R,
+		size_t count
+	);
+
+	void PolarDecomposition
+	(
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& A,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>& R,
+		Core::InterleavedArray<float, 3, 3, Core::DynamicStride>* S,
+		size_t count
+	);
+	//! \}
+}}
@@ -0,0 +1,67 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Vector types of this translation unit are built for AVX-512
+#define VCL_SIMD_ISA_NAMESPACE avx512
+
+#include <vcl/math/batch33_kernels.h>
+
+#ifdef VCL_VECTORIZE_AVX512
+
+// VCL
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/math/batch33_kernels_impl.h>
+
+namespace Vcl { namespace Mathematics { namespace Detail
+{
+	namespace
+	{
+		// The McAdams SVD is not implemented for AVX-512, the AVX kernel is used instead
+		const Batch33Kernels Kernels =
+		{
+			16,
+			nullptr,
+			&Batch33<float16>::qrJacobiSVD,
+			&Batch33<float16>::twoSidedJacobiSVD,
+			&Batch33<float16>::selfAdjointJacobiEigen,
+			&Batch33<float16>::rotation,
+			&Batch33<float16>::polarDecomposition
+		};
+	}
+
+	const Batch33Kernels* batch33KernelsAVX512()
+	{
+		return &Kernels;
+	}
+}}}
+#else
+namespace Vcl { namespace Mathematics { namespace Detail
+{
+	const Batch33Kernels* batch33KernelsAVX512()
+	{
+		return nullptr;
+	}
+}}}
+#endif // VCL_VECTORIZE_AVX512
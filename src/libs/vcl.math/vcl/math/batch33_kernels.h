@@ -0,0 +1,63 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// VCL
+#include <vcl/core/interleavedarray.h>
+
+namespace Vcl { namespace Mathematics { namespace Detail
+{
+	using Matrix33Array = Core::InterleavedArray<float, 3, 3, Core::DynamicStride>;
+
+	/*!
+	 *	\brief Batch kernels built for a single instruction set
+	 *
+	 *	Each kernel processes the matrices in [begin, end), where \a begin
+	 *	needs to be a multiple of \a width. A partially filled last block is
+	 *	processed with the inactive lanes masked, entries past \a end are not
+	 *	modified. Kernels which are not available for an instruction set are
+	 *	set to nullptr.
+	 */
+	struct Batch33Kernels
+	{
+		//! Number of matrices processed at once
+		size_t width;
+
+		int  (*mcAdamsJacobiSVD)(Matrix33Array& A, Matrix33Array& U, Matrix33Array& V, size_t begin, size_t end, unsigned int sweeps);
+		int  (*qrJacobiSVD)(Matrix33Array& A, Matrix33Array& U, Matrix33Array& V, size_t begin, size_t end);
+		int  (*twoSidedJacobiSVD)(Matrix33Array& A, Matrix33Array& U, Matrix33Array& V, size_t begin, size_t end, bool warm_start);
+		int  (*selfAdjointJacobiEigen)(Matrix33Array& A, Matrix33Array& U, size_t begin, size_t end);
+		int  (*rotation)(const Matrix33Array& A, Matrix33Array& R, size_t begin, size_t end);
+		void (*polarDecomposition)(Matrix33Array& A, Matrix33Array& R, Matrix33Array* S, size_t begin, size_t end);
+	};
+
+	//! \returns the kernels using the given instruction set, nullptr if they were not built
+	const Batch33Kernels* batch33KernelsAVX();
+	const Batch33Kernels* batch33KernelsAVX512();
+}}}
@@ -0,0 +1,192 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <utility>
+
+// VCL
+#include <vcl/core/simd/memory.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/contract.h>
+#include <vcl/math/batch33_kernels.h>
+#include <vcl/math/jacobieigen33_selfadjoint_impl.h>
+#include <vcl/math/jacobisvd33_twosided_impl.h>
+#include <vcl/math/polardecomposition_impl.h>
+#include <vcl/math/rotation33_torque_impl.h>
+
+namespace Vcl { namespace Mathematics { namespace Detail
+{
+	/*!
+	 *	Loops running the templated decompositions on blocks of \a Real::Width
+	 *	matrices. Shared by the translation units of the different instruction sets.
+	 */
+	template<typename Real>
+	struct Batch33
+	{
+		static const size_t Width = sizeof(Real) / sizeof(float);
+
+		using Matrix = Eigen::Matrix<Real, 3, 3>;
+		using Mask = decltype(std::declval<Real>() < std::declval<Real>());
+
+		//! \returns the mask of the first \a n lanes of a block
+		static Mask activeLanes(size_t n)
+		{
+			VCL_ALIGN(64) static const float lanes[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+			Real lane;
+			Vcl::load(lane, lanes);
+			return lane < Real(static_cast<float>(n));
+		}
+
+		//! Read a block of matrices, inactive lanes are set to the identity
+		static Matrix loadBlock(const Matrix33Array& A, size_t block, const Mask& mask)
+		{
+			const Matrix identity = Matrix::Identity();
+
+			Matrix m = A.at<Real>(block);
+			for (int k = 0; k < 9; k++)
+				m(k) = Vcl::select(mask, m(k), identity(k));
+
+			return m;
+		}
+
+		//! Write a block of matrices, inactive lanes are left unchanged
+		static void storeBlock(Matrix33Array& A, size_t block, const Mask& mask, const Matrix& value)
+		{
+			auto m = A.at<Real>(block);
+			for (int c = 0; c < 3; c++)
+				for (int r = 0; r < 3; r++)
+					m(r, c) = Vcl::select(mask, value(r, c), Real(m(r, c)));
+		}
+
+		/*!
+		 *	Invoke \a op for each block of matrices in [begin, end). The blocks
+		 *	are distributed among the available threads.
+		 *
+		 *	\returns the accumulated values returned by \a op
+		 */
+		template<typename Func>
+		static int forEachBlock(size_t begin, size_t end, Func&& op)
+		{
+			Require(begin % Width == 0, "Range starts at a block boundary.");
+
+			const int first = static_cast<int>(begin / Width);
+			const int last = static_cast<int>((end + Width - 1) / Width);
+
+			int iterations = 0;
+#ifdef _OPENMP
+#	pragma omp parallel for reduction(+:iterations)
+#endif // _OPENMP
+			for (int b = first; b < last; b++)
+			{
+				iterations += op(static_cast<size_t>(b), activeLanes(end - b*Width));
+			}
+
+			return iterations;
+		}
+
+		static int qrJacobiSVD(Matrix33Array& A, Matrix33Array& U, Matrix33Array& V, size_t begin, size_t end)
+		{
+			return forEachBlock(begin, end, [&A, &U, &V](size_t b, const Mask& mask)
+			{
+				Matrix a = loadBlock(A, b, mask);
+				Matrix u, v;
+				const int iterations = QRJacobiSVD<Real>(a, u, v);
+
+				storeBlock(A, b, mask, a);
+				storeBlock(U, b, mask, u);
+				storeBlock(V, b, mask, v);
+				return iterations;
+			});
+		}
+
+		static int twoSidedJacobiSVD(Matrix33Array& A, Matrix33Array& U, Matrix33Array& V, size_t begin, size_t end, bool warm_start)
+		{
+			return forEachBlock(begin, end, [&A, &U, &V, warm_start](size_t b, const Mask& mask)
+			{
+				Matrix a = loadBlock(A, b, mask);
+				Matrix u, v;
+				if (warm_start)
+				{
+					u = loadBlock(U, b, mask);
+					v = loadBlock(V, b, mask);
+				}
+				const int iterations = TwoSidedJacobiSVD<Real>(a, u, v, warm_start);
+
+				storeBlock(A, b, mask, a);
+				storeBlock(U, b, mask, u);
+				storeBlock(V, b, mask, v);
+				return iterations;
+			});
+		}
+
+		static int selfAdjointJacobiEigen(Matrix33Array& A, Matrix33Array& U, size_t begin, size_t end)
+		{
+			return forEachBlock(begin, end, [&A, &U](size_t b, const Mask& mask)
+			{
+				Matrix a = loadBlock(A, b, mask);
+				Matrix u;
+				const int iterations = SelfAdjointJacobiEigenMaxElement<Real>(a, u);
+
+				storeBlock(A, b, mask, a);
+				storeBlock(U, b, mask, u);
+				return iterations;
+			});
+		}
+
+		static int rotation(const Matrix33Array& A, Matrix33Array& R, size_t begin, size_t end)
+		{
+			return forEachBlock(begin, end, [&A, &R](size_t b, const Mask& mask)
+			{
+				const Matrix a = loadBlock(A, b, mask);
+				Matrix r = loadBlock(R, b, mask);
+				const int iterations = Rotation<Real>(a, r);
+
+				storeBlock(R, b, mask, r);
+				return iterations;
+			});
+		}
+
+		static void polarDecomposition(Matrix33Array& A, Matrix33Array& R, Matrix33Array* S, size_t begin, size_t end)
+		{
+			forEachBlock(begin, end, [&A, &R, S](size_t b, const Mask& mask)
+			{
+				Matrix a = loadBlock(A, b, mask);
+				Matrix r, s;
+				PolarDecomposition<Real>(a, r, S ? &s : nullptr);
+
+				storeBlock(R, b, mask, r);
+				if (S)
+					storeBlock(*S, b, mask, s);
+				return 0;
+			});
+		}
+	};
+}}}
@@ -48,6 +48,21 @@ namespace Vcl { namespace Mathematics
 		return SelfAdjointJacobiEigenMaxElement(A, U);
 	}
 
+	int SelfAdjointJacobiEigen(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& U)
+	{
+		return SelfAdjointJacobiEigenMaxElement(A, U);
+	}
+
+	int SelfAdjointJacobiEigen(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U)
+	{
+		return SelfAdjointJacobiEigenMaxElement(A, U);
+	}
+
+	int SelfAdjointJacobiEigen(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U)
+	{
+		return SelfAdjointJacobiEigenMaxElement(A, U);
+	}
+
 	int SelfAdjointJacobiEigen(Eigen::Matrix3d& A, Eigen::Matrix3d& U)
 	{
 		return SelfAdjointJacobiEigenMaxElement(A, U);
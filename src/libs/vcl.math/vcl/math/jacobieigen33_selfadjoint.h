@@ -38,5 +38,9 @@ namespace Vcl { namespace Mathematics
 	int SelfAdjointJacobiEigen(Eigen::Matrix<float8,  3, 3>& A, Eigen::Matrix<float8,  3, 3>& U);
 	int SelfAdjointJacobiEigen(Eigen::Matrix<float16, 3, 3>& A, Eigen::Matrix<float16, 3, 3>& U);
 
+	int SelfAdjointJacobiEigen(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& U);
+	int SelfAdjointJacobiEigen(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U);
+	int SelfAdjointJacobiEigen(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U);
+
 	int SelfAdjointJacobiEigen(Eigen::Matrix3d& A, Eigen::Matrix3d& U);
 }}
@@ -97,6 +97,33 @@ namespace Vcl { namespace Mathematics
 		// 2^-51 (Machine eps: 2^-52)
 		VCL_STRONG_INLINE static double epsilon() { return 4.4408920985006261616945266723633e-16; }
 	};
+
+	template<>
+	struct JacobiTraits<double2>
+	{
+		VCL_STRONG_INLINE static int maxIterations() { return 20; }
+
+		// 2^-51 (Machine eps: 2^-52)
+		VCL_STRONG_INLINE static double epsilon() { return 4.4408920985006261616945266723633e-16; }
+	};
+
+	template<>
+	struct JacobiTraits<double4>
+	{
+		VCL_STRONG_INLINE static int maxIterations() { return 20; }
+
+		// 2^-51 (Machine eps: 2^-52)
+		VCL_STRONG_INLINE static double epsilon() { return 4.4408920985006261616945266723633e-16; }
+	};
+
+	template<>
+	struct JacobiTraits<double8>
+	{
+		VCL_STRONG_INLINE static int maxIterations() { return 20; }
+
+		// 2^-51 (Machine eps: 2^-52)
+		VCL_STRONG_INLINE static double epsilon() { return 4.4408920985006261616945266723633e-16; }
+	};
 	
 	template<typename Real>
 	VCL_STRONG_INLINE Eigen::Matrix<Real, 2, 1> JacobiRotationAngle(const Real& a11, const Real& a12, const Real& a22)
@@ -47,6 +47,21 @@ namespace Vcl { namespace Mathematics
 		return SelfAdjointJacobiEigenQuatIncrementalSweeps(A, U);
 	}
 
+	int SelfAdjointJacobiEigenQuat(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& U)
+	{
+		return SelfAdjointJacobiEigenQuatIncrementalSweeps(A, U);
+	}
+
+	int SelfAdjointJacobiEigenQuat(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U)
+	{
+		return SelfAdjointJacobiEigenQuatIncrementalSweeps(A, U);
+	}
+
+	int SelfAdjointJacobiEigenQuat(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U)
+	{
+		return SelfAdjointJacobiEigenQuatIncrementalSweeps(A, U);
+	}
+
 	int SelfAdjointJacobiEigenQuat(Eigen::Matrix3d& A, Eigen::Matrix3d& U)
 	{
 		return SelfAdjointJacobiEigenQuatIncrementalSweeps(A, U);
@@ -38,5 +38,9 @@ namespace Vcl { namespace Mathematics
 	int SelfAdjointJacobiEigenQuat(Eigen::Matrix<float8,  3, 3>& A, Eigen::Matrix<float8,  3, 3>& U);
 	int SelfAdjointJacobiEigenQuat(Eigen::Matrix<float16, 3, 3>& A, Eigen::Matrix<float16, 3, 3>& U);
 
+	int SelfAdjointJacobiEigenQuat(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& U);
+	int SelfAdjointJacobiEigenQuat(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U);
+	int SelfAdjointJacobiEigenQuat(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U);
+
 	int SelfAdjointJacobiEigenQuat(Eigen::Matrix3d& A, Eigen::Matrix3d& U);
 }}
@@ -49,6 +49,21 @@ namespace Vcl { namespace Mathematics
 		return QRJacobiSVD<float16>(A, U, V);
 	}
 
+	int QRJacobiSVD(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& U, Eigen::Matrix<double2, 3, 3>& V)
+	{
+		return QRJacobiSVD<double2>(A, U, V);
+	}
+
+	int QRJacobiSVD(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U, Eigen::Matrix<double4, 3, 3>& V)
+	{
+		return QRJacobiSVD<double4>(A, U, V);
+	}
+
+	int QRJacobiSVD(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U, Eigen::Matrix<double8, 3, 3>& V)
+	{
+		return QRJacobiSVD<double8>(A, U, V);
+	}
+
 	int QRJacobiSVD(Eigen::Matrix3d& A, Eigen::Matrix3d& U, Eigen::Matrix3d& V)
 	{
 		return QRJacobiSVD<double>(A, U, V);
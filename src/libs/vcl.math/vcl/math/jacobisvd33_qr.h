@@ -38,5 +38,9 @@ namespace Vcl { namespace Mathematics
 	int QRJacobiSVD(Eigen::Matrix<float8,  3, 3>& A, Eigen::Matrix<float8,  3, 3>& U, Eigen::Matrix<float8,  3, 3>& V);
 	int QRJacobiSVD(Eigen::Matrix<float16, 3, 3>& A, Eigen::Matrix<float16, 3, 3>& U, Eigen::Matrix<float16, 3, 3>& V);
 
+	int QRJacobiSVD(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& U, Eigen::Matrix<double2, 3, 3>& V);
+	int QRJacobiSVD(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U, Eigen::Matrix<double4, 3, 3>& V);
+	int QRJacobiSVD(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U, Eigen::Matrix<double8, 3, 3>& V);
+
 	int QRJacobiSVD(Eigen::Matrix3d& A, Eigen::Matrix3d& U, Eigen::Matrix3d& V);
 }}
@@ -48,6 +48,21 @@ namespace Vcl { namespace Mathematics
 		return TwoSidedJacobiSVD<float16>(A, U, V, warm_start);
 	}
 
+	int TwoSidedJacobiSVD(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& U, Eigen::Matrix<double2, 3, 3>& V, bool warm_start /* = false */)
+	{
+		return TwoSidedJacobiSVD<double2>(A, U, V, warm_start);
+	}
+
+	int TwoSidedJacobiSVD(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U, Eigen::Matrix<double4, 3, 3>& V, bool warm_start /* = false */)
+	{
+		return TwoSidedJacobiSVD<double4>(A, U, V, warm_start);
+	}
+
+	int TwoSidedJacobiSVD(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U, Eigen::Matrix<double8, 3, 3>& V, bool warm_start /* = false */)
+	{
+		return TwoSidedJacobiSVD<double8>(A, U, V, warm_start);
+	}
+
 	int TwoSidedJacobiSVD(Eigen::Matrix3d& A, Eigen::Matrix3d& U, Eigen::Matrix3d& V, bool warm_start /* = false */)
 	{
 		return TwoSidedJacobiSVD<double>(A, U, V, warm_start);
@@ -38,5 +38,9 @@ namespace Vcl { namespace Mathematics
 	int TwoSidedJacobiSVD(Eigen::Matrix<float8,  3, 3>& A, Eigen::Matrix<float8,  3, 3>& U, Eigen::Matrix<float8,  3, 3>& V, bool warm_start = false);
 	int TwoSidedJacobiSVD(Eigen::Matrix<float16, 3, 3>& A, Eigen::Matrix<float16, 3, 3>& U, Eigen::Matrix<float16, 3, 3>& V, bool warm_start = false);
 
+	int TwoSidedJacobiSVD(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& U, Eigen::Matrix<double2, 3, 3>& V, bool warm_start = false);
+	int TwoSidedJacobiSVD(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U, Eigen::Matrix<double4, 3, 3>& V, bool warm_start = false);
+	int TwoSidedJacobiSVD(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U, Eigen::Matrix<double8, 3, 3>& V, bool warm_start = false);
+
 	int TwoSidedJacobiSVD(Eigen::Matrix3d& A, Eigen::Matrix3d& U, Eigen::Matrix3d& V, bool warm_start = false);
 }}
@@ -46,6 +46,21 @@ namespace Vcl { namespace Mathematics
 		PolarDecomposition<float16>(A, R, S);
 	}
 
+	void PolarDecomposition(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& R, Eigen::Matrix<double2, 3, 3>* S)
+	{
+		PolarDecomposition<double2>(A, R, S);
+	}
+
+	void PolarDecomposition(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& R, Eigen::Matrix<double4, 3, 3>* S)
+	{
+		PolarDecomposition<double4>(A, R, S);
+	}
+
+	void PolarDecomposition(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& R, Eigen::Matrix<double8, 3, 3>* S)
+	{
+		PolarDecomposition<double8>(A, R, S);
+	}
+
 	void PolarDecomposition(Eigen::Matrix3d& A, Eigen::Matrix3d& R, Eigen::Matrix3d* S)
 	{
 		PolarDecomposition<double>(A, R, S);
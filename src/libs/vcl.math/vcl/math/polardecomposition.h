@@ -38,5 +38,9 @@ namespace Vcl { namespace Mathematics
 	void PolarDecomposition(Eigen::Matrix<float8,  3, 3>& A, Eigen::Matrix<float8,  3, 3>& R, Eigen::Matrix<float8,  3, 3>* S);
 	void PolarDecomposition(Eigen::Matrix<float16, 3, 3>& A, Eigen::Matrix<float16, 3, 3>& R, Eigen::Matrix<float16, 3, 3>* S);
 
+	void PolarDecomposition(Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& R, Eigen::Matrix<double2, 3, 3>* S);
+	void PolarDecomposition(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& R, Eigen::Matrix<double4, 3, 3>* S);
+	void PolarDecomposition(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& R, Eigen::Matrix<double8, 3, 3>* S);
+
 	void PolarDecomposition(Eigen::Matrix3d& A, Eigen::Matrix3d& R, Eigen::Matrix3d* S);
 }}
@@ -64,6 +64,42 @@ namespace Vcl { namespace Mathematics
 		JacobiRotateQR<float8, 2, 1>(R, Q);
 	}
 
+	void JacobiQR(Eigen::Matrix<double2, 3, 3>& R, Eigen::Matrix<double2, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence (1,0), (2,0), (2,1)
+		// of rotations
+		JacobiRotateQR<double2, 1, 0>(R, Q);
+		JacobiRotateQR<double2, 2, 0>(R, Q);
+		JacobiRotateQR<double2, 2, 1>(R, Q);
+	}
+
+	void JacobiQR(Eigen::Matrix<double4, 3, 3>& R, Eigen::Matrix<double4, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence (1,0), (2,0), (2,1)
+		// of rotations
+		JacobiRotateQR<double4, 1, 0>(R, Q);
+		JacobiRotateQR<double4, 2, 0>(R, Q);
+		JacobiRotateQR<double4, 2, 1>(R, Q);
+	}
+
+	void JacobiQR(Eigen::Matrix<double8, 3, 3>& R, Eigen::Matrix<double8, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence (1,0), (2,0), (2,1)
+		// of rotations
+		JacobiRotateQR<double8, 1, 0>(R, Q);
+		JacobiRotateQR<double8, 2, 0>(R, Q);
+		JacobiRotateQR<double8, 2, 1>(R, Q);
+	}
+
 	void JacobiQR(Matrix3d& R, Matrix3d& Q)
 	{
 		// Initialize Q
@@ -106,6 +142,36 @@ namespace Vcl { namespace Mathematics
 		HouseholderQR<float8, 1>(R, Q);
 	}
 
+	void HouseholderQR(Eigen::Matrix<double2, 3, 3>& R, Eigen::Matrix<double2, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence 0, 1 column elimination
+		HouseholderQR<double2, 0>(R, Q);
+		HouseholderQR<double2, 1>(R, Q);
+	}
+
+	void HouseholderQR(Eigen::Matrix<double4, 3, 3>& R, Eigen::Matrix<double4, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence 0, 1 column elimination
+		HouseholderQR<double4, 0>(R, Q);
+		HouseholderQR<double4, 1>(R, Q);
+	}
+
+	void HouseholderQR(Eigen::Matrix<double8, 3, 3>& R, Eigen::Matrix<double8, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence 0, 1 column elimination
+		HouseholderQR<double8, 0>(R, Q);
+		HouseholderQR<double8, 1>(R, Q);
+	}
+
 	void HouseholderQR(Eigen::Matrix<double, 3, 3>& R, Eigen::Matrix<double, 3, 3>& Q)
 	{
 		// Initialize Q
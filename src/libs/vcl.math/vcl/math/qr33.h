@@ -37,11 +37,19 @@ namespace Vcl { namespace Mathematics
 	void JacobiQR(Eigen::Matrix<float4, 3, 3>& R, Eigen::Matrix<float4, 3, 3>& Q);
 	void JacobiQR(Eigen::Matrix<float8, 3, 3>& R, Eigen::Matrix<float8, 3, 3>& Q);
 
+	void JacobiQR(Eigen::Matrix<double2, 3, 3>& R, Eigen::Matrix<double2, 3, 3>& Q);
+	void JacobiQR(Eigen::Matrix<double4, 3, 3>& R, Eigen::Matrix<double4, 3, 3>& Q);
+	void JacobiQR(Eigen::Matrix<double8, 3, 3>& R, Eigen::Matrix<double8, 3, 3>& Q);
+
 	void JacobiQR(Matrix3d& R, Matrix3d& Q);
 
 	void HouseholderQR(Eigen::Matrix<float,  3, 3>& R, Eigen::Matrix<float,  3, 3>& Q);
 	void HouseholderQR(Eigen::Matrix<float4, 3, 3>& R, Eigen::Matrix<float4, 3, 3>& Q);
 	void HouseholderQR(Eigen::Matrix<float8, 3, 3>& R, Eigen::Matrix<float8, 3, 3>& Q);
 
+	void HouseholderQR(Eigen::Matrix<double2, 3, 3>& R, Eigen::Matrix<double2, 3, 3>& Q);
+	void HouseholderQR(Eigen::Matrix<double4, 3, 3>& R, Eigen::Matrix<double4, 3, 3>& Q);
+	void HouseholderQR(Eigen::Matrix<double8, 3, 3>& R, Eigen::Matrix<double8, 3, 3>& Q);
+
 	void HouseholderQR(Eigen::Matrix<double, 3, 3>& R, Eigen::Matrix<double, 3, 3>& Q);
 }}
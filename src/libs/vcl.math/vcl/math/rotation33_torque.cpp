@@ -45,6 +45,21 @@ namespace Vcl { namespace Mathematics
 	{
 		return Rotation<float16>(A, R);
 	}
+
+	int Rotation(const Eigen::Matrix<double2, 3, 3>& A, Eigen::Matrix<double2, 3, 3>& R)
+	{
+		return Rotation<double2>(A, R);
+	}
+
+	int Rotation(const Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& R)
+	{
+		return Rotation<double4>(A, R);
+	}
+
+	int Rotation(const Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& R)
+	{
+		return Rotation<double8>(A, R);
+	}
 	
 	int Rotation(const Eigen::Matrix<double, 3, 3>& A, Eigen::Matrix<double, 3, 3>& R)
 	{
@@ -26,7 +26,12 @@
 // VCL configuration
 #include <vcl/config/global.h>
 
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+
 // Include the relevant parts from the library
+#include <vcl/components/commandbuffer.h>
 #include <vcl/components/entitymanager.h>
 
 // Google test
@@ -138,3 +143,251 @@ TEST(EntityManagerTest, CreateDestroyMultiComponents)
 	EXPECT_EQ("E2_1", c2_1->Name);
 	EXPECT_EQ("E2_2", c2_2->Name);
 }
+
+TEST(EntityManagerTest, CreateDestroyDenseComponents)
+{
+	using namespace Vcl::Components;
+
+	EntityManager em;
+	auto e0 = em.create();
+	auto e1 = em.create();
+	auto e2 = em.create();
+	auto e3 = em.create();
+
+	em.registerComponent<NameComponent, ComponentStorage::Dense>();
+
+	em.create<NameComponent>(e0, "E0");
+	em.create<NameComponent>(e2, "E2");
+	em.create<NameComponent>(e3, "E3");
+
+	EXPECT_TRUE (em.has<NameComponent>(e0));
+	EXPECT_FALSE(em.has<NameComponent>(e1));
+	EXPECT_TRUE (em.has<NameComponent>(e2));
+	EXPECT_TRUE (em.has<NameComponent>(e3));
+	EXPECT_EQ(3, em.get<NameComponent>()->size());
+
+	// Removing a component moves the last one into its place
+	em.remove<NameComponent>(e0);
+
+	EXPECT_FALSE(em.has<NameComponent>(e0));
+	EXPECT_TRUE (em.has<NameComponent>(e2));
+	EXPECT_TRUE (em.has<NameComponent>(e3));
+	EXPECT_EQ(2, em.get<NameComponent>()->size());
+
+	std::vector<std::string> names;
+	em.get<NameComponent>()->forEach([&names](EntityId, const NameComponent* c)
+	{
+		names.emplace_back(c->Name);
+	});
+	ASSERT_EQ(2, names.size());
+	EXPECT_EQ("E3", names[0]);
+	EXPECT_EQ("E2", names[1]);
+
+	// Entities reusing an index do not see the components of their predecessor
+	em.destroy(e2);
+	auto e4 = em.create();
+	EXPECT_FALSE(em.has<NameComponent>(e4));
+
+	em.create<NameComponent>(e4, "E4");
+	EXPECT_TRUE(em.has<NameComponent>(e4));
+	EXPECT_EQ(2, em.get<NameComponent>()->size());
+}
+
+struct PositionComponent
+{
+	PositionComponent() = default;
+	PositionComponent(float x) : X(x) {}
+
+	float X{ 0 };
+};
+
+TEST(EntityManagerTest, JoinedView)
+{
+	using namespace Vcl::Components;
+
+	EntityManager em;
+	em.registerComponent<NameComponent>();
+	em.registerComponent<PositionComponent, ComponentStorage::Dense>();
+
+	std::vector<Entity> entities;
+	for (int i = 0; i < 8; i++)
+	{
+		entities.emplace_back(em.create());
+		em.create<PositionComponent>(entities.back(), static_cast<float>(i));
+	}
+	em.create<NameComponent>(entities[1], "E1");
+	em.create<NameComponent>(entities[4], "E4");
+	em.create<NameComponent>(entities[6], "E6");
+
+	std::vector<std::string> names;
+	float sum = 0;
+	em.view<PositionComponent, NameComponent>().forEach([&](EntityId, PositionComponent& p, NameComponent& n)
+	{
+		p.X *= 2;
+		sum += p.X;
+		names.emplace_back(n.Name);
+	});
+	std::sort(names.begin(), names.end());
+
+	ASSERT_EQ(3, names.size());
+	EXPECT_EQ("E1", names[0]);
+	EXPECT_EQ("E4", names[1]);
+	EXPECT_EQ("E6", names[2]);
+	EXPECT_EQ(22.0f, sum);
+
+	// Components accessed through the view can be modified
+	size_t nr_positions = 0;
+	em.view<PositionComponent>().forEach([&](EntityId, PositionComponent&)
+	{
+		nr_positions++;
+	});
+	EXPECT_EQ(8, nr_positions);
+	EXPECT_EQ(8.0f, em.get<PositionComponent>()->data()[4].X);
+}
+
+TEST(EntityManagerTest, BatchedView)
+{
+	using namespace Vcl::Components;
+
+	EntityManager em;
+	em.registerComponent<NameComponent>();
+	em.registerComponent<PositionComponent, ComponentStorage::Dense>();
+
+	std::vector<Entity> entities;
+	for (int i = 0; i < 10; i++)
+	{
+		entities.emplace_back(em.create());
+		em.create<PositionComponent>(entities.back(), static_cast<float>(i));
+	}
+	em.create<NameComponent>(entities[2], "E2");
+	em.create<NameComponent>(entities[7], "E7");
+
+	// Batches of a dense store refer to its packed array
+	std::vector<size_t> sizes;
+	const PositionComponent* next = em.get<PositionComponent>()->data();
+	em.view<PositionComponent>().forEachBatch([&](gsl::span<const EntityId> ids, gsl::span<PositionComponent> p)
+	{
+		ASSERT_EQ(ids.size(), p.size());
+		EXPECT_EQ(next, p.data());
+		next += p.size();
+
+		sizes.emplace_back(p.size());
+		for (auto& c : p)
+			c.X += 1;
+	}, 4);
+	ASSERT_EQ(3, sizes.size());
+	EXPECT_EQ(4, sizes[0]);
+	EXPECT_EQ(4, sizes[1]);
+	EXPECT_EQ(2, sizes[2]);
+	EXPECT_EQ(10.0f, em.get<PositionComponent>()->data()[9].X);
+
+	// Joined views pass the matching entities only
+	std::vector<std::string> names;
+	float sum = 0;
+	em.view<PositionComponent, NameComponent>().forEachBatch([&](gsl::span<const EntityId> ids, gsl::span<PositionComponent> p, gsl::span<NameComponent> n)
+	{
+		ASSERT_EQ(ids.size(), p.size());
+		ASSERT_EQ(ids.size(), n.size());
+		for (std::ptrdiff_t i = 0; i < ids.size(); i++)
+		{
+			sum += p[i].X;
+			names.emplace_back(n[i].Name);
+		}
+	});
+	std::sort(names.begin(), names.end());
+
+	ASSERT_EQ(2, names.size());
+	EXPECT_EQ("E2", names[0]);
+	EXPECT_EQ("E7", names[1]);
+	EXPECT_EQ(11.0f, sum);
+}
+
+TEST(EntityManagerTest, DeferredCommands)
+{
+	using namespace Vcl::Components;
+
+	EntityManager em;
+	em.registerComponent<NameComponent>();
+	em.registerComponent<PositionComponent, ComponentStorage::Dense>();
+
+	std::vector<Entity> entities;
+	for (int i = 0; i < 4; i++)
+	{
+		entities.emplace_back(em.create());
+		em.create<PositionComponent>(entities.back(), static_cast<float>(i));
+	}
+
+	// Record changes from parallel threads
+	std::vector<CommandBuffer> buffers(entities.size());
+#ifdef _OPENMP
+#	pragma omp parallel for
+#endif // _OPENMP
+	for (int i = 0; i < static_cast<int>(entities.size()); i++)
+	{
+		auto& cmds = buffers[i];
+		if (i % 2 == 0)
+		{
+			auto e = cmds.create();
+			cmds.create<NameComponent>(e, "Child");
+			cmds.create<PositionComponent>(e, 10.0f + i);
+			cmds.remove<PositionComponent>(entities[i]);
+		}
+		else
+		{
+			cmds.destroy(entities[i]);
+		}
+	}
+
+	// The recorded changes are not yet visible
+	EXPECT_EQ(4, em.size());
+	EXPECT_EQ(4, em.get<PositionComponent>()->size());
+
+	std::vector<Entity> created;
+	for (auto& cmds : buffers)
+	{
+		auto entities = cmds.execute(em);
+		created.insert(created.end(), entities.begin(), entities.end());
+		EXPECT_TRUE(cmds.empty());
+	}
+
+	ASSERT_EQ(2, created.size());
+	EXPECT_EQ(4, em.size());
+	EXPECT_EQ(2, em.get<NameComponent>()->size());
+	EXPECT_TRUE(em.has<NameComponent>(created[0]));
+	EXPECT_TRUE(em.has<PositionComponent>(created[1]));
+	EXPECT_FALSE(em.has<PositionComponent>(entities[0]));
+	EXPECT_FALSE(em.has<PositionComponent>(entities[2]));
+}
+
+TEST(EntityManagerTest, ParallelForEach)
+{
+	using namespace Vcl::Components;
+
+	EntityManager em;
+	em.registerComponent<NameComponent>();
+	em.registerComponent<PositionComponent, ComponentStorage::Dense>();
+	em.registerComponent<SecondaryNameComponent>([](const SecondaryNameComponent& c, const std::string& s)
+	{
+		return c.Name == s;
+	});
+
+	for (int i = 0; i < 1000; i++)
+	{
+		auto e = em.create();
+		em.create<PositionComponent>(e, static_cast<float>(i));
+		em.create<NameComponent>(e, "E");
+		em.create<SecondaryNameComponent>(e, "A");
+		em.create<SecondaryNameComponent>(e, "B");
+	}
+
+	std::atomic<int> nr_dense{ 0 };
+	std::atomic<int> nr_hashed{ 0 };
+	std::atomic<int> nr_multi{ 0 };
+	em.get<PositionComponent>()->parallelForEach([&](EntityId, const PositionComponent*) { nr_dense++; }, 64);
+	em.get<NameComponent>()->parallelForEach([&](EntityId, const NameComponent*) { nr_hashed++; }, 64);
+	em.get<SecondaryNameComponent>()->parallelForEach([&](EntityId, const SecondaryNameComponent*) { nr_multi++; }, 64);
+
+	EXPECT_EQ(1000, nr_dense);
+	EXPECT_EQ(1000, nr_hashed);
+	EXPECT_EQ(2000, nr_multi);
+}
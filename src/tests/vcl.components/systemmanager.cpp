@@ -0,0 +1,146 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <atomic>
+
+// Include the relevant parts from the library
+#include <vcl/components/entitymanager.h>
+#include <vcl/components/systemmanager.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	struct Position { float X{ 0 }; };
+	struct Velocity { float X{ 0 }; };
+	struct Mass { float M{ 1 }; };
+
+	class IntegrationSystem : public Vcl::Components::System
+	{
+	public:
+		IntegrationSystem()
+		{
+			reads<Velocity>();
+			writes<Position>();
+		}
+
+		void update(Vcl::Components::EntityManager& em) override
+		{
+			em.view<Position, Velocity>().forEach([](Vcl::Components::EntityId, Position& p, Velocity& v)
+			{
+				p.X += v.X;
+			});
+		}
+	};
+
+	class ForceSystem : public Vcl::Components::System
+	{
+	public:
+		ForceSystem()
+		{
+			reads<Mass>();
+			writes<Velocity>();
+		}
+
+		void update(Vcl::Components::EntityManager& em) override
+		{
+			em.view<Velocity, Mass>().forEach([](Vcl::Components::EntityId, Velocity& v, Mass& m)
+			{
+				v.X += 1.0f / m.M;
+			});
+		}
+	};
+
+	class MassSystem : public Vcl::Components::System
+	{
+	public:
+		MassSystem()
+		{
+			reads<Mass>();
+		}
+
+		void update(Vcl::Components::EntityManager& em) override
+		{
+			em.view<Mass>().forEach([this](Vcl::Components::EntityId, Mass& m)
+			{
+				TotalMass += m.M;
+			});
+		}
+
+		float TotalMass{ 0 };
+	};
+}
+
+TEST(SystemManagerTest, Conflicts)
+{
+	IntegrationSystem integration;
+	ForceSystem force;
+	MassSystem mass;
+
+	EXPECT_TRUE (integration.conflicts(force));
+	EXPECT_TRUE (force.conflicts(integration));
+	EXPECT_FALSE(integration.conflicts(mass));
+	EXPECT_FALSE(force.conflicts(mass));
+}
+
+TEST(SystemManagerTest, ScheduledUpdate)
+{
+	using namespace Vcl::Components;
+
+	auto em = Vcl::Core::make_owner<EntityManager>();
+	em->registerComponent<Position, ComponentStorage::Dense>();
+	em->registerComponent<Velocity, ComponentStorage::Dense>();
+	em->registerComponent<Mass>();
+
+	for (int i = 0; i < 16; i++)
+	{
+		auto e = em->create();
+		em->create<Position>(e);
+		em->create<Velocity>(e);
+		em->create<Mass>(e);
+	}
+
+	SystemManager sm{ em };
+	sm.add<ForceSystem>();
+	auto mass = sm.add<MassSystem>();
+	sm.add<IntegrationSystem>();
+
+	// The force and mass systems can run concurrently, the integration has to follow
+	EXPECT_EQ(2, sm.nrStages());
+
+	sm.update();
+	sm.update();
+
+	EXPECT_EQ(32.0f, mass->TotalMass);
+	em->get<Position>()->forEach([](EntityId, const Position* p)
+	{
+		EXPECT_EQ(3.0f, p->X);
+	});
+}
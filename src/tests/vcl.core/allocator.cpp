@@ -28,9 +28,16 @@
 
 // Include the relevant parts from the library
 #include <vcl/core/memory/allocator.h>
+#include <vcl/core/memory/arena.h>
+#include <vcl/core/memory/frameallocator.h>
+#include <vcl/core/memory/pages.h>
+#include <vcl/core/memory/pool.h>
+#include <vcl/core/memory/tracking.h>
 
 // C++ standard library
+#include <algorithm>
 #include <scoped_allocator>
+#include <thread>
 #include <vector>
 
 // Google test
@@ -94,3 +101,193 @@ TEST(AllocatorTest, AlignedAllocInitObject)
 	auto base_ptr = reinterpret_cast<size_t>(v.data()) & 0x3f;
 	EXPECT_EQ(0u, base_ptr);
 }
+
+TEST(AllocatorTest, ArenaAllocInitObject)
+{
+	using namespace Vcl::Core;
+
+	MemoryArena arena{ 1024 };
+	using ArenaAllocator = Allocator<SimpleObject, ArenaAllocPolicy<SimpleObject, 64>>;
+	std::vector<SimpleObject, ArenaAllocator> v(10, { 4 }, ArenaAllocator{ ArenaAllocPolicy<SimpleObject, 64>{ &arena } });
+
+	// Check that copy constructor was used to initialized objects
+	EXPECT_EQ(4, v[5].x);
+
+	// Grow beyond the size of a single block
+	v.resize(500);
+
+	// Check that default constructor was used to initialized objects
+	EXPECT_EQ(5, v[413].x);
+
+	// Check alignment of vector data
+	auto base_ptr = reinterpret_cast<size_t>(v.data()) & 0x3f;
+	EXPECT_EQ(0u, base_ptr);
+}
+
+TEST(AllocatorTest, ArenaReset)
+{
+	using namespace Vcl::Core;
+
+	MemoryArena arena{ 256 };
+	void* first = arena.allocate(100, 16);
+	void* second = arena.allocate(100, 32);
+	void* third = arena.allocate(100, 64);
+	EXPECT_EQ(0u, reinterpret_cast<size_t>(second) & 0x1f);
+	EXPECT_EQ(0u, reinterpret_cast<size_t>(third) & 0x3f);
+	EXPECT_NE(first, second);
+	EXPECT_NE(second, third);
+
+	// Resetting reuses the previously allocated blocks
+	const size_t capacity = arena.capacity();
+	arena.reset();
+	EXPECT_EQ(0u, arena.used());
+	EXPECT_EQ(first, arena.allocate(100, 16));
+	EXPECT_EQ(capacity, arena.capacity());
+
+	// Requests larger than a block get a dedicated block
+	void* large = arena.allocate(1000, 128);
+	EXPECT_EQ(0u, reinterpret_cast<size_t>(large) & 0x7f);
+}
+
+TEST(AllocatorTest, PoolAllocConcurrent)
+{
+	using namespace Vcl::Core;
+
+	const int nr_threads = 4;
+	const int nr_blocks = 64;
+	FixedSizePool pool{ sizeof(SimpleObject), nr_threads * nr_blocks, 32 };
+
+	std::vector<std::vector<SimpleObject*>> blocks(nr_threads);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < nr_threads; t++)
+	{
+		threads.emplace_back([&pool, &blocks, t]()
+		{
+			PoolAllocPolicy<SimpleObject> policy{ &pool };
+			for (int r = 0; r < 100; r++)
+			{
+				for (int i = 0; i < nr_blocks; i++)
+					blocks[t].push_back(policy.allocate(1));
+				if (r < 99)
+				{
+					for (auto* p : blocks[t])
+						policy.deallocate(p, 1);
+					blocks[t].clear();
+				}
+			}
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+
+	// All blocks are served from the pool and handed out only once
+	std::vector<SimpleObject*> all;
+	for (const auto& b : blocks)
+		all.insert(all.end(), b.begin(), b.end());
+	std::sort(all.begin(), all.end());
+	EXPECT_EQ(all.end(), std::adjacent_find(all.begin(), all.end()));
+	for (auto* p : all)
+	{
+		EXPECT_TRUE(pool.owns(p));
+		EXPECT_EQ(0u, reinterpret_cast<size_t>(p) & 0x1f);
+	}
+	EXPECT_EQ(nullptr, pool.allocate());
+
+	// Exhausted pools forward to the system allocator
+	PoolAllocPolicy<SimpleObject> policy{ &pool };
+	SimpleObject* overflow = policy.allocate(1);
+	EXPECT_FALSE(pool.owns(overflow));
+	policy.deallocate(overflow, 1);
+}
+
+TEST(AllocatorTest, FrameAllocScope)
+{
+	using namespace Vcl::Core;
+
+	FrameAllocator stack{ 4096 };
+	using StackAllocator = Allocator<SimpleObject, FrameAllocPolicy<SimpleObject, 64>>;
+	{
+		FrameAllocator::Scope scope{ stack };
+		std::vector<SimpleObject, StackAllocator> v(10, { 4 }, StackAllocator{ FrameAllocPolicy<SimpleObject, 64>{ &stack } });
+		EXPECT_EQ(4, v[5].x);
+		EXPECT_EQ(0u, reinterpret_cast<size_t>(v.data()) & 0x3f);
+		EXPECT_LT(0u, stack.used());
+	}
+	EXPECT_EQ(0u, stack.used());
+
+	// Releasing the most recent allocation returns its memory
+	void* p = stack.allocate(128, 16);
+	const size_t used = stack.used();
+	void* q = stack.allocate(256, 16);
+	stack.deallocate(q, 256);
+	EXPECT_EQ(used, stack.used());
+	stack.deallocate(p, 128);
+	EXPECT_EQ(0u, stack.used());
+
+	EXPECT_THROW(stack.allocate(8192, 16), std::bad_alloc);
+}
+
+TEST(AllocatorTest, TrackingAlloc)
+{
+	using namespace Vcl::Core;
+
+	using TrackingAllocator = Allocator<SimpleObject, TrackingAllocPolicy<SimpleObject, AlignedAllocPolicy<SimpleObject, 64>>>;
+	{
+		std::vector<SimpleObject, TrackingAllocator> v(TrackingAllocator{ TrackingAllocPolicy<SimpleObject, AlignedAllocPolicy<SimpleObject, 64>>{ "AllocatorTest.Tracking" } });
+		v.reserve(10);
+		v.reserve(100);
+
+		// Check alignment of vector data
+		auto base_ptr = reinterpret_cast<size_t>(v.data()) & 0x3f;
+		EXPECT_EQ(0u, base_ptr);
+
+		const auto* stats = AllocationTracker::instance().find("AllocatorTest.Tracking");
+		ASSERT_NE(nullptr, stats);
+		EXPECT_EQ(100 * sizeof(SimpleObject), stats->liveBytes());
+		EXPECT_EQ(110 * sizeof(SimpleObject), stats->peakBytes());
+		EXPECT_EQ(2u, stats->allocations());
+		EXPECT_EQ(1u, stats->deallocations());
+		EXPECT_EQ(1u, stats->histogram(AllocationStatistics::sizeClass(10 * sizeof(SimpleObject))));
+	}
+
+	const auto* stats = AllocationTracker::instance().find("AllocatorTest.Tracking");
+	EXPECT_EQ(0u, stats->liveBytes());
+	EXPECT_EQ(2u, stats->deallocations());
+
+	const std::string json = AllocationTracker::instance().toJson();
+	EXPECT_NE(std::string::npos, json.find("\"AllocatorTest.Tracking\""));
+	EXPECT_NE(std::string::npos, json.find("\"peak_bytes\": " + std::to_string(110 * sizeof(SimpleObject))));
+}
+
+TEST(AllocatorTest, PageAlloc)
+{
+	using namespace Vcl::Core;
+
+	PageOptions options[4];
+	options[1].pageSize = PageSize::Transparent;
+	options[1].firstTouch = true;
+	options[2].pageSize = PageSize::Huge;
+	options[3].placement = NumaPlacement::Bind;
+	options[3].nodeMask = 1;
+
+	for (const auto& opt : options)
+	{
+		PageAllocPolicy<float> policy{ opt };
+
+		const size_t count = 3 * 1024 * 1024 / sizeof(float);
+		float* p = policy.allocate(count);
+		ASSERT_NE(nullptr, p);
+
+		// Memory is at least page aligned
+		EXPECT_EQ(0u, reinterpret_cast<size_t>(p) & 0xfff);
+
+		// Fresh pages are zeroed
+		EXPECT_EQ(0.0f, p[0]);
+		EXPECT_EQ(0.0f, p[count - 1]);
+
+		std::fill(p, p + count, 1.0f);
+		EXPECT_EQ(1.0f, p[count / 2]);
+
+		policy.deallocate(p, count);
+	}
+}
@@ -28,12 +28,78 @@
 #include <vcl/config/eigen.h>
 
 // Include the relevant parts from the library
+#include <vcl/core/interleavedarray.h>
 #include <vcl/core/simd/memory.h>
 #include <vcl/core/simd/vectorscalar.h>
 
 // Google test
 #include <gtest/gtest.h>
 
+namespace
+{
+	Vcl::int4 makeIndices(const int (&idx)[4])
+	{
+		return Vcl::int4{ idx[0], idx[1], idx[2], idx[3] };
+	}
+	Vcl::int8 makeIndices(const int (&idx)[8])
+	{
+		return Vcl::int8{ idx[0], idx[1], idx[2], idx[3], idx[4], idx[5], idx[6], idx[7] };
+	}
+	Vcl::int16 makeIndices(const int (&idx)[16])
+	{
+		return Vcl::int16
+		{
+			idx[ 0], idx[ 1], idx[ 2], idx[ 3], idx[ 4], idx[ 5], idx[ 6], idx[ 7],
+			idx[ 8], idx[ 9], idx[10], idx[11], idx[12], idx[13], idx[14], idx[15]
+		};
+	}
+
+	template<int Width, int Stride>
+	void interleavedGatherTestStub(int stride = Stride)
+	{
+		using intN_t = Vcl::VectorScalar<int, Width>;
+
+		const int nr_entries = 37;
+		Vcl::Core::InterleavedArray<float, 3, 3, Stride> data(nr_entries, 3, 3, stride);
+		for (int i = 0; i < nr_entries; i++)
+			for (int c = 0; c < 3; c++)
+				for (int r = 0; r < 3; r++)
+					data.template at<float>(i)(r, c) = 10.0f * i + 3 * c + r;
+
+		// Every third lane is inactive and points outside of the array
+		int idx[Width];
+		for (int i = 0; i < Width; i++)
+			idx[i] = (i % 3 == 2) ? 1000 + i : (7 * i + 3) % nr_entries;
+		const intN_t vindex = makeIndices(idx);
+		const auto mask = vindex < intN_t(nr_entries);
+
+		const auto masked = Vcl::gather(data, vindex, mask);
+		for (int i = 0; i < Width; i++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				for (int r = 0; r < 3; r++)
+				{
+					const float ref = (i % 3 == 2) ? 0.0f : data.template at<float>(idx[i])(r, c);
+					EXPECT_EQ(ref, masked(r, c)[i]) << "Masked " << Width << "-way gather failed.";
+				}
+			}
+		}
+
+		for (int i = 0; i < Width; i++)
+			idx[i] = (7 * i + 3) % nr_entries;
+
+		const auto full = Vcl::gather(data, makeIndices(idx));
+		for (int i = 0; i < Width; i++)
+		{
+			const Eigen::Matrix3f ref = data.template at<float>(idx[i]);
+			for (int c = 0; c < 3; c++)
+				for (int r = 0; r < 3; r++)
+					EXPECT_EQ(ref(r, c), full(r, c)[i]) << Width << "-way gather failed.";
+		}
+	}
+}
+
 // Tests the scalar gather function.
 TEST(GatherTest, Scalar)
 {
@@ -90,6 +156,58 @@ TEST(GatherTest, Scalar)
 	EXPECT_TRUE(all(ref16 == Vcl::gather(mem, idx16))) << "16-way code failed.";
 }
 
+// Tests the double precision gather function.
+TEST(GatherTest, Double)
+{
+	using Vcl::double4;
+	using Vcl::double8;
+
+	using Vcl::int4;
+	using Vcl::int8;
+
+	using Vcl::all;
+
+	// Setup the memory
+	double mem[32];
+	for (int i = 0; i < 32; i++)
+		mem[i] = 0.5 * i + 1.0 / (i + 1);
+
+	int4 idx4{ 3, 26, 1, 15 };
+	double4 ref4{ mem[ 3], mem[26], mem[ 1], mem[15] };
+
+	EXPECT_TRUE(all(ref4 == Vcl::gather(mem, idx4))) << "4-way code failed.";
+
+	int8 idx8{ 3, 26, 1, 15, 12, 29, 0, 19 };
+	double8 ref8
+	{
+		mem[ 3], mem[26], mem[ 1], mem[15],
+		mem[12], mem[29], mem[ 0], mem[19]
+	};
+
+	EXPECT_TRUE(all(ref8 == Vcl::gather(mem, idx8))) << "8-way code failed.";
+
+	double out[32] = {};
+	Vcl::scatter(ref8, out, idx8);
+	for (int i = 0; i < 8; i++)
+		EXPECT_EQ(ref8[i], out[idx8[i]]) << "8-way scatter failed.";
+
+	// Load consecutive 3-vectors into the SoA layout and write them back
+	Eigen::Vector3d vecs[8];
+	for (int i = 0; i < 8; i++)
+		vecs[i] = Eigen::Vector3d(mem[3 * i + 0], mem[3 * i + 1], mem[3 * i + 2]);
+
+	Eigen::Matrix<double8, 3, 1> soa;
+	Vcl::load(soa, vecs);
+
+	Eigen::Vector3d back[8];
+	Vcl::store(back, soa);
+	for (int i = 0; i < 8; i++)
+	{
+		EXPECT_EQ(vecs[i](1), soa(1)[i]) << "Double vector load failed.";
+		EXPECT_EQ(vecs[i], back[i]) << "Double vector store failed.";
+	}
+}
+
 // Tests the matrix gather function.
 TEST(GatherTest, Matrix)
 {
@@ -208,3 +326,63 @@ TEST(GatherTest, Matrix)
 	EXPECT_TRUE(all(ref16(1) == Vcl::gather<float, 16, 3, 1>(mem, idx16)(1))) << "16-way code failed.";
 	EXPECT_TRUE(all(ref16(2) == Vcl::gather<float, 16, 3, 1>(mem, idx16)(2))) << "16-way code failed.";
 }
+
+// Tests the gather function on the supported layouts of interleaved arrays
+TEST(GatherTest, InterleavedArray)
+{
+	interleavedGatherTestStub<4, 0>();
+	interleavedGatherTestStub<8, 0>();
+	interleavedGatherTestStub<16, 0>();
+
+	interleavedGatherTestStub<4, 4>();
+	interleavedGatherTestStub<8, 8>();
+	interleavedGatherTestStub<16, 16>();
+
+	interleavedGatherTestStub<4, Vcl::Core::DynamicStride>();
+	interleavedGatherTestStub<8, Vcl::Core::DynamicStride>();
+	interleavedGatherTestStub<16, Vcl::Core::DynamicStride>();
+
+	// Compile-time defined groups of entries
+	interleavedGatherTestStub<4, 8>();
+	interleavedGatherTestStub<16, 4>();
+
+	// Runtime defined groups of entries
+	interleavedGatherTestStub<8, Vcl::Core::DynamicStride>(4);
+}
+
+// Tests the masked gather function
+TEST(GatherTest, Masked)
+{
+	using Vcl::float4;
+	using Vcl::float8;
+	using Vcl::float16;
+
+	using Vcl::int4;
+	using Vcl::int8;
+	using Vcl::int16;
+
+	using Vcl::all;
+
+	float mem[32];
+	for (int i = 0; i < 32; i++)
+		mem[i] = 0.5f * i + 1.0f;
+
+	// Inactive lanes point outside of the memory
+	int4 idx4{ 3, 1000, 1, 15 };
+	float4 ref4{ mem[ 3], 0, mem[ 1], mem[15] };
+	EXPECT_TRUE(all(ref4 == Vcl::gather(mem, idx4, idx4 < int4(32)))) << "4-way code failed.";
+
+	int8 idx8{ 3, 26, 1, 1000, 12, 29, -1000, 19 };
+	float8 ref8{ mem[ 3], mem[26], mem[ 1], 0, mem[12], mem[29], 0, mem[19] };
+	EXPECT_TRUE(all(ref8 == Vcl::gather(mem, idx8, idx8 >= int8(0) && idx8 < int8(32)))) << "8-way code failed.";
+
+	int16 idx16{ 3, 26, 1, 15, 12, 29, 0, 19, 4, 8, 2, 1000, 25, 28, 1000, 7 };
+	float16 ref16
+	{
+		mem[ 3], mem[26], mem[ 1], mem[15],
+		mem[12], mem[29], mem[ 0], mem[19],
+		mem[ 4], mem[ 8], mem[ 2], 0,
+		mem[25], mem[28], 0, mem[ 7]
+	};
+	EXPECT_TRUE(all(ref16 == Vcl::gather(mem, idx16, idx16 < int16(32)))) << "16-way code failed.";
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ Standard Library
+#include <string>
+
+// Include the relevant parts from the library
+#include <vcl/util/hashedstring.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+// Hashes of literals are available at compile time
+static_assert(Vcl::Util::StringHash("Vertices").hash() == Vcl::Util::HashedString("Vertices").hash(), "Hashes match.");
+static_assert(Vcl::Util::HashedString("Vertices").size() == 8, "Length excludes the terminator.");
+
+TEST(StringHashTest, ConsistentHashes)
+{
+	using namespace Vcl::Util;
+
+	const char* dynamic = "Vertices";
+	const std::string str = "Vertices";
+	const std::string padded = "VerticesMetaData";
+
+	const size_t expected = calculateFNV(dynamic);
+	EXPECT_EQ(expected, StringHash("Vertices").hash());
+	EXPECT_EQ(expected, StringHash(StringHash::DynamicConstCharString(dynamic)).hash());
+	EXPECT_EQ(expected, StringHash(gsl::cstring_span<>(str)).hash());
+	EXPECT_EQ(expected, calculateFNV(padded.data(), 8));
+	EXPECT_EQ(expected, HashedString(str).hash());
+	EXPECT_NE(expected, HashedString(padded).hash());
+}
+
+TEST(StringHashTest, HashedStringCompare)
+{
+	using namespace Vcl::Util;
+
+	const HashedString key("Faces");
+	EXPECT_TRUE(key == std::string("Faces"));
+	EXPECT_FALSE(key == std::string("Face"));
+	EXPECT_FALSE(key == std::string("FacesMetaData"));
+	EXPECT_EQ(std::string("Faces"), key.str());
+}
@@ -34,6 +34,7 @@
 
 // Include the relevant parts from the library
 #include <vcl/core/interleavedarray.h>
+#include <vcl/core/memory/pages.h>
 
 // Google test
 #include <gtest/gtest.h>
@@ -223,6 +224,71 @@ void stridedLayoutTestStub()
 	stridedLayoutTest<4, 3, STRIDE>(33);
 }
 
+template<int ROWS, int COLS, int STRIDE>
+void growthTest(size_t size)
+{
+	using Matrix = Eigen::Matrix<float, ROWS, COLS>;
+
+	std::mt19937 rnd_dev;
+	std::uniform_real_distribution<float> rnd_dist;
+
+	std::vector<Matrix, Eigen::aligned_allocator<Matrix>> ref_data(size);
+	for (auto& entry : ref_data)
+		entry = Matrix::NullaryExpr([&]() { return rnd_dist(rnd_dev); });
+
+	// Append the entries one by one
+	Vcl::Core::InterleavedArray<float, ROWS, COLS, STRIDE> appended;
+	for (const auto& entry : ref_data)
+		appended.push_back(entry);
+	EXPECT_EQ(size, appended.size());
+	EXPECT_LE(size, appended.allocated());
+	EXPECT_EQ(0u, appended.allocated() % 64);
+
+	bool check = true;
+	for (size_t i = 0; i < size; i++)
+		check = check && appended.template at<float>(i) == ref_data[i];
+	EXPECT_TRUE(check) << "push_back, size " << size << ", stride " << STRIDE;
+
+	// Transpose in bulk from consecutive entries
+	Vcl::Core::InterleavedArray<float, ROWS, COLS, STRIDE> assigned(3);
+	assigned.assign(ref_data);
+	EXPECT_EQ(size, assigned.size());
+
+	check = true;
+	for (size_t i = 0; i < size; i++)
+		check = check && assigned.template at<float>(i) == ref_data[i];
+	EXPECT_TRUE(check) << "assign, size " << size << ", stride " << STRIDE;
+
+	// Transpose in bulk back to consecutive entries
+	std::vector<Matrix, Eigen::aligned_allocator<Matrix>> exported;
+	appended.copyTo(exported);
+	EXPECT_TRUE(exported == ref_data) << "copyTo, size " << size << ", stride " << STRIDE;
+
+	// Copies and reallocations keep the entries
+	Vcl::Core::InterleavedArray<float, ROWS, COLS, STRIDE> copied(appended);
+	copied.reserve(3 * size + 1);
+	copied.resize(size / 2);
+	copied.resize(size);
+
+	check = true;
+	for (size_t i = 0; i < size; i++)
+		check = check && copied.template at<float>(i) == ref_data[i];
+	EXPECT_TRUE(check) << "copy, size " << size << ", stride " << STRIDE;
+}
+
+template<int ROWS, int COLS>
+void growthTestStub()
+{
+	for (size_t size : { 0, 1, 7, 31, 64, 65, 200 })
+	{
+		growthTest<ROWS, COLS, 0>(size);
+		growthTest<ROWS, COLS, 3>(size);
+		growthTest<ROWS, COLS, 4>(size);
+		growthTest<ROWS, COLS, 8>(size);
+		growthTest<ROWS, COLS, Vcl::Core::DynamicStride>(size);
+	}
+}
+
 TEST(InterleavedArrayTest, consecutiveLayout)
 {
 	consecutiveLayoutTest<3, 1>(1);
@@ -259,3 +325,65 @@ TEST(InterleavedArrayTest, stridedLayout8) { stridedLayoutTestStub<8>(); }
 TEST(InterleavedArrayTest, stridedLayout31) { stridedLayoutTestStub<31>(); }
 TEST(InterleavedArrayTest, stridedLayout32) { stridedLayoutTestStub<32>(); }
 TEST(InterleavedArrayTest, stridedLayout33) { stridedLayoutTestStub<33>(); }
+
+TEST(InterleavedArrayTest, trackAllocations)
+{
+	using namespace Vcl::Core;
+
+	const auto& stats = AllocationTracker::instance().statistics("InterleavedArrayTest.trackAllocations");
+	{
+		InterleavedArray<float, 3, 3, DynamicStride> data(100);
+		data.trackAllocations("InterleavedArrayTest.trackAllocations");
+
+		// The storage is padded to a multiple of 64 entries
+		EXPECT_EQ(128 * 9 * sizeof(float), stats.liveBytes());
+
+		InterleavedArray<float, 3, 3, DynamicStride> moved(std::move(data));
+		EXPECT_EQ(128 * 9 * sizeof(float), stats.liveBytes());
+	}
+	EXPECT_EQ(0u, stats.liveBytes());
+	EXPECT_EQ(1u, stats.allocations());
+	EXPECT_EQ(1u, stats.deallocations());
+}
+
+TEST(InterleavedArrayTest, growth)
+{
+	growthTestStub<1, 1>();
+	growthTestStub<2, 1>();
+	growthTestStub<3, 1>();
+	growthTestStub<4, 1>();
+	growthTestStub<3, 3>();
+	growthTestStub<4, 3>();
+}
+
+TEST(InterleavedArrayTest, pageAllocator)
+{
+	using namespace Vcl::Core;
+
+	InterleavedArray<float, 3, 1, 8> data(100);
+	for (size_t i = 0; i < data.size(); i++)
+		data.at<float>(i) = Eigen::Vector3f(float(i), float(2 * i), float(3 * i));
+
+	PageOptions options;
+	options.pageSize = PageSize::Transparent;
+	data.setAllocator(PageAllocPolicy<float>{ options });
+	EXPECT_EQ(0u, reinterpret_cast<size_t>(data.data()) & 0xfff);
+
+	// Entries are preserved, growth stays on the policy
+	data.resize(1000);
+	EXPECT_EQ(0u, reinterpret_cast<size_t>(data.data()) & 0xfff);
+	bool equal = true;
+	for (size_t i = 0; i < 100; i++)
+		equal = equal && (data.at<float>(i) == Eigen::Vector3f(float(i), float(2 * i), float(3 * i)));
+	EXPECT_TRUE(equal);
+
+	InterleavedArray<float, 3, 1, 8> copy(data);
+	EXPECT_EQ(0u, reinterpret_cast<size_t>(copy.data()) & 0xfff);
+
+	data.firstTouch();
+	bool zero = true;
+	for (size_t i = 0; i < data.allocated(); i++)
+		zero = zero && data.at<float>(i).isZero();
+	EXPECT_TRUE(zero);
+	EXPECT_EQ(Eigen::Vector3f(99, 198, 297), Eigen::Vector3f(copy.at<float>(99)));
+}
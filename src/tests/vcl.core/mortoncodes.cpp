@@ -0,0 +1,92 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ Standard Library
+#include <cstdint>
+#include <random>
+
+// Include the relevant parts from the library
+#include <vcl/util/mortoncodes.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	// Reference interleaving of the lowest 'bits' bits of each coordinate
+	uint64_t interleave(uint32_t x, uint32_t y, uint32_t z, int bits)
+	{
+		uint64_t code = 0;
+		for (int i = 0; i < bits; i++)
+		{
+			code |= uint64_t((x >> i) & 1) << (3 * i + 0);
+			code |= uint64_t((y >> i) & 1) << (3 * i + 1);
+			code |= uint64_t((z >> i) & 1) << (3 * i + 2);
+		}
+		return code;
+	}
+}
+
+TEST(MortonCode, EncodeDecode63)
+{
+	using Vcl::Util::MortonCode;
+
+	std::mt19937 rnd{ 5489u };
+	std::uniform_int_distribution<uint32_t> dist{ 0, (1u << 21) - 1 };
+	for (int i = 0; i < 10000; i++)
+	{
+		const uint32_t x = dist(rnd), y = dist(rnd), z = dist(rnd);
+		const uint64_t code = MortonCode::encode(x, y, z);
+		EXPECT_EQ(interleave(x, y, z, 21), code);
+
+		uint32_t dx, dy, dz;
+		MortonCode::decode(code, dx, dy, dz);
+		EXPECT_EQ(x, dx);
+		EXPECT_EQ(y, dy);
+		EXPECT_EQ(z, dz);
+	}
+}
+
+TEST(MortonCode, EncodeDecode30)
+{
+	using Vcl::Util::MortonCode;
+
+	std::mt19937 rnd{ 5489u };
+	std::uniform_int_distribution<uint32_t> dist{ 0, (1u << 10) - 1 };
+	for (int i = 0; i < 10000; i++)
+	{
+		const uint32_t x = dist(rnd), y = dist(rnd), z = dist(rnd);
+		const uint32_t code = MortonCode::encode30(x, y, z);
+		EXPECT_EQ(interleave(x, y, z, 10), code);
+
+		uint32_t dx, dy, dz;
+		MortonCode::decode30(code, dx, dy, dz);
+		EXPECT_EQ(x, dx);
+		EXPECT_EQ(y, dy);
+		EXPECT_EQ(z, dz);
+	}
+}
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ Standard Library
+#include <atomic>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/util/parallelfor.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+TEST(ParallelFor, VisitEachIndexOnce)
+{
+	for (size_t count : { 0, 1, 1023, 1024, 1025, 10000 })
+	{
+		std::vector<std::atomic<int>> visits(count);
+		for (auto& v : visits)
+			v = 0;
+
+		Vcl::Util::parallelFor(count, 1024, [&visits](ptrdiff_t i)
+		{
+			visits[i]++;
+		});
+
+		for (size_t i = 0; i < count; i++)
+			EXPECT_EQ(1, visits[i].load()) << "Index " << i << " of " << count;
+	}
+}
+
+TEST(ParallelFor, Chunks)
+{
+	const size_t count = 1000;
+	const size_t grain_size = 64;
+
+	std::vector<int> chunk_sizes((count + grain_size - 1) / grain_size, 0);
+	Vcl::Util::parallelForChunks(count, grain_size, [&](size_t first, size_t last)
+	{
+		EXPECT_EQ(0u, first % grain_size);
+		chunk_sizes[first / grain_size] = static_cast<int>(last - first);
+	});
+
+	for (size_t c = 0; c + 1 < chunk_sizes.size(); c++)
+		EXPECT_EQ(static_cast<int>(grain_size), chunk_sizes[c]);
+	EXPECT_EQ(static_cast<int>(count % grain_size), chunk_sizes.back());
+}
@@ -0,0 +1,102 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/util/radixsort.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	template<typename KeyT>
+	void testRadixSort(size_t size, unsigned int key_bits)
+	{
+		std::mt19937_64 rnd{ 5489u };
+		const KeyT mask = key_bits < sizeof(KeyT) * 8 ? (KeyT(1) << key_bits) - 1 : ~KeyT(0);
+
+		std::vector<KeyT> keys(size);
+		for (auto& key : keys)
+			key = static_cast<KeyT>(rnd()) & mask;
+
+		std::vector<uint32_t> values(size);
+		std::iota(values.begin(), values.end(), 0);
+
+		// Reference ordering, stable with respect to the original position
+		std::vector<uint32_t> ref = values;
+		std::stable_sort(ref.begin(), ref.end(), [&keys](uint32_t a, uint32_t b)
+		{
+			return keys[a] < keys[b];
+		});
+
+		std::vector<KeyT> sorted_keys = keys;
+		Vcl::Util::radixSort(gsl::span<KeyT>{ sorted_keys }, gsl::span<uint32_t>{ values }, key_bits);
+
+		EXPECT_TRUE(std::is_sorted(sorted_keys.begin(), sorted_keys.end()));
+		EXPECT_EQ(ref, values);
+		for (size_t i = 0; i < size; i++)
+			EXPECT_EQ(keys[values[i]], sorted_keys[i]) << "Entry " << i;
+	}
+}
+
+TEST(RadixSort, Empty)
+{
+	std::vector<uint32_t> keys, values;
+	Vcl::Util::radixSort(gsl::span<uint32_t>{ keys }, gsl::span<uint32_t>{ values });
+	EXPECT_TRUE(keys.empty());
+}
+
+TEST(RadixSort, Keys32)
+{
+	testRadixSort<uint32_t>(1000, 32);
+	testRadixSort<uint32_t>(300000, 32);
+}
+
+TEST(RadixSort, Keys30)
+{
+	testRadixSort<uint32_t>(1000, 30);
+	testRadixSort<uint32_t>(300000, 30);
+}
+
+TEST(RadixSort, Keys63)
+{
+	testRadixSort<uint64_t>(1000, 63);
+	testRadixSort<uint64_t>(300000, 63);
+}
+
+TEST(RadixSort, FewDistinctKeys)
+{
+	// Exercises the passes skipped, as all keys share the digit
+	testRadixSort<uint64_t>(300000, 4);
+}
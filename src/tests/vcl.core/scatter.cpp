@@ -28,12 +28,85 @@
 #include <vcl/config/eigen.h>
 
 // Include the relevant parts from the library
+#include <vcl/core/interleavedarray.h>
 #include <vcl/core/simd/memory.h>
 #include <vcl/core/simd/vectorscalar.h>
 
 // Google test
 #include <gtest/gtest.h>
 
+namespace
+{
+	Vcl::int4 makeIndices(const int (&idx)[4])
+	{
+		return Vcl::int4{ idx[0], idx[1], idx[2], idx[3] };
+	}
+	Vcl::int8 makeIndices(const int (&idx)[8])
+	{
+		return Vcl::int8{ idx[0], idx[1], idx[2], idx[3], idx[4], idx[5], idx[6], idx[7] };
+	}
+	Vcl::int16 makeIndices(const int (&idx)[16])
+	{
+		return Vcl::int16
+		{
+			idx[ 0], idx[ 1], idx[ 2], idx[ 3], idx[ 4], idx[ 5], idx[ 6], idx[ 7],
+			idx[ 8], idx[ 9], idx[10], idx[11], idx[12], idx[13], idx[14], idx[15]
+		};
+	}
+
+	template<int Width, int Stride>
+	void interleavedScatterTestStub(bool masked, int stride = Stride)
+	{
+		using floatN_t = Vcl::VectorScalar<float, Width>;
+		using intN_t = Vcl::VectorScalar<int, Width>;
+
+		const int nr_entries = 37;
+		Vcl::Core::InterleavedArray<float, 3, 3, Stride> data(nr_entries, 3, 3, stride);
+		data.setZero();
+
+		// Every third lane is inactive and points outside of the array
+		int idx[Width];
+		for (int i = 0; i < Width; i++)
+			idx[i] = (masked && i % 3 == 2) ? 1000 + i : (7 * i + 3) % nr_entries;
+		const intN_t vindex = makeIndices(idx);
+
+		Eigen::Matrix<floatN_t, 3, 3> value;
+		for (int c = 0; c < 3; c++)
+		{
+			for (int r = 0; r < 3; r++)
+			{
+				VCL_ALIGN(64) float lanes[Width];
+				for (int i = 0; i < Width; i++)
+					lanes[i] = 10.0f * idx[i] + 3 * c + r;
+
+				Vcl::load(value(r, c), lanes);
+			}
+		}
+
+		if (masked)
+				Vcl::scatter(value, data, vindex, vindex < intN_t(nr_entries));
+		else
+			Vcl::scatter(value, data, vindex);
+
+		for (int e = 0; e < nr_entries; e++)
+		{
+			bool written = false;
+			for (int i = 0; i < Width; i++)
+				written = written || (idx[i] == e);
+
+			const Eigen::Matrix3f entry = data.template at<float>(e);
+			for (int c = 0; c < 3; c++)
+			{
+				for (int r = 0; r < 3; r++)
+				{
+					const float ref = written ? 10.0f * e + 3 * c + r : 0.0f;
+					EXPECT_EQ(ref, entry(r, c)) << Width << "-way scatter failed.";
+				}
+			}
+		}
+	}
+}
+
 // Tests the scalar scatter function.
 TEST(ScatterTest, Scalar)
 {
@@ -240,3 +313,70 @@ TEST(ScatterTest, Matrix)
 		EXPECT_TRUE(implies(out[i] != Eigen::Vector3f::Zero(), out[i] == mem[i])) << "16-way code failed.";
 	}
 }
+
+// Tests the scatter function on the supported layouts of interleaved arrays
+TEST(ScatterTest, InterleavedArray)
+{
+	for (bool masked : { false, true })
+	{
+		interleavedScatterTestStub<4, 0>(masked);
+		interleavedScatterTestStub<8, 0>(masked);
+		interleavedScatterTestStub<16, 0>(masked);
+
+		interleavedScatterTestStub<4, 4>(masked);
+		interleavedScatterTestStub<8, 8>(masked);
+		interleavedScatterTestStub<16, 16>(masked);
+
+		interleavedScatterTestStub<4, Vcl::Core::DynamicStride>(masked);
+		interleavedScatterTestStub<8, Vcl::Core::DynamicStride>(masked);
+		interleavedScatterTestStub<16, Vcl::Core::DynamicStride>(masked);
+
+		// Compile-time defined groups of entries
+		interleavedScatterTestStub<4, 8>(masked);
+		interleavedScatterTestStub<16, 4>(masked);
+
+		// Runtime defined groups of entries
+		interleavedScatterTestStub<8, Vcl::Core::DynamicStride>(masked, 4);
+	}
+}
+
+// Tests the masked scatter function
+TEST(ScatterTest, Masked)
+{
+	using Vcl::float4;
+	using Vcl::float8;
+	using Vcl::float16;
+
+	using Vcl::int4;
+	using Vcl::int8;
+	using Vcl::int16;
+
+	float out[32];
+
+	// Inactive lanes point outside of the memory
+	int4 idx4{ 3, 1000, 1, 15 };
+	memset(out, 0, sizeof(out));
+	Vcl::scatter(float4{ 1, 2, 3, 4 }, out, idx4, idx4 < int4(32));
+	EXPECT_EQ(1.0f, out[ 3]) << "4-way code failed.";
+	EXPECT_EQ(3.0f, out[ 1]) << "4-way code failed.";
+	EXPECT_EQ(4.0f, out[15]) << "4-way code failed.";
+
+	int8 idx8{ 3, 26, 1, 1000, 12, 29, -1000, 19 };
+	memset(out, 0, sizeof(out));
+	Vcl::scatter(float8{ 1, 2, 3, 4, 5, 6, 7, 8 }, out, idx8, idx8 >= int8(0) && idx8 < int8(32));
+	EXPECT_EQ(2.0f, out[26]) << "8-way code failed.";
+	EXPECT_EQ(5.0f, out[12]) << "8-way code failed.";
+	EXPECT_EQ(8.0f, out[19]) << "8-way code failed.";
+
+	int16 idx16{ 3, 26, 1, 15, 12, 29, 0, 19, 4, 8, 2, 1000, 25, 28, 1000, 7 };
+	memset(out, 0, sizeof(out));
+	Vcl::scatter(float16{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 }, out, idx16, idx16 < int16(32));
+	EXPECT_EQ(1.0f, out[ 3]) << "16-way code failed.";
+	EXPECT_EQ(11.0f, out[ 2]) << "16-way code failed.";
+	EXPECT_EQ(16.0f, out[ 7]) << "16-way code failed.";
+
+	float sum = 0;
+	for (float v : out)
+		sum += v;
+	EXPECT_EQ(136.0f - 12.0f - 15.0f, sum) << "16-way code wrote inactive lanes.";
+}
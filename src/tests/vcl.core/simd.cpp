@@ -32,6 +32,7 @@
 
 // C++ standard library
 #include <cmath>
+#include <type_traits>
 
 // Google test
 #include <gtest/gtest.h>
@@ -77,3 +78,79 @@ TEST(Simd, Rcp)
 
 	EXPECT_TRUE(all(equal(ref, res, float4(1e-5f)))) << "'rsqrt' failed.";
 }
+
+TEST(Simd, Transcendentals16)
+{
+	using Vcl::float16;
+
+	// Source data
+	float16 vec
+	{
+		0.1f, 0.25f, 0.5f, 0.75f, 1.0f, 1.5f, 2.0f, 2.5f,
+		3.0f, 4.0f, 5.0f, 7.5f, 10.0f, 12.5f, 15.0f, 20.0f
+	};
+	float16 unit
+	{
+		-0.95f, -0.8f, -0.6f, -0.4f, -0.25f, -0.1f, -0.01f, 0.0f,
+		0.01f, 0.1f, 0.25f, 0.4f, 0.6f, 0.8f, 0.9f, 0.95f
+	};
+
+	float16 vsin = sin(vec);
+	float16 vcos = cos(vec);
+	float16 vnsin = sin(-vec);
+	float16 vexp = exp(unit * 10.0f);
+	float16 vlog = log(vec);
+	float16 vacos = acos(unit);
+
+	for (int i = 0; i < 16; i++)
+	{
+		EXPECT_NEAR(std::sin(vec[i]), vsin[i], 1e-6f) << "'sin' failed.";
+		EXPECT_NEAR(std::cos(vec[i]), vcos[i], 1e-6f) << "'cos' failed.";
+		EXPECT_NEAR(std::sin(-vec[i]), vnsin[i], 1e-6f) << "'sin' failed.";
+		EXPECT_NEAR(1.0f, vexp[i] / std::exp(unit[i] * 10.0f), 1e-6f) << "'exp' failed.";
+		EXPECT_NEAR(std::log(vec[i]), vlog[i], 1e-6f) << "'log' failed.";
+		EXPECT_NEAR(std::acos(unit[i]), vacos[i], 1e-4f) << "'acos' failed.";
+	}
+}
+
+TEST(Simd, Double)
+{
+	using Vcl::double2;
+	using Vcl::double4;
+	using Vcl::double8;
+
+	static_assert(std::is_same<Vcl::VectorTypes<double2>::int_t, Vcl::int4>::value, "Two-wide doubles use the four-wide integers.");
+
+	using Vcl::all;
+	using Vcl::none;
+	using Vcl::rsqrt;
+	using Vcl::select;
+
+	using Vcl::Mathematics::equal;
+
+	// Source data
+	double4 vec4{ 11.3805, 6.10116, 11.6117, 11.8436 };
+	double8 vec8{ 11.3805, 6.10116, 11.6117, 11.8436, 0.5, 2.0, 4.0, 100.0 };
+
+	double4 res4 = rsqrt(vec4);
+	double8 res8 = rsqrt(vec8);
+	for (int i = 0; i < 4; i++)
+		EXPECT_NEAR(1.0 / std::sqrt(vec4[i]), res4[i], 1e-15) << "'rsqrt' failed.";
+	for (int i = 0; i < 8; i++)
+		EXPECT_NEAR(1.0 / std::sqrt(vec8[i]), res8[i], 1e-15) << "'rsqrt' failed.";
+
+	// Comparisons and selection
+	double8 sel = select(vec8 < double8(10.0), vec8, -vec8);
+	for (int i = 0; i < 8; i++)
+		EXPECT_EQ(vec8[i] < 10.0 ? vec8[i] : -vec8[i], sel[i]) << "'select' failed.";
+
+	EXPECT_TRUE(all(Vcl::abs(-vec4) == vec4)) << "'abs' failed.";
+	EXPECT_TRUE(none(vec8 < double8(0.0))) << "'<' failed.";
+	EXPECT_EQ(0.5, Vcl::min(vec8)) << "'min' failed.";
+	EXPECT_EQ(100.0, Vcl::max(vec8)) << "'max' failed.";
+
+	// Transcendentals
+	double4 vsin = sin(vec4);
+	for (int i = 0; i < 4; i++)
+		EXPECT_DOUBLE_EQ(std::sin(vec4[i]), vsin[i]) << "'sin' failed.";
+}
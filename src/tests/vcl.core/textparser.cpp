@@ -0,0 +1,144 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ Standard Library
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+// Include the relevant parts from the library
+#include <vcl/util/textparser.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+TEST(TextParserTest, ParseInt)
+{
+	using Vcl::Util::parseInt;
+
+	const std::vector<std::string> numbers = { "0", "7", "-12", "+345", "12345678", "123456789", "-2147483648", "2147483647", "0000000012" };
+	for (const auto& number : numbers)
+	{
+		int value = 0;
+		const char* end = parseInt(number.data(), number.data() + number.size(), value);
+		ASSERT_EQ(number.data() + number.size(), end) << number;
+		EXPECT_EQ(std::atoi(number.c_str()), value) << number;
+	}
+
+	// Parsing stops at the first non-digit
+	const std::string text = "42 17";
+	int value = 0;
+	EXPECT_EQ(text.data() + 2, parseInt(text.data(), text.data() + text.size(), value));
+	EXPECT_EQ(42, value);
+
+	const std::string invalid = "-x";
+	EXPECT_EQ(nullptr, parseInt(invalid.data(), invalid.data() + invalid.size(), value));
+}
+
+TEST(TextParserTest, ParseFloat)
+{
+	using Vcl::Util::parseFloat;
+
+	const std::vector<std::string> numbers =
+	{
+		"0", "-0.0", "1", "0.5", ".25", "3.", "-1.5e3", "2E-3", "1e+10", "123456789.123456789",
+		"0.000000000000000000001", "1.17549435e-38", "3.40282347e+38", "12345678901234567890123"
+	};
+	for (const auto& number : numbers)
+	{
+		float value = 0;
+		const char* end = parseFloat(number.data(), number.data() + number.size(), value);
+		ASSERT_EQ(number.data() + number.size(), end) << number;
+		EXPECT_EQ(std::strtof(number.c_str(), nullptr), value) << number;
+	}
+
+	// Incomplete exponents are not consumed
+	const std::string text = "1.5e";
+	float value = 0;
+	EXPECT_EQ(text.data() + 3, parseFloat(text.data(), text.data() + text.size(), value));
+	EXPECT_EQ(1.5f, value);
+
+	// Random numbers printed with full precision
+	std::mt19937 rnd;
+	std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+	bool equal = true;
+	for (int i = 0; i < 10000; i++)
+	{
+		char buffer[64];
+		const float ref = dist(rnd);
+		const int length = snprintf(buffer, sizeof(buffer), "%.9g", ref);
+
+		float parsed = 0;
+		parseFloat(buffer, buffer + length, parsed);
+		equal = equal && parsed == ref;
+	}
+	EXPECT_TRUE(equal);
+}
+
+TEST(TextParserTest, SplitLines)
+{
+	using namespace Vcl::Util;
+
+	std::string text;
+	for (int i = 0; i < 1000; i++)
+		text += "v " + std::to_string(i) + " 0.5 1.5\n";
+	text += "v 1000 0 0";
+
+	const auto chunks = splitLines({ text.data(), static_cast<ptrdiff_t>(text.size()) }, 7);
+	EXPECT_LE(chunks.size(), 7u);
+
+	// Chunks cover the text and end at line breaks
+	const char* expected_begin = text.data();
+	int nr_lines = 0;
+	int sum = 0;
+	for (const auto& chunk : chunks)
+	{
+		ASSERT_EQ(expected_begin, chunk.data());
+		expected_begin = chunk.data() + chunk.size();
+		if (expected_begin != text.data() + text.size())
+		{
+			EXPECT_EQ('\n', chunk[chunk.size() - 1]);
+		}
+
+		TextReader reader{ chunk };
+		while (reader.nextLine())
+		{
+			int index;
+			float x, y;
+			ASSERT_TRUE(reader.readKeyword("v"));
+			ASSERT_TRUE(reader.readInt(index));
+			ASSERT_TRUE(reader.readFloat(x));
+			ASSERT_TRUE(reader.readFloat(y));
+			sum += index;
+			nr_lines++;
+		}
+	}
+	EXPECT_EQ(text.data() + text.size(), expected_begin);
+	EXPECT_EQ(1001, nr_lines);
+	EXPECT_EQ(1000 * 1001 / 2, sum);
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <random>
+
+// Include the relevant parts from the library
+#include <vcl/core/simd/instructionset.h>
+#include <vcl/core/interleavedarray.h>
+#include <vcl/util/waveletnoise.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+TEST(InstructionSet, HostSupportsBaseline)
+{
+	using Vcl::InstructionSet;
+
+	const InstructionSet compiled = Vcl::compiledInstructionSet();
+	const InstructionSet host = Vcl::hostInstructionSet();
+
+	// The tests could not run if the host did not support the configured instruction set
+	if (compiled != InstructionSet::NEON)
+	{
+		EXPECT_GE(static_cast<int>(host), static_cast<int>(compiled)) << "Host: " << Vcl::name(host) << ", compiled: " << Vcl::name(compiled);
+	}
+
+	Vcl::setInstructionSetLimit(InstructionSet::SSE2);
+	EXPECT_LE(static_cast<int>(Vcl::activeInstructionSet()), static_cast<int>(InstructionSet::SSE2));
+
+	Vcl::resetInstructionSetLimit();
+	EXPECT_EQ(host, Vcl::activeInstructionSet());
+}
+
+template<int N>
+void testBatchEvaluation()
+{
+	const size_t nr_points = 101;
+
+	std::mt19937 rng{ 5489 };
+	std::uniform_real_distribution<float> d{ -2.0f * N, 2.0f * N };
+
+	Vcl::Core::InterleavedArray<float, 3, 1, -1> points(nr_points);
+	for (int i = 0; i < (int) nr_points; i++)
+		points.at<float>(i) << d(rng), d(rng), d(rng);
+
+	Vcl::Util::WaveletNoise<N> noise;
+
+	const Vcl::InstructionSet isas[] = { Vcl::InstructionSet::Scalar, Vcl::InstructionSet::AVX2, Vcl::InstructionSet::AVX512 };
+	for (auto isa : isas)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Vcl::Core::InterleavedArray<float, 1, 1, -1> values(nr_points);
+		noise.evaluate(points, values);
+
+		for (int i = 0; i < (int) nr_points; i++)
+		{
+			const float p[3] = { points.at<float>(i)(0), points.at<float>(i)(1), points.at<float>(i)(2) };
+			EXPECT_NEAR(noise.evaluate(p), values.at<float>(i)(0), 1e-5f) << Vcl::name(isa) << ", point " << i;
+		}
+	}
+	Vcl::resetInstructionSetLimit();
+}
+
+TEST(WaveletNoise, BatchEvaluation32)
+{
+	testBatchEvaluation<32>();
+}
+
+TEST(WaveletNoise, BatchEvaluation64)
+{
+	testBatchEvaluation<64>();
+}
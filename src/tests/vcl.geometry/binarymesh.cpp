@@ -0,0 +1,200 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Include the relevant parts from the library
+#include <vcl/geometry/io/serialiser_binary_mesh.h>
+#include <vcl/geometry/meshfactory.h>
+#include <vcl/geometry/tetramesh.h>
+#include <vcl/geometry/trimesh.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+TEST(BinaryMeshTest, TetraMeshRoundTrip)
+{
+	using namespace Vcl::Geometry;
+
+	const std::string path = "BinaryMeshTest.TetraMesh.vclmesh";
+
+	auto cubes = MeshFactory<TetraMesh>::createHomogenousCubes(3, 2, 2);
+	float init = 0;
+	auto mass = cubes->addVolumeProperty<float>("Mass", init);
+	for (unsigned int i = 0; i < cubes->nrVolumes(); i++)
+		(*mass)[i] = float(i);
+
+	IO::BinaryMeshSerialiser serialiser;
+	ASSERT_TRUE(serialiser.store(*cubes, path));
+
+	// Custom properties are declared before loading
+	TetraMesh mesh;
+	auto loaded_mass = mesh.addVolumeProperty<float>("Mass", init);
+	ASSERT_TRUE(serialiser.load(mesh, path));
+
+	ASSERT_EQ(cubes->nrVertices(), mesh.nrVertices());
+	ASSERT_EQ(cubes->nrVolumes(), mesh.nrVolumes());
+
+	bool equal = true;
+	for (unsigned int i = 0; i < mesh.nrVertices(); i++)
+		equal = equal && mesh.vertices()[i] == cubes->vertices()[i];
+	for (unsigned int i = 0; i < mesh.nrVolumes(); i++)
+	{
+		const auto& a = mesh.volumes()[i];
+		const auto& b = cubes->volumes()[i];
+		for (int j = 0; j < 4; j++)
+			equal = equal && a[j] == b[j];
+		equal = equal && (*loaded_mass)[i] == float(i);
+	}
+	EXPECT_TRUE(equal);
+
+	// Modifications of the mapped data are not written to the file
+	(*loaded_mass)[0] = 42;
+
+	// Growing moves the data out of the mapping
+	loaded_mass->push_back(7);
+	EXPECT_EQ(42, (*loaded_mass)[0]);
+	EXPECT_EQ(7, (*loaded_mass)[static_cast<int>(mesh.nrVolumes())]);
+
+	TetraMesh reloaded;
+	auto reloaded_mass = reloaded.addVolumeProperty<float>("Mass", init);
+	ASSERT_TRUE(serialiser.load(reloaded, path));
+	EXPECT_EQ(0, (*reloaded_mass)[0]);
+	EXPECT_EQ(1, (*reloaded_mass)[1]);
+
+	// Copies do not depend on the mapping
+	TetraMesh copy{ reloaded };
+	EXPECT_EQ(cubes->vertices()[1], copy.vertices()[1]);
+
+	std::remove(path.c_str());
+}
+
+TEST(BinaryMeshTest, TriMeshRoundTrip)
+{
+	using namespace Vcl::Geometry;
+
+	const std::string path = "BinaryMeshTest.TriMesh.vclmesh";
+
+	auto sphere = TriMeshFactory::createSphere({ 0, 0, 0 }, 1, 8, 8, false);
+
+	IO::BinaryMeshSerialiser serialiser;
+	ASSERT_TRUE(serialiser.store(*sphere, path));
+
+	// Properties which are not declared are skipped
+	TriMesh mesh;
+	ASSERT_TRUE(serialiser.load(mesh, path));
+	ASSERT_EQ(sphere->nrVertices(), mesh.nrVertices());
+	ASSERT_EQ(sphere->nrFaces(), mesh.nrFaces());
+
+	bool equal = true;
+	for (unsigned int i = 0; i < mesh.nrVertices(); i++)
+		equal = equal && mesh.vertices()[i] == sphere->vertices()[i];
+	for (unsigned int i = 0; i < mesh.nrFaces(); i++)
+	{
+		const auto& a = mesh.faces()[i];
+		const auto& b = sphere->faces()[i];
+		for (int j = 0; j < 3; j++)
+			equal = equal && a[j] == b[j];
+	}
+	EXPECT_TRUE(equal);
+
+	// Files of other mesh types are rejected
+	TetraMesh tetra_mesh;
+	EXPECT_FALSE(serialiser.load(tetra_mesh, path));
+	EXPECT_FALSE(serialiser.load(mesh, "BinaryMeshTest.Missing.vclmesh"));
+
+	std::remove(path.c_str());
+}
+
+TEST(BinaryMeshTest, MismatchingElementType)
+{
+	using namespace Vcl::Geometry;
+
+	const std::string path = "BinaryMeshTest.Mismatch.vclmesh";
+
+	auto cubes = MeshFactory<TetraMesh>::createHomogenousCubes(1, 1, 1);
+	float init = 1;
+	cubes->addVolumeProperty<float>("Mass", init);
+
+	IO::BinaryMeshSerialiser serialiser;
+	ASSERT_TRUE(serialiser.store(*cubes, path));
+
+	// Properties of the same size, but a different type are not reinterpreted
+	TetraMesh mesh;
+	int int_init = 0;
+	mesh.addVolumeProperty<int>("Mass", int_init);
+	EXPECT_FALSE(serialiser.load(mesh, path));
+	EXPECT_EQ(0u, mesh.nrVertices());
+
+	std::remove(path.c_str());
+}
+
+TEST(BinaryMeshTest, ElementTypes)
+{
+	using namespace Vcl::Geometry;
+
+	VCL_CREATEID(Index, unsigned int);
+
+	EXPECT_EQ("f32[3x1]", (Property<Eigen::Vector3f, Index>{ "Positions" }.elementType()));
+	EXPECT_EQ("id:u32[4]", (Property<std::array<Index, 4>, Index>{ "Volumes" }.elementType()));
+	EXPECT_EQ("i64", (Property<int64_t, Index>{ "Counts" }.elementType()));
+
+	EXPECT_TRUE((Property<Eigen::Vector3f, Index>{ "Positions" }.isBitwiseSerialisable()));
+	EXPECT_FALSE((Property<std::string, Index>{ "Names" }.isBitwiseSerialisable()));
+	EXPECT_FALSE((Property<Eigen::VectorXf, Index>{ "Samples" }.isBitwiseSerialisable()));
+}
+
+TEST(BinaryMeshTest, CorruptFile)
+{
+	using namespace Vcl::Geometry;
+
+	const std::string path = "BinaryMeshTest.Corrupt.vclmesh";
+
+	auto cubes = MeshFactory<TetraMesh>::createHomogenousCubes(1, 1, 1);
+	IO::BinaryMeshSerialiser serialiser;
+	ASSERT_TRUE(serialiser.store(*cubes, path));
+
+	// Unknown version
+	{
+		std::fstream file{ path, std::ios_base::binary | std::ios_base::in | std::ios_base::out };
+		const uint32_t version = IO::BinaryMeshSerialiser::Version + 1;
+		file.seekp(8);
+		file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	}
+
+	TetraMesh mesh;
+	EXPECT_FALSE(serialiser.load(mesh, path));
+	EXPECT_EQ(0u, mesh.nrVertices());
+
+	std::remove(path.c_str());
+}
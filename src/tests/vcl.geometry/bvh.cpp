@@ -0,0 +1,341 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/geometry/bvh.h>
+#include <vcl/geometry/meshbvh.h>
+#include <vcl/geometry/meshfactory.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	// Reference ray-triangle test
+	float intersectTriangle(const Eigen::Vector3f& o, const Eigen::Vector3f& d, const Eigen::Vector3f& a, const Eigen::Vector3f& b, const Eigen::Vector3f& c)
+	{
+		const Eigen::Vector3f n = (b - a).cross(c - a);
+		const float denom = n.dot(d);
+		if (denom == 0)
+			return std::numeric_limits<float>::infinity();
+
+		const float t = n.dot(a - o) / denom;
+		if (t < 0)
+			return std::numeric_limits<float>::infinity();
+
+		const Eigen::Vector3f p = o + t * d;
+		if (n.dot((b - a).cross(p - a)) < 0 || n.dot((c - b).cross(p - b)) < 0 || n.dot((a - c).cross(p - c)) < 0)
+			return std::numeric_limits<float>::infinity();
+
+		return t;
+	}
+
+	Eigen::Vector3f randomDirection(std::mt19937& rnd)
+	{
+		std::normal_distribution<float> dist;
+		Eigen::Vector3f d{ dist(rnd), dist(rnd), dist(rnd) };
+		return d.normalized();
+	}
+
+	template<int Width>
+	void testTriMeshClosestHit(Vcl::Geometry::BvhBuilder builder)
+	{
+		using namespace Vcl::Geometry;
+
+		const auto sphere = TriMeshFactory::createSphere({ 0, 0, 0 }, 1, 20, 30, false);
+		const MeshBvh<TriMesh, Width> bvh{ *sphere, builder };
+		EXPECT_EQ(sphere->nrFaces(), bvh.hierarchy().nrPrimitives());
+
+		std::mt19937 rnd{ 5489u };
+		std::uniform_real_distribution<float> pos{ -2, 2 };
+		for (int r = 0; r < 500; r++)
+		{
+			const Eigen::Vector3f o{ pos(rnd), pos(rnd), pos(rnd) };
+			const Eigen::Vector3f d = randomDirection(rnd);
+			const Ray<float, 3> ray{ o, d };
+
+			float t_ref = std::numeric_limits<float>::infinity();
+			for (unsigned int f = 0; f < sphere->nrFaces(); f++)
+			{
+				const auto& face = sphere->faces()[f];
+				t_ref = std::min(t_ref, intersectTriangle(o, d, sphere->vertices()[face[0]], sphere->vertices()[face[1]], sphere->vertices()[face[2]]));
+			}
+
+			const RayHit hit = bvh.closestHit(ray);
+			EXPECT_EQ(t_ref < std::numeric_limits<float>::infinity(), hit.isValid()) << "Ray " << r;
+			EXPECT_EQ(hit.isValid(), bvh.anyHit(ray)) << "Ray " << r;
+			if (hit.isValid() && t_ref < std::numeric_limits<float>::infinity())
+			{
+				EXPECT_NEAR(t_ref, hit.t, 1e-4f) << "Ray " << r;
+
+				// The reported face is hit at the reported distance
+				const auto& face = sphere->faces()[hit.primitive];
+				EXPECT_NEAR(hit.t, intersectTriangle(o, d, sphere->vertices()[face[0]], sphere->vertices()[face[1]], sphere->vertices()[face[2]]), 1e-4f);
+			}
+
+			// Limiting the ray excludes hits further away
+			if (hit.isValid())
+			{
+				EXPECT_FALSE(bvh.closestHit(ray, 0.5f * hit.t).isValid());
+				EXPECT_FALSE(bvh.anyHit(ray, 0.5f * hit.t));
+			}
+		}
+	}
+
+	template<int Width>
+	void testTetraMeshClosestHit(Vcl::Geometry::BvhBuilder builder)
+	{
+		using namespace Vcl::Geometry;
+
+		// Cubes filling [0, 4]^3
+		const auto cubes = MeshFactory<TetraMesh>::createHomogenousCubes(4, 4, 4);
+		const MeshBvh<TetraMesh, Width> bvh{ *cubes, builder };
+		EXPECT_EQ(cubes->nrVolumes(), bvh.hierarchy().nrPrimitives());
+
+		const Eigen::AlignedBox3f domain{ Eigen::Vector3f::Zero(), Eigen::Vector3f::Constant(4) };
+
+		std::mt19937 rnd{ 5489u };
+		std::uniform_real_distribution<float> pos{ -2, 6 };
+		std::uniform_real_distribution<float> inner{ 0.1f, 3.9f };
+		for (int r = 0; r < 500; r++)
+		{
+			// Rays aimed into the domain enter it at the domain boundary
+			const Eigen::Vector3f o{ pos(rnd), pos(rnd), pos(rnd) };
+			const Eigen::Vector3f target{ inner(rnd), inner(rnd), inner(rnd) };
+			const Ray<float, 3> ray{ o, (target - o).normalized() };
+
+			float t_ref = 0;
+			for (int i = 0; i < 3; i++)
+			{
+				const float t0 = (domain.min()[i] - o[i]) * ray.invDirection()[i];
+				const float t1 = (domain.max()[i] - o[i]) * ray.invDirection()[i];
+				t_ref = std::max(t_ref, std::min(t0, t1));
+			}
+
+			const RayHit hit = bvh.closestHit(ray);
+			ASSERT_TRUE(hit.isValid()) << "Ray " << r;
+			EXPECT_NEAR(t_ref, hit.t, 1e-4f) << "Ray " << r;
+			EXPECT_TRUE(bvh.anyHit(ray)) << "Ray " << r;
+
+			// The entry point lies on the reported volume
+			Eigen::AlignedBox3f box;
+			for (const auto& v : cubes->volumes()[hit.primitive])
+				box.extend(cubes->vertices()[v]);
+			const Eigen::Vector3f p = o + hit.t * ray.direction();
+			EXPECT_LT(box.exteriorDistance(p), 1e-4f) << "Ray " << r;
+
+			// Rays pointing away from the domain miss it
+			const Ray<float, 3> away{ o, (o - target).normalized() };
+			if (!domain.contains(o))
+			{
+				EXPECT_FALSE(bvh.closestHit(away).isValid()) << "Ray " << r;
+				EXPECT_FALSE(bvh.anyHit(away)) << "Ray " << r;
+			}
+		}
+	}
+
+	void testStructure(Vcl::Geometry::BvhBuilder builder)
+	{
+		using namespace Vcl::Geometry;
+
+		std::mt19937 rnd{ 5489u };
+		std::uniform_real_distribution<float> pos{ -10, 10 };
+		std::uniform_real_distribution<float> size{ 0, 1 };
+
+		// Include duplicated boxes, which cannot be separated by the SAH
+		std::vector<Eigen::AlignedBox3f> boxes;
+		for (int i = 0; i < 10000; i++)
+		{
+			const Eigen::Vector3f p{ pos(rnd), pos(rnd), pos(rnd) };
+			const Eigen::Vector3f s{ size(rnd), size(rnd), size(rnd) };
+			boxes.emplace_back(p, p + s);
+		}
+		boxes.insert(boxes.end(), 100, boxes.front());
+
+		Bvh<8> bvh{ boxes, builder };
+		ASSERT_EQ(boxes.size(), bvh.nrPrimitives());
+
+		// Each primitive is referenced exactly once
+		std::vector<uint32_t> indices = bvh.indices();
+		std::sort(indices.begin(), indices.end());
+		for (uint32_t i = 0; i < indices.size(); i++)
+			EXPECT_EQ(i, indices[i]);
+
+		// The root encloses all primitives
+		Eigen::AlignedBox3f all;
+		for (const auto& box : boxes)
+			all.extend(box);
+		EXPECT_TRUE(bvh.bounds().isApprox(all));
+
+		// Each slot encloses the primitives or the node below it
+		for (const auto& node : bvh.nodes())
+		{
+			for (int i = 0; i < 8; i++)
+			{
+				if (node.child[i] == Bvh<8>::InvalidNode)
+					continue;
+
+				const Eigen::AlignedBox3f slot
+				{
+					Eigen::Vector3f{ node.minX[i], node.minY[i], node.minZ[i] },
+					Eigen::Vector3f{ node.maxX[i], node.maxY[i], node.maxZ[i] }
+				};
+				if (node.count[i] > 0)
+				{
+					for (uint32_t p = node.child[i]; p < node.child[i] + node.count[i]; p++)
+						EXPECT_TRUE(slot.contains(boxes[bvh.indices()[p]]));
+				}
+				else
+				{
+					EXPECT_TRUE(slot.contains(bvh.bounds(node.child[i])));
+				}
+			}
+		}
+
+		// Box queries find the same primitives as a linear search
+		for (int q = 0; q < 100; q++)
+		{
+			const Eigen::Vector3f p{ pos(rnd), pos(rnd), pos(rnd) };
+			const Eigen::AlignedBox3f query{ p, p + Eigen::Vector3f::Constant(2) };
+
+			std::vector<uint32_t> ref;
+			for (uint32_t i = 0; i < boxes.size(); i++)
+			{
+				if (query.intersects(boxes[i]))
+					ref.push_back(i);
+			}
+
+			std::vector<uint32_t> found;
+			bvh.overlapping(query, [&boxes, &query, &found](uint32_t i)
+			{
+				if (query.intersects(boxes[i]))
+					found.push_back(i);
+			});
+			std::sort(found.begin(), found.end());
+			EXPECT_EQ(ref, found);
+		}
+	}
+}
+
+TEST(BvhTest, Empty)
+{
+	using namespace Vcl::Geometry;
+
+	const std::vector<Eigen::AlignedBox3f> boxes;
+	Bvh<8> bvh{ boxes };
+	EXPECT_TRUE(bvh.empty());
+
+	const Ray<float, 3> ray{ Eigen::Vector3f::Zero(), Eigen::Vector3f::UnitX() };
+	EXPECT_FALSE(bvh.closestHit(ray, 1, [](uint32_t, float&) { return true; }).isValid());
+	EXPECT_FALSE(bvh.anyHit(ray, 1, [](uint32_t, float&) { return true; }));
+}
+
+TEST(BvhTest, Structure)
+{
+	testStructure(Vcl::Geometry::BvhBuilder::Sah);
+}
+
+TEST(BvhTest, StructureMorton)
+{
+	testStructure(Vcl::Geometry::BvhBuilder::Morton);
+}
+
+TEST(BvhTest, TriMeshClosestHit4)
+{
+	testTriMeshClosestHit<4>(Vcl::Geometry::BvhBuilder::Sah);
+}
+
+TEST(BvhTest, TriMeshClosestHit8)
+{
+	testTriMeshClosestHit<8>(Vcl::Geometry::BvhBuilder::Sah);
+}
+
+TEST(BvhTest, TriMeshClosestHitMorton)
+{
+	testTriMeshClosestHit<8>(Vcl::Geometry::BvhBuilder::Morton);
+}
+
+TEST(BvhTest, TetraMeshClosestHit4)
+{
+	testTetraMeshClosestHit<4>(Vcl::Geometry::BvhBuilder::Sah);
+}
+
+TEST(BvhTest, TetraMeshClosestHit8)
+{
+	testTetraMeshClosestHit<8>(Vcl::Geometry::BvhBuilder::Sah);
+}
+
+TEST(BvhTest, TetraMeshClosestHitMorton)
+{
+	testTetraMeshClosestHit<8>(Vcl::Geometry::BvhBuilder::Morton);
+}
+
+TEST(BvhTest, Refit)
+{
+	using namespace Vcl::Geometry;
+
+	auto sphere = TriMeshFactory::createSphere({ 0, 0, 0 }, 1, 20, 30, false);
+	MeshBvh<TriMesh, 8> bvh{ *sphere };
+
+	// Move the sphere along the x-axis
+	auto vertices = sphere->vertices();
+	Eigen::AlignedBox3f expected;
+	for (int v = 0; v < static_cast<int>(sphere->nrVertices()); v++)
+	{
+		vertices[v] += Eigen::Vector3f{ 5, 0, 0 };
+		expected.extend(vertices[v]);
+	}
+	bvh.refit();
+	EXPECT_TRUE(bvh.hierarchy().bounds().isApprox(expected));
+
+	const Ray<float, 3> ray{ Eigen::Vector3f::Zero(), Eigen::Vector3f::UnitX() };
+	const RayHit hit = bvh.closestHit(ray);
+	ASSERT_TRUE(hit.isValid());
+	EXPECT_NEAR(4.0f, hit.t, 1e-2f);
+
+	// The refitted hierarchy answers queries like a rebuilt one
+	const MeshBvh<TriMesh, 8> rebuilt{ *sphere };
+	std::mt19937 rnd{ 5489u };
+	for (int r = 0; r < 100; r++)
+	{
+		const Ray<float, 3> random_ray{ Eigen::Vector3f{ 5, 0, 0 } + 2 * randomDirection(rnd), randomDirection(rnd) };
+		const RayHit a = bvh.closestHit(random_ray);
+		const RayHit b = rebuilt.closestHit(random_ray);
+		EXPECT_EQ(a.isValid(), b.isValid());
+		if (a.isValid() && b.isValid())
+		{
+			EXPECT_NEAR(a.t, b.t, 1e-5f);
+		}
+	}
+}
@@ -0,0 +1,150 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <limits>
+#include <random>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/geometry/closestpointquery.h>
+#include <vcl/geometry/distancePoint3Triangle3.h>
+#include <vcl/geometry/meshfactory.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	// Closest distance by testing all faces
+	float bruteForceDistance(const Vcl::Geometry::TriMesh& mesh, const Eigen::Vector3f& p)
+	{
+		using namespace Vcl::Geometry;
+
+		float dist = std::numeric_limits<float>::infinity();
+		for (unsigned int f = 0; f < mesh.nrFaces(); f++)
+		{
+			const auto& face = mesh.faces()[f];
+			const Triangle<float, 3> tri{ mesh.vertices()[face[0]], mesh.vertices()[face[1]], mesh.vertices()[face[2]] };
+			dist = std::min(dist, distance(tri, p));
+		}
+		return dist;
+	}
+
+	Eigen::Vector3f closestPoint(const Vcl::Geometry::TriMesh& mesh, const Vcl::Geometry::ClosestPoint& result)
+	{
+		const auto& face = mesh.faces()[result.face];
+		return
+			result.barycentric[0] * mesh.vertices()[face[0]] +
+			result.barycentric[1] * mesh.vertices()[face[1]] +
+			result.barycentric[2] * mesh.vertices()[face[2]];
+	}
+
+	std::vector<Eigen::Vector3f> randomPoints(size_t count, float extent)
+	{
+		std::mt19937 rnd{ 5489u };
+		std::uniform_real_distribution<float> pos{ -extent, extent };
+
+		std::vector<Eigen::Vector3f> points(count);
+		for (auto& p : points)
+			p = { pos(rnd), pos(rnd), pos(rnd) };
+		return points;
+	}
+}
+
+TEST(ClosestPointQuery, Sphere)
+{
+	using namespace Vcl::Geometry;
+
+	const auto sphere = TriMeshFactory::createSphere({ 0, 0, 0 }, 1, 20, 30, false);
+	const ClosestPointQuery query{ *sphere };
+
+	const auto points = randomPoints(1000, 2);
+	std::vector<ClosestPoint> results(points.size());
+	query.query(points, results);
+
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		const auto& result = results[i];
+		ASSERT_TRUE(result.isValid()) << "Point " << i;
+		EXPECT_NEAR(bruteForceDistance(*sphere, points[i]), result.distance, 1e-5f) << "Point " << i;
+
+		// The barycentric coordinates describe the closest point
+		EXPECT_NEAR(1.0f, result.barycentric.sum(), 1e-5f) << "Point " << i;
+		EXPECT_NEAR(result.distance, (closestPoint(*sphere, result) - points[i]).norm(), 1e-4f) << "Point " << i;
+
+		// Single queries yield the same result
+		const ClosestPoint single = query.query(points[i]);
+		EXPECT_EQ(result.face, single.face);
+		EXPECT_EQ(result.distance, single.distance);
+	}
+}
+
+TEST(ClosestPointQuery, MaxDistance)
+{
+	using namespace Vcl::Geometry;
+
+	const auto sphere = TriMeshFactory::createSphere({ 0, 0, 0 }, 1, 20, 30, false);
+	const ClosestPointQuery query{ *sphere, BvhBuilder::Morton };
+
+	const float max_distance = 0.25f;
+	const auto points = randomPoints(1000, 2);
+	std::vector<ClosestPoint> results(points.size());
+	query.query(points, results, max_distance);
+
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		const float ref = bruteForceDistance(*sphere, points[i]);
+		if (ref <= max_distance)
+		{
+			ASSERT_TRUE(results[i].isValid()) << "Point " << i;
+			EXPECT_NEAR(ref, results[i].distance, 1e-5f) << "Point " << i;
+		}
+		else
+		{
+			EXPECT_FALSE(results[i].isValid()) << "Point " << i;
+		}
+	}
+}
+
+TEST(ClosestPointQuery, Refit)
+{
+	using namespace Vcl::Geometry;
+
+	auto sphere = TriMeshFactory::createSphere({ 0, 0, 0 }, 1, 20, 30, false);
+	ClosestPointQuery query{ *sphere };
+
+	auto vertices = sphere->vertices();
+	for (int v = 0; v < static_cast<int>(sphere->nrVertices()); v++)
+		vertices[v] *= 2.0f;
+	query.refit();
+
+	const auto points = randomPoints(100, 3);
+	for (const auto& p : points)
+		EXPECT_NEAR(bruteForceDistance(*sphere, p), query.query(p).distance, 1e-5f);
+}
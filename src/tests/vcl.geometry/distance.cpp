@@ -32,6 +32,7 @@
 #include <vector>
 
 // Include the relevant parts from the library
+#include <vcl/core/simd/instructionset.h>
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/interleavedarray.h>
 #include <vcl/geometry/distancePoint3Triangle3.h>
@@ -89,12 +90,12 @@ TEST(PointTriangleDistance, Simple)
 
 	// Results
 	std::vector<float>  d0(nr_problems);
-	std::vector<real_t> d1(nr_problems / width);
+	std::vector<real_t, Eigen::aligned_allocator<real_t>> d1(nr_problems / width);
 
 	std::vector<float>  s0(nr_problems);
-	std::vector<real_t> s1(nr_problems / width);
+	std::vector<real_t, Eigen::aligned_allocator<real_t>> s1(nr_problems / width);
 	std::vector<float>  t0(nr_problems);
-	std::vector<real_t> t1(nr_problems / width);
+	std::vector<real_t, Eigen::aligned_allocator<real_t>> t1(nr_problems / width);
 
 	// Initialize data
 	for (int i = 0; i < (int) nr_problems; i++)
@@ -132,6 +133,53 @@ TEST(PointTriangleDistance, Simple)
 	}
 }
 
+TEST(PointTriangleDistance, Batch)
+{
+	using Vcl::Geometry::distance;
+	using Vcl::Mathematics::equal;
+
+	// Not a multiple of any vector width
+	size_t nr_problems = 83;
+
+	std::mt19937 rng{ 5489 };
+	std::uniform_real_distribution<float> d{ -1.0f, 1.0f };
+
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> triangles(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 1, -1> points(nr_problems);
+	for (int i = 0; i < (int) nr_problems; i++)
+	{
+		triangles.at<float>(i) << d(rng), d(rng), d(rng),
+		                          d(rng), d(rng), d(rng),
+		                          d(rng), d(rng), d(rng);
+		points.at<float>(i) << d(rng), d(rng), d(rng);
+	}
+
+	const Vcl::InstructionSet isas[] = { Vcl::InstructionSet::Scalar, Vcl::InstructionSet::AVX, Vcl::InstructionSet::AVX512 };
+	for (auto isa : isas)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Vcl::Core::InterleavedArray<float, 1, 1, -1> distances(nr_problems);
+		Vcl::Core::InterleavedArray<float, 3, 1, -1> barycentric(nr_problems);
+		distance(triangles, points, distances, &barycentric);
+
+		for (int i = 0; i < (int) nr_problems; i++)
+		{
+			const Eigen::Matrix3f tri = triangles.at<float>(i);
+			const Eigen::Vector3f p = points.at<float>(i);
+
+			std::array<float, 3> st;
+			float ref = distanceEberly<float>(tri.col(0), tri.col(1), tri.col(2), p, &st);
+
+			EXPECT_TRUE(equal(ref, distances.at<float>(i)(0), 1e-4f)) << Vcl::name(isa) << ", distance differ: " << i;
+			EXPECT_TRUE(equal(st[1], barycentric.at<float>(i)(1), 1e-4f)) << Vcl::name(isa) << ", S differ: " << i;
+			EXPECT_TRUE(equal(st[2], barycentric.at<float>(i)(2), 1e-4f)) << Vcl::name(isa) << ", T differ: " << i;
+			EXPECT_TRUE(equal(1.0f - st[1] - st[2], barycentric.at<float>(i)(0), 1e-4f)) << Vcl::name(isa) << ", U differ: " << i;
+		}
+	}
+	Vcl::resetInstructionSetLimit();
+}
+
 TEST(TriangleTriangleDistance, Simple)
 {
 	using namespace Vcl::Geometry;
@@ -0,0 +1,188 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <cmath>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/geometry/marchingcubes.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	// Samples of the signed distance of a sphere of radius 1 around the origin
+	std::vector<float> sampleSphere(const Eigen::Vector3ui& dim, const Eigen::Vector3f& origin, float h)
+	{
+		std::vector<float> values;
+		values.reserve(dim.x() * dim.y() * dim.z());
+		for (unsigned int k = 0; k < dim.z(); k++)
+			for (unsigned int j = 0; j < dim.y(); j++)
+				for (unsigned int i = 0; i < dim.x(); i++)
+					values.push_back((origin + h * Eigen::Vector3f(i, j, k)).norm() - 1);
+		return values;
+	}
+
+	// Every edge of a closed, consistently oriented surface is used once in each direction
+	void expectClosedSurface(const Vcl::Geometry::TriMesh& mesh)
+	{
+		std::map<std::pair<unsigned int, unsigned int>, int> edges;
+		for (unsigned int f = 0; f < mesh.nrFaces(); f++)
+		{
+			const auto& face = mesh.faces()[f];
+			for (int e = 0; e < 3; e++)
+				edges[{ face[e].id(), face[(e + 1) % 3].id() }]++;
+		}
+
+		for (const auto& edge : edges)
+		{
+			EXPECT_EQ(1, edge.second);
+			const auto opposite = edges.find({ edge.first.second, edge.first.first });
+			EXPECT_TRUE(opposite != edges.end() && opposite->second == 1);
+		}
+	}
+
+	float signedVolume(const Vcl::Geometry::TriMesh& mesh)
+	{
+		float volume = 0;
+		for (unsigned int f = 0; f < mesh.nrFaces(); f++)
+		{
+			const auto& face = mesh.faces()[f];
+			const Eigen::Vector3f& a = mesh.vertices()[face[0]];
+			const Eigen::Vector3f& b = mesh.vertices()[face[1]];
+			const Eigen::Vector3f& c = mesh.vertices()[face[2]];
+			volume += a.dot(b.cross(c)) / 6;
+		}
+		return volume;
+	}
+}
+
+TEST(MarchingCubes, Sphere)
+{
+	using namespace Vcl::Geometry;
+
+	const Eigen::Vector3ui dim{ 33, 31, 29 };
+	const Eigen::Vector3f origin{ -1.6f, -1.5f, -1.4f };
+	const float h = 0.1f;
+	const auto values = sampleSphere(dim, origin, h);
+
+	const MarchingCubes mc{ dim, origin, Eigen::Vector3f::Constant(h) };
+	const auto sphere = mc.extract(values, 0);
+	ASSERT_GT(sphere->nrFaces(), 0u);
+
+	for (unsigned int v = 0; v < sphere->nrVertices(); v++)
+		EXPECT_NEAR(1.0f, sphere->vertices()[v].norm(), 0.01f);
+
+	// Normals point outwards, towards the larger values
+	expectClosedSurface(*sphere);
+	EXPECT_NEAR(4.0f / 3.0f * 3.14159265f, signedVolume(*sphere), 0.05f);
+}
+
+TEST(MarchingCubes, Streaming)
+{
+	using namespace Vcl::Geometry;
+
+	const Eigen::Vector3ui dim{ 24, 25, 26 };
+	const Eigen::Vector3f origin{ -1.2f, -1.2f, -1.2f };
+	const auto values = sampleSphere(dim, origin, 0.1f);
+
+	const MarchingCubes mc{ dim, origin, Eigen::Vector3f::Constant(0.1f) };
+	const auto ref = mc.extract(values, 0.05f);
+
+	std::vector<Eigen::Vector3f> vertices;
+	std::vector<std::array<uint32_t, 3>> triangles;
+	uint32_t previous_first = 0;
+	int nr_slabs = 0;
+	mc.extract(values, 0.05f, 4, [&](const IsoSurfaceSlab& slab)
+	{
+		EXPECT_EQ(vertices.size(), slab.firstVertex);
+		for (const auto& tri : slab.triangles)
+		{
+			for (uint32_t v : tri)
+			{
+				// Only vertices of the current and the previous slab are referenced
+				EXPECT_LE(previous_first, v);
+				EXPECT_LT(v, slab.firstVertex + slab.vertices.size());
+			}
+		}
+
+		vertices.insert(vertices.end(), slab.vertices.begin(), slab.vertices.end());
+		triangles.insert(triangles.end(), slab.triangles.begin(), slab.triangles.end());
+		previous_first = slab.firstVertex;
+		nr_slabs++;
+	});
+	EXPECT_EQ(7, nr_slabs);
+
+	ASSERT_EQ(ref->nrVertices(), vertices.size());
+	ASSERT_EQ(ref->nrFaces(), triangles.size());
+	for (unsigned int v = 0; v < ref->nrVertices(); v++)
+		EXPECT_EQ(ref->vertices()[v], vertices[v]);
+	for (unsigned int f = 0; f < ref->nrFaces(); f++)
+	{
+		const auto& face = ref->faces()[f];
+		EXPECT_EQ(face[0].id(), triangles[f][0]);
+		EXPECT_EQ(face[1].id(), triangles[f][1]);
+		EXPECT_EQ(face[2].id(), triangles[f][2]);
+	}
+}
+
+TEST(MarchingCubes, Noise)
+{
+	using namespace Vcl::Geometry;
+
+	// Random values enclosed by a boundary above the iso-value
+	const Eigen::Vector3ui dim{ 20, 21, 22 };
+	std::mt19937 rnd{ 5489u };
+	std::uniform_real_distribution<float> noise{ -1, 1 };
+
+	std::vector<float> values;
+	for (unsigned int k = 0; k < dim.z(); k++)
+		for (unsigned int j = 0; j < dim.y(); j++)
+			for (unsigned int i = 0; i < dim.x(); i++)
+			{
+				const bool boundary =
+					i == 0 || j == 0 || k == 0 ||
+					i == dim.x() - 1 || j == dim.y() - 1 || k == dim.z() - 1;
+				values.push_back(boundary ? 1.0f : noise(rnd));
+			}
+
+	const MarchingCubes mc{ dim };
+	const auto surface = mc.extract(values, 0);
+	ASSERT_GT(surface->nrFaces(), 0u);
+	expectClosedSurface(*surface);
+	EXPECT_GT(signedVolume(*surface), 0);
+
+	// Uniform grids do not contain a surface
+	const std::vector<float> constant(dim.x() * dim.y() * dim.z(), 1.0f);
+	EXPECT_EQ(0u, mc.extract(constant, 0)->nrFaces());
+}
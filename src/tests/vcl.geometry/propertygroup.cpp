@@ -0,0 +1,360 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/core/memory/tracking.h>
+#include <vcl/geometry/genericid.h>
+#include <vcl/geometry/meshfactory.h>
+#include <vcl/geometry/propertygroup.h>
+#include <vcl/geometry/tetramesh.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	VCL_CREATEID(Index, unsigned int);
+}
+
+TEST(PropertyGroupTest, AddFindRemove)
+{
+	using namespace Vcl::Geometry;
+
+	PropertyGroup<Index> group("Group");
+	group.resizeProperties(10);
+
+	// Enough properties to grow the index several times
+	const int NrProperties = 100;
+	for (int i = 0; i < NrProperties; i++)
+	{
+		auto prop = group.add<int>("Property" + std::to_string(i), i);
+		ASSERT_TRUE(prop != nullptr);
+		EXPECT_EQ(10u, prop->size());
+	}
+	EXPECT_EQ(size_t(NrProperties), group.size());
+
+	// Adding an existing property returns it
+	EXPECT_EQ(group.property<int>("Property7"), group.add<int>("Property7", 0));
+	EXPECT_EQ(size_t(NrProperties), group.size());
+
+	for (int i = 0; i < NrProperties; i++)
+	{
+		auto prop = group.property<int>("Property" + std::to_string(i));
+		ASSERT_TRUE(prop != nullptr);
+		EXPECT_EQ("Property" + std::to_string(i), prop->name());
+		EXPECT_EQ(i, (*prop)[9]);
+	}
+	EXPECT_TRUE(group.property<int>("Property") == nullptr);
+	EXPECT_FALSE(group.exists("Property100"));
+
+	group.remove("Property42");
+	EXPECT_FALSE(group.exists("Property42"));
+	EXPECT_TRUE(group.exists("Property43"));
+	EXPECT_EQ(size_t(NrProperties - 1), group.size());
+
+	std::set<std::string> names;
+	for (const auto& prop : group)
+		names.insert(prop.name());
+	EXPECT_EQ(size_t(NrProperties - 1), names.size());
+	EXPECT_EQ(0u, names.count("Property42"));
+
+	// A removed property can be added again
+	EXPECT_TRUE(group.add<int>("Property42", 42) != nullptr);
+	EXPECT_EQ(42, (*group.property<int>("Property42"))[0]);
+}
+
+TEST(PropertyGroupTest, Handles)
+{
+	using namespace Vcl::Geometry;
+
+	PropertyGroup<Index> group("Group");
+	group.add<float>("Mass", 1.0f);
+	group.add<int>("Label", 3);
+	group.resizeProperties(4);
+
+	const auto mass = group.handle<float>("Mass");
+	const auto label = group.handle<int>(std::string("Label"));
+	ASSERT_TRUE(mass.isValid());
+	ASSERT_TRUE(label.isValid());
+	EXPECT_FALSE(group.handle<int>("Unknown").isValid());
+
+	EXPECT_EQ(group.property<float>("Mass"), group.property(mass));
+	(*group.property(label))[2] = 5;
+
+	// Handles stay valid after removing other properties and in copies
+	group.remove("Mass");
+	PropertyGroup<Index> copy{ group };
+	EXPECT_EQ(5, (*copy.property(label))[2]);
+	EXPECT_NE(group.property(label), copy.property(label));
+}
+
+TEST(PropertyGroupTest, ReuseRemovedSlot)
+{
+	using namespace Vcl::Geometry;
+
+	PropertyGroup<Index> group("Group");
+	group.add<float>("Mass", 1.0f);
+	group.add<int>("Label", 3);
+	group.resizeProperties(4);
+	const auto label = group.handle<int>("Label");
+
+	// Adding after removing takes the free slot and keeps other handles intact
+	for (int i = 0; i < 10; i++)
+	{
+		group.remove("Mass");
+		auto mass = group.add<float>("Mass", float(i));
+		ASSERT_TRUE(mass != nullptr);
+		EXPECT_EQ(float(i), (*group.property(group.handle<float>("Mass")))[3]);
+		EXPECT_EQ(3, (*group.property(label))[3]);
+	}
+	EXPECT_EQ(2u, group.size());
+	EXPECT_EQ(2, std::distance(group.begin(), group.end()));
+}
+
+TEST(PropertyGroupTest, AssignTracked)
+{
+	using namespace Vcl::Geometry;
+
+	PropertyGroup<Index> group("Group");
+	group.trackAllocations("PropertyGroupTest.AssignTracked");
+	group.add<float>("Masses", 1.0f);
+	group.resizeProperties(10);
+
+	// Assignment takes over the allocation tag
+	PropertyGroup<Index> copy("Copy");
+	copy = group;
+	copy.add<int>("Labels", 0);
+
+	const auto* stats = Vcl::Core::AllocationTracker::instance().find("PropertyGroupTest.AssignTracked.Labels");
+	ASSERT_TRUE(stats != nullptr);
+	EXPECT_LT(0u, stats->allocations());
+}
+
+TEST(PropertyGroupTest, MeshHandles)
+{
+	using namespace Vcl::Geometry;
+
+	auto mesh = MeshFactory<TetraMesh>::createHomogenousCubes(2, 1, 1);
+	float init = 2.0f;
+	mesh->addVolumeProperty<float>("Mass", init);
+
+	const auto mass = mesh->volumePropertyHandle<float>("Mass");
+	ASSERT_TRUE(mass.isValid());
+
+	const TetraMesh copy{ *mesh };
+	auto prop = copy.volumeProperty(mass);
+	ASSERT_EQ(copy.nrVolumes(), prop->size());
+	EXPECT_EQ(2.0f, (*prop)[static_cast<int>(copy.nrVolumes()) - 1]);
+}
+
+TEST(PropertyGroupTest, GrowTogether)
+{
+	using namespace Vcl::Geometry;
+
+	PropertyGroup<Index> group("Group");
+	auto positions = group.add<Eigen::Vector3f>("Positions", Eigen::Vector3f::Ones());
+	auto names = group.add<std::string>("Names", std::string("Element"));
+
+	// Grow in small batches
+	size_t allocations = 0;
+	const Eigen::Vector3f* storage = nullptr;
+	for (int i = 0; i < 1000; i++)
+	{
+		const size_t first = group.appendProperties(3);
+		EXPECT_EQ(size_t(3 * i), first);
+
+		(*positions)[static_cast<int>(first)] = Eigen::Vector3f::Constant(float(i));
+		(*names)[static_cast<int>(first)] = std::to_string(i);
+
+		if (positions->data() != storage)
+		{
+			storage = positions->data();
+			allocations++;
+		}
+	}
+	EXPECT_EQ(3000u, group.propertySize());
+	EXPECT_EQ(3000u, positions->size());
+	EXPECT_EQ(3000u, names->size());
+	EXPECT_LT(allocations, 20u);
+
+	bool equal = true;
+	for (int i = 0; i < 1000; i++)
+	{
+		equal = equal && (*positions)[3 * i] == Eigen::Vector3f::Constant(float(i));
+		equal = equal && (*positions)[3 * i + 2] == Eigen::Vector3f::Ones();
+		equal = equal && (*names)[3 * i] == std::to_string(i);
+		equal = equal && (*names)[3 * i + 1] == "Element";
+	}
+	EXPECT_TRUE(equal);
+}
+
+TEST(PropertyGroupTest, SlabAllocation)
+{
+	using namespace Vcl::Geometry;
+
+	PropertyGroup<Index> group("Group");
+	group.setSlabAllocation(true);
+	group.trackAllocations("PropertyGroupTest.Slab");
+
+	auto positions = group.add<Eigen::Vector3f>("Positions", Eigen::Vector3f::Zero());
+	auto masses = group.add<float>("Masses", 1.0f);
+	auto names = group.add<std::string>("Names", std::string("Element"));
+	group.resizeProperties(10);
+	(*positions)[9] = Eigen::Vector3f::Constant(9);
+	(*names)[9] = "Last";
+
+	group.reserveProperties(100);
+	EXPECT_EQ(10u, positions->size());
+	EXPECT_EQ(Eigen::Vector3f::Constant(9), (*positions)[9]);
+	EXPECT_EQ(1.0f, (*masses)[9]);
+	EXPECT_EQ("Last", (*names)[9]);
+
+	// All properties are stored in one aligned block
+	std::vector<const char*> regions =
+	{
+		reinterpret_cast<const char*>(positions->data()),
+		reinterpret_cast<const char*>(masses->data()),
+		reinterpret_cast<const char*>(names->data()),
+	};
+	std::sort(regions.begin(), regions.end());
+	for (const char* region : regions)
+		EXPECT_EQ(0u, reinterpret_cast<size_t>(region) % PropertySlab::Alignment);
+	EXPECT_LE(size_t(regions.back() - regions.front()), 100 * (sizeof(Eigen::Vector3f) + sizeof(float)) + 2 * PropertySlab::Alignment);
+
+	// Growing within the slab does not move the data
+	const auto* storage = positions->data();
+	group.resizeProperties(100);
+	EXPECT_EQ(storage, positions->data());
+	EXPECT_EQ(1.0f, (*masses)[99]);
+
+	// Growing beyond it moves all properties into a new slab
+	group.appendProperties(1);
+	EXPECT_NE(storage, positions->data());
+	EXPECT_EQ(Eigen::Vector3f::Constant(9), (*positions)[9]);
+	EXPECT_EQ("Last", (*names)[9]);
+	EXPECT_EQ("Element", (*names)[100]);
+
+	// Copies own their memory
+	{
+		PropertyGroup<Index> copy{ group };
+		group.removeAll();
+		auto copied_names = copy.property<std::string>("Names");
+		EXPECT_EQ("Last", (*copied_names)[9]);
+	}
+
+	// Memory of the slab is tracked as well
+	const auto* stats = Vcl::Core::AllocationTracker::instance().find("PropertyGroupTest.Slab.Positions");
+	ASSERT_TRUE(stats != nullptr);
+	EXPECT_EQ(stats->allocations(), stats->deallocations());
+}
+
+TEST(PropertyGroupTest, TrackedProperty)
+{
+	using namespace Vcl::Geometry;
+
+	const auto& stats = Vcl::Core::AllocationTracker::instance().statistics("PropertyGroupTest.TrackedProperty");
+	{
+		Property<float, Index> masses{ "Masses", 1.0f };
+		masses.resize(10);
+		masses.trackAllocations("PropertyGroupTest.TrackedProperty");
+		EXPECT_EQ(10 * sizeof(float), stats.liveBytes());
+
+		// Exchanging the allocator keeps tracking the property
+		masses.setAllocator(Vcl::Core::AlignedAllocPolicy<float, 64>());
+		EXPECT_EQ(2u, stats.allocations());
+		EXPECT_EQ(1u, stats.deallocations());
+		EXPECT_EQ(10 * sizeof(float), stats.liveBytes());
+
+		masses.reserve(20);
+		EXPECT_EQ(3u, stats.allocations());
+		EXPECT_EQ(20 * sizeof(float), stats.liveBytes());
+
+		// Relocating into a slab keeps tracking the property
+		auto slab = std::make_shared<PropertySlab>(100 * sizeof(float));
+		masses.relocate(slab, 0, 100);
+		EXPECT_EQ(4u, stats.allocations());
+		EXPECT_EQ(100 * sizeof(float), stats.liveBytes());
+
+		masses.resize(200);
+		EXPECT_EQ(5u, stats.allocations());
+		EXPECT_EQ(200 * sizeof(float), stats.liveBytes());
+		EXPECT_EQ(1.0f, masses[199]);
+	}
+	EXPECT_EQ(stats.allocations(), stats.deallocations());
+	EXPECT_EQ(0u, stats.liveBytes());
+}
+
+TEST(PropertyGroupTest, MeshAppend)
+{
+	using namespace Vcl::Geometry;
+
+	auto mesh = MeshFactory<TetraMesh>::createHomogenousCubes(1, 1, 1);
+	float init = 2.0f;
+	mesh->addVolumeProperty<float>("Mass", init);
+
+	const auto first = mesh->appendVolumes(3);
+	EXPECT_EQ(5u, first.id());
+	EXPECT_EQ(8u, mesh->nrVolumes());
+
+	const auto mass = mesh->volumeProperty(mesh->volumePropertyHandle<float>("Mass"));
+	EXPECT_EQ(8u, mass->size());
+	EXPECT_EQ(2.0f, (*mass)[7]);
+
+	EXPECT_EQ(8u, mesh->appendVertices(2).id());
+	EXPECT_EQ(10u, mesh->nrVertices());
+}
+
+TEST(PropertyGroupTest, MeshAppendAfterClear)
+{
+	using namespace Vcl::Geometry;
+
+	auto mesh = MeshFactory<TetraMesh>::createHomogenousCubes(1, 1, 1);
+	float init = 2.0f;
+	mesh->addVolumeProperty<float>("Mass", init);
+	mesh->clear();
+	EXPECT_EQ(0u, mesh->nrVertices());
+	EXPECT_EQ(0u, mesh->nrVolumes());
+
+	EXPECT_EQ(0u, mesh->appendVertices(4).id());
+	EXPECT_EQ(4u, mesh->nrVertices());
+
+	EXPECT_EQ(0u, mesh->appendVolumes(1).id());
+	EXPECT_EQ(1u, mesh->nrVolumes());
+
+	const auto mass = mesh->volumeProperty(mesh->volumePropertyHandle<float>("Mass"));
+	EXPECT_EQ(1u, mass->size());
+	EXPECT_EQ(2.0f, (*mass)[0]);
+}
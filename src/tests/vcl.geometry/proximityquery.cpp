@@ -0,0 +1,216 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/geometry/distanceTriangle3Triangle3.h>
+#include <vcl/geometry/meshfactory.h>
+#include <vcl/geometry/proximityquery.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	Vcl::Geometry::Triangle<Vcl::float4, 3> broadcast(gsl::span<const Eigen::Vector3f> vertices, const std::array<uint32_t, 3>& tri)
+	{
+		Eigen::Matrix<Vcl::float4, 3, 1> x[3];
+		for (int v = 0; v < 3; v++)
+		{
+			const Eigen::Vector3f& p = vertices[tri[v]];
+			x[v] = { Vcl::float4(p.x()), Vcl::float4(p.y()), Vcl::float4(p.z()) };
+		}
+		return{ x[0], x[1], x[2] };
+	}
+
+	// Close pairs by testing all pairs of triangles
+	std::vector<Vcl::Geometry::ProximityPair> bruteForcePairs(const Vcl::Geometry::ProximitySurface& a, const Vcl::Geometry::ProximitySurface& b, bool self, float threshold)
+	{
+		using namespace Vcl::Geometry;
+
+		std::vector<ProximityPair> pairs;
+		for (uint32_t i = 0; i < a.nrTriangles(); i++)
+		{
+			for (uint32_t j = self ? i + 1 : 0; j < b.nrTriangles(); j++)
+			{
+				const auto& tri_a = a.triangles()[i];
+				const auto& tri_b = b.triangles()[j];
+				if (self && (
+					std::find(tri_a.begin(), tri_a.end(), tri_b[0]) != tri_a.end() ||
+					std::find(tri_a.begin(), tri_a.end(), tri_b[1]) != tri_a.end() ||
+					std::find(tri_a.begin(), tri_a.end(), tri_b[2]) != tri_a.end()))
+					continue;
+
+				Eigen::Matrix<Vcl::float4, 3, 1> p, q;
+				const float sq_dist = distance(broadcast(a.vertices(), tri_a), broadcast(b.vertices(), tri_b), p, q)[0];
+				if (sq_dist <= threshold * threshold)
+					pairs.push_back({ i, j, std::sqrt(sq_dist), { p.x()[0], p.y()[0], p.z()[0] }, { q.x()[0], q.y()[0], q.z()[0] } });
+			}
+		}
+		return pairs;
+	}
+
+	void expectEqualPairs(const std::vector<Vcl::Geometry::ProximityPair>& ref, const std::vector<Vcl::Geometry::ProximityPair>& pairs)
+	{
+		ASSERT_EQ(ref.size(), pairs.size());
+		for (size_t i = 0; i < ref.size(); i++)
+		{
+			EXPECT_EQ(ref[i].first, pairs[i].first) << "Pair " << i;
+			EXPECT_EQ(ref[i].second, pairs[i].second) << "Pair " << i;
+			EXPECT_NEAR(ref[i].distance, pairs[i].distance, 1e-5f) << "Pair " << i;
+			if (pairs[i].distance > 0)
+			{
+				EXPECT_NEAR(pairs[i].distance, (pairs[i].firstPoint - pairs[i].secondPoint).norm(), 1e-4f) << "Pair " << i;
+			}
+		}
+	}
+
+	// Single triangle mesh containing two spheres with a small gap
+	std::unique_ptr<Vcl::Geometry::TriMesh> createSpheres(float gap)
+	{
+		using namespace Vcl::Geometry;
+
+		const auto a = TriMeshFactory::createSphere({ 0, 0, 0 }, 1, 12, 16, false);
+		const auto b = TriMeshFactory::createSphere({ 2 + gap, 0, 0 }, 1, 12, 16, false);
+
+		std::vector<Eigen::Vector3f> vertices;
+		std::vector<std::array<unsigned int, 3>> faces;
+		for (const auto* sphere : { a.get(), b.get() })
+		{
+			const unsigned int offset = static_cast<unsigned int>(vertices.size());
+			for (unsigned int v = 0; v < sphere->nrVertices(); v++)
+				vertices.push_back(sphere->vertices()[v]);
+			for (unsigned int f = 0; f < sphere->nrFaces(); f++)
+			{
+				const auto& face = sphere->faces()[f];
+				faces.push_back({ offset + face[0].id(), offset + face[1].id(), offset + face[2].id() });
+			}
+		}
+
+		return std::make_unique<TriMesh>(vertices, faces);
+	}
+}
+
+TEST(ProximityQuery, TetraMeshSurface)
+{
+	using namespace Vcl::Geometry;
+
+	// Cubes filling [0, 2]^3
+	const auto cubes = MeshFactory<TetraMesh>::createHomogenousCubes(2, 2, 2);
+	const ProximitySurface surface{ *cubes };
+	EXPECT_EQ(48u, surface.nrTriangles());
+
+	const Eigen::Vector3f centre{ 1, 1, 1 };
+	float area = 0;
+	for (const auto& tri : surface.triangles())
+	{
+		const Eigen::Vector3f& x0 = surface.vertices()[tri[0]];
+		const Eigen::Vector3f& x1 = surface.vertices()[tri[1]];
+		const Eigen::Vector3f& x2 = surface.vertices()[tri[2]];
+
+		// Triangles lie on the boundary and point outwards
+		const Eigen::Vector3f n = (x1 - x0).cross(x2 - x0);
+		EXPECT_GT(n.dot((x0 + x1 + x2) / 3 - centre), 0);
+		EXPECT_NEAR(1.0f, ((x0 + x1 + x2) / 3 - centre).cwiseAbs().maxCoeff(), 1e-5f);
+
+		area += 0.5f * n.norm();
+	}
+	EXPECT_NEAR(24.0f, area, 1e-4f);
+}
+
+TEST(ProximityQuery, TriMeshSelf)
+{
+	using namespace Vcl::Geometry;
+
+	const float threshold = 0.1f;
+	auto spheres = createSpheres(0.05f);
+	ProximitySurface surface{ *spheres };
+
+	auto pairs = findSelfProximityPairs(surface, threshold);
+	EXPECT_FALSE(pairs.empty());
+	for (const auto& pair : pairs)
+		EXPECT_LT(pair.first, pair.second);
+	expectEqualPairs(bruteForcePairs(surface, surface, true, threshold), pairs);
+
+	// Move the second sphere closer
+	auto vertices = spheres->vertices();
+	for (int v = static_cast<int>(spheres->nrVertices()) / 2; v < static_cast<int>(spheres->nrVertices()); v++)
+		vertices[v].x() -= 0.04f;
+	surface.refit();
+
+	pairs = findSelfProximityPairs(surface, threshold);
+	expectEqualPairs(bruteForcePairs(surface, surface, true, threshold), pairs);
+
+	surface.rebuild();
+	expectEqualPairs(pairs, findSelfProximityPairs(surface, threshold));
+}
+
+TEST(ProximityQuery, TriMeshTriMesh)
+{
+	using namespace Vcl::Geometry;
+
+	const float threshold = 0.1f;
+	const auto a = TriMeshFactory::createSphere({ 0, 0, 0 }, 1, 12, 16, false);
+	const auto b = TriMeshFactory::createSphere({ 1.5f, 0.5f, 0 }, 1, 12, 16, false);
+	const ProximitySurface surface_a{ *a, BvhBuilder::Sah };
+	const ProximitySurface surface_b{ *b };
+
+	// Intersecting triangles are at distance zero
+	const auto pairs = findProximityPairs(surface_a, surface_b, threshold);
+	EXPECT_FALSE(pairs.empty());
+	expectEqualPairs(bruteForcePairs(surface_a, surface_b, false, threshold), pairs);
+
+	// Distant surfaces are not reported
+	const auto c = TriMeshFactory::createSphere({ 5, 0, 0 }, 1, 12, 16, false);
+	EXPECT_TRUE(findProximityPairs(surface_a, ProximitySurface{ *c }, threshold).empty());
+}
+
+TEST(ProximityQuery, TetraMeshTetraMesh)
+{
+	using namespace Vcl::Geometry;
+
+	const float threshold = 0.1f;
+	const auto a = MeshFactory<TetraMesh>::createHomogenousCubes(3, 3, 3);
+	auto b = MeshFactory<TetraMesh>::createHomogenousCubes(3, 3, 3);
+
+	// Place the second block next to the first one, slightly tilted
+	auto vertices = b->vertices();
+	for (int v = 0; v < static_cast<int>(b->nrVertices()); v++)
+		vertices[v] = Eigen::Vector3f{ 3.05f + 0.01f * vertices[v].y(), 1, 0.5f } + vertices[v];
+	const ProximitySurface surface_a{ *a };
+	const ProximitySurface surface_b{ *b };
+
+	const auto pairs = findProximityPairs(surface_a, surface_b, threshold);
+	EXPECT_FALSE(pairs.empty());
+	expectEqualPairs(bruteForcePairs(surface_a, surface_b, false, threshold), pairs);
+}
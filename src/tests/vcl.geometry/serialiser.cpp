@@ -0,0 +1,357 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/geometry/io/serialiser_nvidia_tet_file.h>
+#include <vcl/geometry/io/serialiser_tetgen.h>
+#include <vcl/geometry/io/snapshotwriter.h>
+#include <vcl/geometry/io/tetramesh_serialiser.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+namespace
+{
+	// Enough elements to be handed over in multiple chunks
+	const unsigned int NrNodes = 2 * Vcl::Geometry::IO::DeserialiserChunkSize + 17;
+	const unsigned int NrVolumes = NrNodes - 3;
+
+	Eigen::Vector3f node(unsigned int i)
+	{
+		return { float(i), 0.5f * float(i), -float(i) };
+	}
+
+	std::array<unsigned int, 4> volume(unsigned int i)
+	{
+		return { i, i + 1, i + 2, i + 3 };
+	}
+
+	Vcl::Geometry::TetraMesh createMesh(const Eigen::Vector3f& first_node = node(0))
+	{
+		std::vector<Eigen::Vector3f> nodes(NrNodes);
+		std::vector<std::array<unsigned int, 4>> volumes(NrVolumes);
+		for (unsigned int i = 0; i < NrNodes; i++)
+			nodes[i] = node(i);
+		nodes[0] = first_node;
+		for (unsigned int i = 0; i < NrVolumes; i++)
+			volumes[i] = volume(i);
+
+		return{ nodes, volumes };
+	}
+
+	void writeTetGen(const std::string& path)
+	{
+		std::ofstream node_file{ path + ".node" };
+		node_file << "# Nodes" << std::endl;
+		node_file << NrNodes << " 3 0 0" << std::endl;
+		for (unsigned int i = 0; i < NrNodes; i++)
+			node_file << i + 1 << " " << node(i).x() << " " << node(i).y() << " " << node(i).z() << std::endl;
+
+		std::ofstream ele_file{ path + ".ele" };
+		ele_file << NrVolumes << " 4 0" << std::endl;
+		for (unsigned int i = 0; i < NrVolumes; i++)
+		{
+			const auto v = volume(i);
+			ele_file << i + 1 << " " << v[0] + 1 << " " << v[1] + 1 << " " << v[2] + 1 << " " << v[3] + 1 << std::endl;
+		}
+	}
+
+	void writeNvidiaTet(const std::string& path)
+	{
+		std::ofstream file{ path };
+		for (unsigned int i = 0; i < NrNodes; i++)
+			file << "v " << node(i).x() << " " << node(i).y() << " " << node(i).z() << std::endl;
+		for (unsigned int i = 0; i < NrVolumes; i++)
+		{
+			const auto v = volume(i);
+			file << "t " << v[0] << " " << v[1] << " " << v[2] << " " << v[3] << std::endl;
+		}
+	}
+
+	void verify(const Vcl::Geometry::TetraMesh& mesh)
+	{
+		ASSERT_EQ(NrNodes, mesh.nrVertices());
+		ASSERT_EQ(NrVolumes, mesh.nrVolumes());
+
+		bool equal = true;
+		for (unsigned int i = 0; i < NrNodes; i++)
+			equal = equal && mesh.vertices()[i] == node(i);
+		for (unsigned int i = 0; i < NrVolumes; i++)
+		{
+			const auto v = volume(i);
+			for (int j = 0; j < 4; j++)
+				equal = equal && mesh.volumes()[i][j].id() == v[j];
+		}
+		EXPECT_TRUE(equal);
+	}
+
+	//! Deserialiser only implementing the per-element interface
+	class CountingDeserialiser : public Vcl::Geometry::IO::AbstractDeserialiser
+	{
+	public:
+		void begin() override {}
+		void end() override {}
+
+		void sizeHintNodes(unsigned int) override {}
+		void sizeHintEdges(unsigned int) override {}
+		void sizeHintFaces(unsigned int) override {}
+		void sizeHintVolumes(unsigned int) override {}
+
+		void addNode(const std::vector<float>& coordinates) override { nodes.push_back(coordinates); }
+		void addEdge(const std::vector<unsigned int>&) override {}
+		void addFace(const std::vector<unsigned int>&) override {}
+		void addVolume(const std::vector<unsigned int>& indices) override { volumes.push_back(indices); }
+
+		void addNormal(const Vcl::Vector3f&) override {}
+
+		std::vector<std::vector<float>> nodes;
+		std::vector<std::vector<unsigned int>> volumes;
+	};
+
+	//! Serialiser only implementing the per-element interface
+	class GeneratingSerialiser : public Vcl::Geometry::IO::AbstractSerialiser
+	{
+	public:
+		void begin() override { _node = 0; _volume = 0; }
+		void end() override {}
+
+		unsigned int nrNodes() override { return NrNodes; }
+		unsigned int nrEdges() override { return 0; }
+		unsigned int nrFaces() override { return 0; }
+		unsigned int nrVolumes() override { return NrVolumes; }
+
+		void fetchNode(std::vector<float>& coordinates) override
+		{
+			const auto p = node(_node++);
+			coordinates = { p.x(), p.y(), p.z() };
+		}
+		void fetchEdge(std::vector<unsigned int>& indices) override { indices.clear(); }
+		void fetchFace(std::vector<unsigned int>& indices) override { indices.clear(); }
+		void fetchVolume(std::vector<unsigned int>& indices) override
+		{
+			const auto v = volume(_volume++);
+			indices.assign(v.begin(), v.end());
+		}
+
+	private:
+		unsigned int _node{ 0 };
+		unsigned int _volume{ 0 };
+	};
+
+	std::unique_ptr<Vcl::Geometry::TetraMesh> loadMesh(const Vcl::Geometry::IO::Serialiser& format, const std::string& path)
+	{
+		Vcl::Geometry::IO::TetraMeshDeserialiser deserialiser;
+		format.load(&deserialiser, path);
+		return deserialiser.fetch();
+	}
+}
+
+TEST(SerialiserTest, TetGen)
+{
+	using namespace Vcl::Geometry;
+
+	writeTetGen("SerialiserTest.TetGen");
+
+	for (auto mode : { IO::ParseMode::Sequential, IO::ParseMode::Parallel })
+	{
+		IO::TetraMeshDeserialiser deserialiser;
+		IO::TetGenSerialiser serialiser{ mode };
+		serialiser.load(&deserialiser, "SerialiserTest.TetGen.node");
+		auto mesh = deserialiser.fetch();
+		ASSERT_TRUE(mesh != nullptr);
+		verify(*mesh);
+	}
+
+	std::remove("SerialiserTest.TetGen.node");
+	std::remove("SerialiserTest.TetGen.ele");
+}
+
+TEST(SerialiserTest, NvidiaTet)
+{
+	using namespace Vcl::Geometry;
+
+	writeNvidiaTet("SerialiserTest.Nvidia.tet");
+
+	for (auto mode : { IO::ParseMode::Sequential, IO::ParseMode::Parallel })
+	{
+		IO::TetraMeshDeserialiser deserialiser;
+		IO::NvidiaTetSerialiser serialiser{ mode };
+		serialiser.load(&deserialiser, "SerialiserTest.Nvidia.tet");
+		auto mesh = deserialiser.fetch();
+		ASSERT_TRUE(mesh != nullptr);
+		verify(*mesh);
+	}
+
+	std::remove("SerialiserTest.Nvidia.tet");
+}
+
+TEST(SerialiserTest, PerElementFallback)
+{
+	using namespace Vcl::Geometry;
+
+	writeNvidiaTet("SerialiserTest.Fallback.tet");
+
+	CountingDeserialiser deserialiser;
+	IO::NvidiaTetSerialiser serialiser;
+	serialiser.load(&deserialiser, "SerialiserTest.Fallback.tet");
+	ASSERT_EQ(NrNodes, deserialiser.nodes.size());
+	ASSERT_EQ(NrVolumes, deserialiser.volumes.size());
+
+	EXPECT_EQ(std::vector<float>({ node(NrNodes - 1).x(), node(NrNodes - 1).y(), node(NrNodes - 1).z() }), deserialiser.nodes.back());
+	const auto v = volume(NrVolumes - 1);
+	EXPECT_EQ(std::vector<unsigned int>(v.begin(), v.end()), deserialiser.volumes.back());
+
+	std::remove("SerialiserTest.Fallback.tet");
+}
+
+TEST(SerialiserTest, StoreTetGen)
+{
+	using namespace Vcl::Geometry;
+
+	const auto mesh = createMesh();
+	IO::TetraMeshSerialiser serialiser(&mesh);
+	IO::TetGenSerialiser{}.store(&serialiser, "SerialiserTest.StoreTetGen.ele");
+
+	auto loaded = loadMesh(IO::TetGenSerialiser{}, "SerialiserTest.StoreTetGen.node");
+	ASSERT_TRUE(loaded != nullptr);
+	verify(*loaded);
+
+	std::remove("SerialiserTest.StoreTetGen.node");
+	std::remove("SerialiserTest.StoreTetGen.ele");
+}
+
+TEST(SerialiserTest, StoreNvidiaTet)
+{
+	using namespace Vcl::Geometry;
+
+	const auto mesh = createMesh();
+	IO::TetraMeshSerialiser serialiser(&mesh);
+	IO::NvidiaTetSerialiser{}.store(&serialiser, "SerialiserTest.StoreNvidia.tet");
+
+	auto loaded = loadMesh(IO::NvidiaTetSerialiser{}, "SerialiserTest.StoreNvidia.tet");
+	ASSERT_TRUE(loaded != nullptr);
+	verify(*loaded);
+
+	std::remove("SerialiserTest.StoreNvidia.tet");
+}
+
+TEST(SerialiserTest, StoreExactFloats)
+{
+	using namespace Vcl::Geometry;
+
+	const std::vector<Eigen::Vector3f> nodes =
+	{
+		{ 1.0f / 3.0f, 3.14159274f, 1e-7f },
+		{ -123456.789f, 0.1f, 5e30f },
+		{ 0.0f, -0.0f, 16777215.0f },
+		{ 2.0f / 7.0f, 1e-30f, -1.5f },
+	};
+	const TetraMesh mesh{ nodes, { { 0, 1, 2, 3 } } };
+
+	IO::TetraMeshSerialiser serialiser(&mesh);
+	IO::NvidiaTetSerialiser{}.store(&serialiser, "SerialiserTest.StoreExactFloats.tet");
+
+	for (auto mode : { IO::ParseMode::Sequential, IO::ParseMode::Parallel })
+	{
+		auto loaded = loadMesh(IO::NvidiaTetSerialiser{ mode }, "SerialiserTest.StoreExactFloats.tet");
+		ASSERT_TRUE(loaded != nullptr);
+		ASSERT_EQ(nodes.size(), loaded->nrVertices());
+		for (unsigned int i = 0; i < nodes.size(); i++)
+			EXPECT_EQ(nodes[i], loaded->vertices()[i]) << "Node " << i;
+	}
+
+	std::remove("SerialiserTest.StoreExactFloats.tet");
+}
+
+TEST(SerialiserTest, StorePerElementFallback)
+{
+	using namespace Vcl::Geometry;
+
+	GeneratingSerialiser serialiser;
+	IO::NvidiaTetSerialiser{}.store(&serialiser, "SerialiserTest.StoreFallback.tet");
+
+	auto loaded = loadMesh(IO::NvidiaTetSerialiser{}, "SerialiserTest.StoreFallback.tet");
+	ASSERT_TRUE(loaded != nullptr);
+	verify(*loaded);
+
+	std::remove("SerialiserTest.StoreFallback.tet");
+}
+
+TEST(SerialiserTest, SnapshotWriter)
+{
+	using namespace Vcl::Geometry;
+
+	const unsigned int NrSnapshots = 4;
+	const std::string path = "SerialiserTest.Snapshot";
+
+	std::unique_ptr<TetraMesh> mesh;
+	{
+		IO::SnapshotWriter writer{ 1 };
+		auto format = std::make_shared<IO::NvidiaTetSerialiser>();
+		for (unsigned int s = 0; s < NrSnapshots; s++)
+		{
+			// Identify each snapshot by its first vertex. Replacing the mesh
+			// after queuing does not affect the snapshots.
+			mesh = std::make_unique<TetraMesh>(createMesh(Eigen::Vector3f::Constant(float(s))));
+
+			writer.store(*mesh, format, path + std::to_string(s) + ".tet");
+			writer.store(*mesh, path + std::to_string(s) + ".vclmesh");
+		}
+		mesh = std::make_unique<TetraMesh>(createMesh());
+		writer.wait();
+		EXPECT_EQ(0u, writer.nrFailures());
+	}
+
+	for (unsigned int s = 0; s < NrSnapshots; s++)
+	{
+		const std::string text_path = path + std::to_string(s) + ".tet";
+		const std::string binary_path = path + std::to_string(s) + ".vclmesh";
+
+		auto text = loadMesh(IO::NvidiaTetSerialiser{}, text_path);
+		ASSERT_TRUE(text != nullptr);
+
+		TetraMesh binary;
+		ASSERT_TRUE(IO::BinaryMeshSerialiser{}.load(binary, binary_path));
+
+		for (const TetraMesh* snapshot : { text.get(), &binary })
+		{
+			EXPECT_EQ(Eigen::Vector3f::Constant(float(s)), snapshot->vertices()[0]);
+			EXPECT_EQ(node(NrNodes - 1), snapshot->vertices()[NrNodes - 1]);
+			EXPECT_EQ(NrVolumes, snapshot->nrVolumes());
+		}
+
+		std::remove(text_path.c_str());
+		std::remove(binary_path.c_str());
+	}
+}
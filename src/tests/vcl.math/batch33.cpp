@@ -0,0 +1,318 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2017 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <random>
+
+// Include the relevant parts from the library
+#include <vcl/core/simd/instructionset.h>
+#include <vcl/core/interleavedarray.h>
+#include <vcl/math/batch33.h>
+#include <vcl/math/jacobieigen33_selfadjoint.h>
+#include <vcl/math/jacobisvd33_mcadams.h>
+#include <vcl/math/jacobisvd33_qr.h>
+#include <vcl/math/math.h>
+#include <vcl/math/polardecomposition.h>
+#include <vcl/math/rotation33_torque.h>
+
+// Google test
+#include <gtest/gtest.h>
+
+// Common functions
+namespace
+{
+	using Matrix33Array = Vcl::Core::InterleavedArray<float, 3, 3, -1>;
+
+	// Number of problems not being a multiple of any vector width
+	const size_t NrProblems = 37;
+
+	// Instruction sets the batch kernels are tested with
+	const Vcl::InstructionSet InstructionSets[] =
+	{
+		Vcl::InstructionSet::Scalar,
+		Vcl::InstructionSet::AVX,
+		Vcl::InstructionSet::AVX512
+	};
+
+	Matrix33Array createProblems(size_t nr_problems)
+	{
+		std::mt19937_64 rng{ 5489 };
+		std::uniform_real_distribution<float> d{ -1.0f, 1.0f };
+
+		Matrix33Array F(nr_problems);
+		for (int i = 0; i < (int) nr_problems; i++)
+		{
+			F.at<float>(i) << d(rng), d(rng), d(rng),
+			                  d(rng), d(rng), d(rng),
+			                  d(rng), d(rng), d(rng);
+		}
+
+		return F;
+	}
+
+	Matrix33Array createDeformations(size_t nr_problems)
+	{
+		std::mt19937_64 rng{ 5489 };
+		std::uniform_real_distribution<float> d{ -1.0f, 1.0f };
+		std::uniform_real_distribution<float> s{ -0.1f, 0.1f };
+
+		// Rotations with a small stretch, for which the torque iteration converges
+		Matrix33Array F(nr_problems);
+		for (int i = 0; i < (int) nr_problems; i++)
+		{
+			const Eigen::Vector3f axis = Eigen::Vector3f{ d(rng), d(rng), d(rng) }.normalized();
+			const Eigen::Matrix3f R = Eigen::AngleAxisf{ 3.0f * d(rng), axis }.toRotationMatrix();
+
+			Eigen::Matrix3f S;
+			S << s(rng), s(rng), s(rng),
+			     s(rng), s(rng), s(rng),
+			     s(rng), s(rng), s(rng);
+			F.at<float>(i) = R * (Eigen::Matrix3f::Identity() + S + S.transpose());
+		}
+
+		return F;
+	}
+
+	Matrix33Array createSymmetricProblems(size_t nr_problems)
+	{
+		Matrix33Array F = createProblems(nr_problems);
+		for (int i = 0; i < (int) nr_problems; i++)
+		{
+			const Eigen::Matrix3f A = F.at<float>(i);
+			F.at<float>(i) = A.transpose() * A;
+		}
+
+		return F;
+	}
+
+	void copy(const Matrix33Array& from, Matrix33Array& to)
+	{
+		for (int i = 0; i < (int) from.size(); i++)
+			to.at<float>(i) = from.at<float>(i);
+	}
+
+	void expectEqual(const Eigen::Matrix3f& ref, const Eigen::Matrix3f& res, float tol, int i)
+	{
+		Eigen::IOFormat fmt(6, 0, ", ", ";", "[", "]");
+		EXPECT_TRUE(ref.isApprox(res, tol)) << "Problem " << i << " - Ref: " << ref.format(fmt) << ", Actual: " << res.format(fmt);
+	}
+
+	// Restores the full instruction set after each test
+	class Batch33 : public testing::Test
+	{
+	protected:
+		void TearDown() override
+		{
+			Vcl::resetInstructionSetLimit();
+		}
+	};
+}
+
+TEST_F(Batch33, McAdamsJacobiSVD)
+{
+	const Matrix33Array F = createProblems(NrProblems);
+	for (auto isa : InstructionSets)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Matrix33Array A(NrProblems), U(NrProblems), V(NrProblems);
+		copy(F, A);
+		Vcl::Mathematics::McAdamsJacobiSVD(A, U, V, NrProblems);
+
+		for (int i = 0; i < (int) NrProblems; i++)
+		{
+			Eigen::Matrix3f refA = F.at<float>(i);
+			Eigen::Matrix3f refU, refV;
+			Vcl::Mathematics::McAdamsJacobiSVD(refA, refU, refV);
+
+			SCOPED_TRACE(Vcl::name(isa));
+			EXPECT_TRUE(refA.diagonal().isApprox(A.at<float>(i).diagonal(), 1e-4f)) << "Singular values differ: " << i;
+			expectEqual(refU, U.at<float>(i), 1e-4f, i);
+			expectEqual(refV, V.at<float>(i), 1e-4f, i);
+		}
+	}
+}
+
+TEST_F(Batch33, QRJacobiSVD)
+{
+	const Matrix33Array F = createProblems(NrProblems);
+	for (auto isa : InstructionSets)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Matrix33Array A(NrProblems), U(NrProblems), V(NrProblems);
+		copy(F, A);
+		Vcl::Mathematics::QRJacobiSVD(A, U, V, NrProblems);
+
+		for (int i = 0; i < (int) NrProblems; i++)
+		{
+			Eigen::Matrix3f refA = F.at<float>(i);
+			Eigen::Matrix3f refU, refV;
+			Vcl::Mathematics::QRJacobiSVD(refA, refU, refV);
+
+			// The vectorised kernels may flip the signs of the singular vectors
+			const Eigen::Matrix3f S = A.at<float>(i).diagonal().asDiagonal();
+			const Eigen::Matrix3f resU = U.at<float>(i);
+			const Eigen::Matrix3f resV = V.at<float>(i);
+
+			SCOPED_TRACE(Vcl::name(isa));
+			EXPECT_TRUE(refA.diagonal().isApprox(A.at<float>(i).diagonal(), 1e-4f)) << "Singular values differ: " << i;
+			expectEqual(F.at<float>(i), resU * S * resV.transpose(), 1e-4f, i);
+		}
+	}
+}
+
+TEST_F(Batch33, TwoSidedJacobiSVD)
+{
+	const Matrix33Array F = createProblems(NrProblems);
+	for (auto isa : InstructionSets)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Matrix33Array A(NrProblems), U(NrProblems), V(NrProblems);
+		copy(F, A);
+		Vcl::Mathematics::TwoSidedJacobiSVD(A, U, V, NrProblems);
+
+		for (int i = 0; i < (int) NrProblems; i++)
+		{
+			const Eigen::Matrix3f S = A.at<float>(i).diagonal().asDiagonal();
+			const Eigen::Matrix3f resU = U.at<float>(i);
+			const Eigen::Matrix3f resV = V.at<float>(i);
+
+			SCOPED_TRACE(Vcl::name(isa));
+			expectEqual(F.at<float>(i), resU * S * resV.transpose(), 1e-4f, i);
+		}
+	}
+}
+
+TEST_F(Batch33, SelfAdjointJacobiEigen)
+{
+	const Matrix33Array F = createSymmetricProblems(NrProblems);
+	for (auto isa : InstructionSets)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Matrix33Array A(NrProblems), U(NrProblems);
+		copy(F, A);
+		Vcl::Mathematics::SelfAdjointJacobiEigen(A, U, NrProblems);
+
+		for (int i = 0; i < (int) NrProblems; i++)
+		{
+			const Eigen::Matrix3f D = A.at<float>(i).diagonal().asDiagonal();
+			const Eigen::Matrix3f resU = U.at<float>(i);
+
+			SCOPED_TRACE(Vcl::name(isa));
+			expectEqual(F.at<float>(i), resU * D * resU.transpose(), 1e-4f, i);
+		}
+	}
+}
+
+TEST_F(Batch33, PartialBatch)
+{
+	// Stop within a vector, the remaining entries must not be touched
+	const size_t count = 21;
+
+	const Matrix33Array F = createProblems(NrProblems);
+	for (auto isa : InstructionSets)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Matrix33Array A(NrProblems), U(NrProblems), V(NrProblems);
+		copy(F, A);
+		for (int i = 0; i < (int) NrProblems; i++)
+		{
+			U.at<float>(i).setConstant(2.0f);
+			V.at<float>(i).setConstant(3.0f);
+		}
+		Vcl::Mathematics::QRJacobiSVD(A, U, V, count);
+
+		SCOPED_TRACE(Vcl::name(isa));
+		for (int i = 0; i < (int) count; i++)
+		{
+			const Eigen::Matrix3f S = A.at<float>(i).diagonal().asDiagonal();
+			const Eigen::Matrix3f resU = U.at<float>(i);
+			const Eigen::Matrix3f resV = V.at<float>(i);
+			expectEqual(F.at<float>(i), resU * S * resV.transpose(), 1e-4f, i);
+		}
+		for (int i = (int) count; i < (int) NrProblems; i++)
+		{
+			EXPECT_EQ(F.at<float>(i), A.at<float>(i)) << "Problem " << i << " was modified";
+			EXPECT_EQ(Eigen::Matrix3f::Constant(2.0f), U.at<float>(i)) << "Problem " << i << " was modified";
+			EXPECT_EQ(Eigen::Matrix3f::Constant(3.0f), V.at<float>(i)) << "Problem " << i << " was modified";
+		}
+	}
+}
+
+TEST_F(Batch33, Rotation)
+{
+	const Matrix33Array F = createDeformations(NrProblems);
+	for (auto isa : InstructionSets)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Matrix33Array R(NrProblems);
+		for (int i = 0; i < (int) NrProblems; i++)
+			R.at<float>(i).setIdentity();
+		Vcl::Mathematics::Rotation(F, R, NrProblems);
+
+		for (int i = 0; i < (int) NrProblems; i++)
+		{
+			const Eigen::Matrix3f A = F.at<float>(i);
+			Eigen::Matrix3f refR = Eigen::Matrix3f::Identity();
+			Vcl::Mathematics::Rotation(A, refR);
+
+			SCOPED_TRACE(Vcl::name(isa));
+			expectEqual(refR, R.at<float>(i), 1e-4f, i);
+		}
+	}
+}
+
+TEST_F(Batch33, PolarDecomposition)
+{
+	const Matrix33Array F = createProblems(NrProblems);
+	for (auto isa : InstructionSets)
+	{
+		Vcl::setInstructionSetLimit(isa);
+
+		Matrix33Array A(NrProblems), R(NrProblems), S(NrProblems);
+		copy(F, A);
+		Vcl::Mathematics::PolarDecomposition(A, R, &S, NrProblems);
+
+		for (int i = 0; i < (int) NrProblems; i++)
+		{
+			Eigen::Matrix3f refA = F.at<float>(i);
+			Eigen::Matrix3f refR, refS;
+			Vcl::Mathematics::PolarDecomposition(refA, refR, &refS);
+
+			SCOPED_TRACE(Vcl::name(isa));
+			expectEqual(refR, R.at<float>(i), 1e-4f, i);
+			expectEqual(refS, S.at<float>(i), 1e-4f, i);
+		}
+	}
+}
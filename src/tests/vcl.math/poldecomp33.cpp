@@ -75,7 +75,7 @@ namespace
 		// Compute reference using Eigen
 		for (int i = 0; i < static_cast<int>(nr_problems); i++)
 		{
-			Vcl::Matrix3f A = F.template at<Scalar>(i);
+			Eigen::Matrix<Scalar, 3, 3> A = F.template at<Scalar>(i);
 
 			Eigen::JacobiSVD<Eigen::Matrix<Scalar, 3, 3>> svd(A, Eigen::ComputeFullU | Eigen::ComputeFullV);
 
@@ -115,11 +115,11 @@ namespace
 
 		for (int i = 0; i < static_cast<int>(nr_problems); i++)
 		{
-			Vcl::Matrix3f refR = refRa.template at<Scalar>(i);
-			Vcl::Matrix3f refS = refSa.template at<Scalar>(i);
+			Eigen::Matrix<Scalar, 3, 3> refR = refRa.template at<Scalar>(i);
+			Eigen::Matrix<Scalar, 3, 3> refS = refSa.template at<Scalar>(i);
 
-			Vcl::Matrix3f resR = resRa.template at<Scalar>(i);
-			Vcl::Matrix3f resS = resSa.template at<Scalar>(i);
+			Eigen::Matrix<Scalar, 3, 3> resR = resRa.template at<Scalar>(i);
+			Eigen::Matrix<Scalar, 3, 3> resS = resSa.template at<Scalar>(i);
 
 			Scalar sqLenRefRc0 = refR.col(0).squaredNorm();
 			Scalar sqLenRefRc1 = refR.col(1).squaredNorm();
@@ -141,17 +141,17 @@ namespace
 			EXPECT_TRUE(eqS) << "S(" << i << ") - Ref: " << refS.format(fmt) << ", Actual: " << resS.format(fmt);
 			EXPECT_TRUE(eqR) << "R(" << i << ") - Ref: " << refR.format(fmt) << ", Actual: " << resR.format(fmt);
 
-			Vcl::Matrix3f I = resR.transpose() * resR;
-			Vcl::Matrix3f Iref = Vcl::Matrix3f::Identity();
+			Eigen::Matrix<Scalar, 3, 3> I = resR.transpose() * resR;
+			Eigen::Matrix<Scalar, 3, 3> Iref = Eigen::Matrix<Scalar, 3, 3>::Identity();
 
 			EXPECT_TRUE(equal(Iref, I, tol)) << "Index: " << i << ", Result U^t U: not Identity.";
 		}
 	}
 }
 template<typename WideScalar>
-void runPolDecompTest(float tol)
+void runPolDecompTest(typename Vcl::NumericTrait<WideScalar>::base_t tol)
 {
-	using scalar_t = float;
+	using scalar_t = typename Vcl::NumericTrait<WideScalar>::base_t;
 	using real_t = WideScalar;
 	using matrix3_t = Eigen::Matrix<real_t, 3, 3>;
 	using vector3_t = Eigen::Matrix<real_t, 3, 1>;
@@ -172,13 +172,13 @@ void runPolDecompTest(float tol)
 
 	for (int i = 0; i < static_cast<int>(stride / width); i++)
 	{
-		matrix3_t A = F.at<real_t>(i);
+		matrix3_t A = F.template at<real_t>(i);
 		matrix3_t R, S;
 
 		Vcl::Mathematics::PolarDecomposition(A, R, &S);
 
-		resR.at<real_t>(i) = R;
-		resS.at<real_t>(i) = S;
+		resR.template at<real_t>(i) = R;
+		resS.template at<real_t>(i) = S;
 	}
 
 	// Check against reference solution
@@ -201,3 +201,19 @@ TEST(PolarDecomposition33, PolDecompFloat16)
 {
 	runPolDecompTest<Vcl::float16>(5e-5f);
 }
+TEST(PolarDecomposition33, PolDecompDouble)
+{
+	runPolDecompTest<double>(1e-6);
+}
+TEST(PolarDecomposition33, PolDecompDouble2)
+{
+	runPolDecompTest<Vcl::double2>(1e-6);
+}
+TEST(PolarDecomposition33, PolDecompDouble4)
+{
+	runPolDecompTest<Vcl::double4>(1e-6);
+}
+TEST(PolarDecomposition33, PolDecompDouble8)
+{
+	runPolDecompTest<Vcl::double8>(1e-6);
+}